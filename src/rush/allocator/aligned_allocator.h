@@ -0,0 +1,43 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_ALIGNED_ALLOCATOR_H
+#define RUSH_ALIGNED_ALLOCATOR_H
+
+#include <algorithm>
+#include <cstddef>
+
+#include <rush/allocator/stack_allocator.h>
+
+namespace rush {
+    /**
+     * Stores the data inside the owner object, like StaticAllocator,
+     * aligned to the given amount of bytes.
+     * <p>
+     * Use a cache line (64 bytes) to ensure that the objects
+     * of an array never straddle two cache lines:
+     * <pre>
+     * using Mat4fA = rush::Mat<4, 4, float, rush::MatDenseRep, rush::AlignedAllocator<64>>;
+     * std::vector<Mat4fA> matrices; // Every matrix uses exactly one cache line.
+     * </pre>
+     * The size of the storage is rounded up to a multiple of the alignment.
+     * If the alignment is smaller than the one StaticAllocator would use,
+     * the latter is used.
+     *
+     * @tparam Alignment the alignment in bytes. It must be a power of two.
+     */
+    template<size_t Alignment> requires (Alignment > 0 && (Alignment & (Alignment - 1)) == 0)
+    struct AlignedAllocator {
+        template<size_t Size, typename Type>
+        using AllocatedData = detail::InlineData<Size, Type,
+            std::max(Alignment, detail::DefaultAlignment<Size, Type>)>;
+    };
+
+    /**
+     * The alignment of a cache line in most desktop CPUs.
+     */
+    using CacheLineAllocator = AlignedAllocator<64>;
+}
+
+#endif //RUSH_ALIGNED_ALLOCATOR_H
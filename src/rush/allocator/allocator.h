@@ -6,9 +6,12 @@
 #define RUSH_ALLOCATOR_H
 
 #include <rush/allocator/stack_allocator.h>
+#include <rush/allocator/aligned_allocator.h>
 #include <rush/allocator/heap_allocator.h>
+#include <rush/allocator/small_buffer_allocator.h>
 #include <rush/allocator/pool.h>
 #include <rush/allocator/permanent_pool.h>
 #include <rush/allocator/permanent_heap_pool.h>
+#include <rush/allocator/pool_allocator.h>
 
 #endif //RUSH_ALLOCATOR_H
@@ -5,6 +5,7 @@
 #ifndef RUSH_HEAP_ALLOCATOR_H
 #define RUSH_HEAP_ALLOCATOR_H
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <memory>
@@ -34,11 +35,17 @@ namespace rush {
             }
 
             AllocatedData& operator=(const AllocatedData& other) {
+                if (this == &other) return *this;
+                // Moved objects have no storage.
+                if (data == nullptr) {
+                    data = std::make_unique<Storage>();
+                }
                 std::copy(other.cbegin(), other.cend(), data->begin());
                 return *this;
             }
 
             AllocatedData& operator=(AllocatedData&& other) noexcept {
+                if (this == &other) return *this;
                 data = std::move(other.data);
                 return *this;
             }
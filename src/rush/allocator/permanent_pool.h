@@ -50,6 +50,14 @@ namespace rush {
             _occupiedAmount += amount;
             return &_data[ptr];
         }
+
+        /**
+         * Releases all the allocated data at once.
+         * Data allocated from this pool must not be used after this call.
+         */
+        void reset() {
+            _occupiedAmount = 0;
+        }
     };
 }
 #endif //PERMANENT_POOL_H
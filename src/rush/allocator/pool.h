@@ -36,6 +36,13 @@ namespace rush {
 
         Pool(const Pool& other) = delete;
 
+        /**
+         * @return the size in bytes of each chunk.
+         */
+        static constexpr size_t chunkSize() {
+            return ChunkSize;
+        }
+
         /**
          * @return the amount of allocated chunks.
          */
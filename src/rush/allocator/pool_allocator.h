@@ -0,0 +1,284 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_POOL_ALLOCATOR_H
+#define RUSH_POOL_ALLOCATOR_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+
+#include <rush/allocator/stack_allocator.h>
+
+namespace rush {
+    namespace detail {
+        /**
+         * A pool allocating chunks of a fixed size (rush::Pool).
+         */
+        template<typename Arena>
+        concept ChunkArena = requires(Arena& arena, const void* ptr) {
+            { arena.allocate() } -> std::same_as<std::optional<void*>>;
+            { arena.deallocate(ptr) } -> std::same_as<bool>;
+            { Arena::chunkSize() } -> std::convertible_to<size_t>;
+        };
+
+        /**
+         * A pool allocating any amount of bytes
+         * (rush::PermanentPool, rush::PermanentHeapPool).
+         */
+        template<typename Arena>
+        concept BytesArena = requires(Arena& arena, size_t amount) {
+            { arena.allocate(amount) } -> std::same_as<std::optional<void*>>;
+        };
+
+        inline void* alignPointer(void* ptr, size_t alignment) {
+            auto address = reinterpret_cast<uintptr_t>(ptr);
+            address = (address + alignment - 1) & ~(uintptr_t(alignment) - 1);
+            return reinterpret_cast<void*>(address);
+        }
+
+        /**
+         * Allocates the given amount of bytes from the arena.
+         * Returns nullptr if the arena cannot fulfill the request.
+         */
+        template<typename Arena>
+        void* arenaAllocate(Arena& arena, size_t bytes, size_t alignment) {
+            // Arenas give no alignment guarantees:
+            // the worst case padding is always requested.
+            size_t padded = bytes + alignment - 1;
+            if constexpr (ChunkArena<Arena>) {
+                if (padded > Arena::chunkSize()) return nullptr;
+                auto chunk = arena.allocate();
+                return chunk ? alignPointer(*chunk, alignment) : nullptr;
+            } else {
+                auto ptr = arena.allocate(padded);
+                return ptr ? alignPointer(*ptr, alignment) : nullptr;
+            }
+        }
+
+        template<typename Arena>
+        void arenaDeallocate(Arena& arena, void* ptr) {
+            if constexpr (ChunkArena<Arena>) {
+                arena.deallocate(ptr);
+            }
+            // Byte arenas are released all at once.
+        }
+    }
+
+    /**
+     * Allocator taking the storage of its objects from a memory pool.
+     * <p>
+     * The pool is bound to the current thread using a Scope.
+     * Objects created while the scope is alive take their storage
+     * from the pool. Objects created without a bound pool, or when the
+     * pool is full, use the global operator new.
+     * <pre>
+     * using PoolMat = rush::Mat<100, 100, double, rush::MatDenseRep,
+     *                           rush::PoolAllocator<rush::PermanentHeapPool>>;
+     *
+     * rush::PermanentHeapPool arena(1 << 20);
+     * {
+     *     rush::PoolAllocator<rush::PermanentHeapPool>::Scope scope(arena);
+     *     PoolMat a = ..., b = ...;
+     *     PoolMat c = a * b + a; // Temporaries are allocated in the arena.
+     * }
+     * arena.reset(); // Releases every matrix at once.
+     * </pre>
+     * Objects remember the pool they were allocated from.
+     * Chunk pools (Pool) get their chunks back when the objects are
+     * destroyed. Byte pools (PermanentPool, PermanentHeapPool) are
+     * released with reset(): objects using them must be destroyed
+     * before, but their destruction does not touch the pool.
+     * <p>
+     * The storage has the same alignment StaticAllocator would use.
+     * <p>
+     * Pools are not thread-safe, so scopes only affect the thread
+     * creating them. Worker threads (see parallelFor()) use
+     * the global operator new unless they bind their own pool.
+     *
+     * @tparam Arena the type of the pool: Pool, PermanentPool,
+     * PermanentHeapPool or any type with a compatible allocate() method.
+     */
+    template<typename Arena>
+        requires detail::ChunkArena<Arena> || detail::BytesArena<Arena>
+    struct PoolAllocator {
+        /**
+         * Binds a pool to the current thread during its lifetime.
+         * <p>
+         * Scopes can be nested: the previous pool is restored
+         * when the scope is destroyed.
+         */
+        class Scope {
+            Arena* _previous;
+
+        public:
+            explicit Scope(Arena& arena) : _previous(std::exchange(slot(), &arena)) {
+            }
+
+            Scope(const Scope& other) = delete;
+
+            Scope& operator=(const Scope& other) = delete;
+
+            ~Scope() {
+                slot() = _previous;
+            }
+        };
+
+        /**
+         * @return the pool bound to the current thread or nullptr.
+         */
+        static Arena* current() {
+            return slot();
+        }
+
+        template<size_t Size, typename Type>
+        struct AllocatedData {
+            using AllocType = Type;
+
+            Type* data;
+            Arena* arena;
+
+            AllocatedData() : data(nullptr), arena(nullptr) {
+                allocate();
+                std::uninitialized_value_construct_n(data, Size);
+            }
+
+            AllocatedData(const AllocatedData& other) : data(nullptr), arena(nullptr) {
+                allocate();
+                std::uninitialized_copy_n(other.data, Size, data);
+            }
+
+            AllocatedData(AllocatedData&& other) noexcept:
+                    data(std::exchange(other.data, nullptr)),
+                    arena(std::exchange(other.arena, nullptr)) {
+            }
+
+            ~AllocatedData() {
+                release();
+            }
+
+            AllocatedData& operator=(const AllocatedData& other) {
+                if (this == &other) return *this;
+                if (data == nullptr) {
+                    // This object has been moved.
+                    allocate();
+                    std::uninitialized_copy_n(other.data, Size, data);
+                } else {
+                    std::copy_n(other.data, Size, data);
+                }
+                return *this;
+            }
+
+            AllocatedData& operator=(AllocatedData&& other) noexcept {
+                if (this == &other) return *this;
+                release();
+                data = std::exchange(other.data, nullptr);
+                arena = std::exchange(other.arena, nullptr);
+                return *this;
+            }
+
+            static constexpr size_t size() {
+                return Size;
+            }
+
+            inline Type& operator[](size_t i) {
+                return data[i];
+            }
+
+            inline const Type& operator[](size_t i) const {
+                return data[i];
+            }
+
+            inline Type* toPointer() {
+                return data;
+            }
+
+            inline const Type* toPointer() const {
+                return data;
+            }
+
+            inline Type* begin() {
+                return data;
+            }
+
+            inline Type* end() {
+                return data + Size;
+            }
+
+            inline const Type* begin() const {
+                return data;
+            }
+
+            inline const Type* end() const {
+                return data + Size;
+            }
+
+            inline const Type* cbegin() const {
+                return data;
+            }
+
+            inline const Type* cend() const {
+                return data + Size;
+            }
+
+            inline std::reverse_iterator<Type*> rbegin() {
+                return std::reverse_iterator<Type*>(end());
+            }
+
+            inline std::reverse_iterator<Type*> rend() {
+                return std::reverse_iterator<Type*>(begin());
+            }
+
+            inline std::reverse_iterator<const Type*> crbegin() const {
+                return std::reverse_iterator<const Type*>(cend());
+            }
+
+            inline std::reverse_iterator<const Type*> crend() const {
+                return std::reverse_iterator<const Type*>(cbegin());
+            }
+
+        private:
+            static constexpr size_t ALIGNMENT = detail::DefaultAlignment<Size, Type>;
+
+            void allocate() {
+                constexpr size_t BYTES = sizeof(Type) * Size;
+                arena = current();
+                void* ptr = arena == nullptr
+                                ? nullptr
+                                : detail::arenaAllocate(*arena, BYTES, ALIGNMENT);
+                if (ptr == nullptr) {
+                    arena = nullptr;
+                    ptr = ::operator new(BYTES, std::align_val_t(ALIGNMENT));
+                }
+                data = static_cast<Type*>(ptr);
+            }
+
+            void release() {
+                if (data == nullptr) return;
+                std::destroy_n(data, Size);
+                if (arena == nullptr) {
+                    ::operator delete(data, std::align_val_t(ALIGNMENT));
+                } else {
+                    detail::arenaDeallocate(*arena, data);
+                }
+                data = nullptr;
+                arena = nullptr;
+            }
+        };
+
+    private:
+        static Arena*& slot() {
+            thread_local Arena* arena = nullptr;
+            return arena;
+        }
+    };
+}
+
+#endif //RUSH_POOL_ALLOCATOR_H
@@ -0,0 +1,49 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_SMALL_BUFFER_ALLOCATOR_H
+#define RUSH_SMALL_BUFFER_ALLOCATOR_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include <rush/allocator/stack_allocator.h>
+#include <rush/allocator/heap_allocator.h>
+
+namespace rush {
+    /**
+     * Stores the data inside the owner object, like StaticAllocator,
+     * when it fits in the given amount of bytes.
+     * Larger data is stored in the heap, like HeapAllocator.
+     * <p>
+     * The sizes of Rush objects are known at compile time,
+     * so the storage is selected at compile time too:
+     * inline objects have no extra indirection or flag, and
+     * heap objects never waste the inline buffer.
+     * <p>
+     * Inline data is copied and moved like StaticAllocator data.
+     * Heap data is moved by stealing its pointer; copies allocate.
+     * <pre>
+     * using Small = rush::SmallBufferAllocator<>;
+     * rush::Mat<4, 4, double, rush::MatDenseRep, Small> a;       // 128 bytes: inline.
+     * rush::Mat<100, 100, double, rush::MatDenseRep, Small> b;   // 80000 bytes: heap.
+     * </pre>
+     *
+     * @tparam InlineBytes the maximum size in bytes of inline data.
+     */
+    template<size_t InlineBytes = 256>
+    struct SmallBufferAllocator {
+        template<size_t Size, typename Type>
+        static constexpr bool IsInline = sizeof(Type) * Size <= InlineBytes;
+
+        template<size_t Size, typename Type>
+        using AllocatedData = std::conditional_t<
+            IsInline<Size, Type>,
+            StaticAllocator::AllocatedData<Size, Type>,
+            HeapAllocator::AllocatedData<Size, Type>
+        >;
+    };
+}
+
+#endif //RUSH_SMALL_BUFFER_ALLOCATOR_H
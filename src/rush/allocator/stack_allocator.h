@@ -7,83 +7,105 @@
 
 #include <array>
 #include <cstddef>
+#include <type_traits>
 
 namespace rush {
-
-    struct StaticAllocator {
-
+    namespace detail {
+        /**
+         * The alignment of the inline storage of Size values of the given type.
+         * <p>
+         * Four-component float storages are aligned to 16 bytes:
+         * they never straddle a cache line and can be loaded
+         * using aligned SIMD loads.
+         * This also aligns the columns of 4x4 float matrices.
+         */
         template<size_t Size, typename Type>
-        struct AllocatedData {
+        constexpr size_t DefaultAlignment =
+                Size == 4 && std::is_same_v<Type, float>
+                ? 16
+                : alignof(std::array<Type, Size>);
+
+        /**
+         * Storage of Size values inside the owner object.
+         * This is the storage of StaticAllocator and AlignedAllocator.
+         */
+        template<size_t Size, typename Type, size_t Alignment>
+        struct InlineData {
 
             using AllocType = Type;
             using Storage = std::array<Type, Size>;
 
-            Storage data;
+            alignas(Alignment) Storage data;
 
-            AllocatedData() : data() {
+            constexpr InlineData() : data() {
             }
 
             static constexpr size_t size() {
                 return Size;
             }
 
-            inline Type& operator[](size_t i) {
+            constexpr Type& operator[](size_t i) {
                 return data[i];
             }
 
-            inline const Type& operator[](size_t i) const {
+            constexpr const Type& operator[](size_t i) const {
                 return data[i];
             }
 
-            inline Type* toPointer() {
+            constexpr Type* toPointer() {
                 return data.data();
             }
 
-            inline const Type* toPointer() const {
+            constexpr const Type* toPointer() const {
                 return data.data();
             }
 
-            inline Storage::iterator begin() {
+            constexpr Storage::iterator begin() {
                 return data.begin();
             }
 
-            inline Storage::iterator end() {
+            constexpr Storage::iterator end() {
                 return data.end();
             }
 
-            inline Storage::iterator begin() const {
+            constexpr Storage::iterator begin() const {
                 return data.begin();
             }
 
-            inline Storage::iterator end() const {
+            constexpr Storage::iterator end() const {
                 return data.end();
             }
 
-            inline Storage::const_iterator cbegin() const {
+            constexpr Storage::const_iterator cbegin() const {
                 return data.cbegin();
             };
 
-            inline Storage::const_iterator cend() const {
+            constexpr Storage::const_iterator cend() const {
                 return data.cend();
             };
 
-            inline Storage::reverse_iterator rbegin() {
+            constexpr Storage::reverse_iterator rbegin() {
                 return data.rbegin();
             };
 
-            inline Storage::reverse_iterator rend() {
+            constexpr Storage::reverse_iterator rend() {
                 return data.rend();
             };
 
-            inline Storage::const_reverse_iterator crbegin() const {
+            constexpr Storage::const_reverse_iterator crbegin() const {
                 return data.crbegin();
             };
 
-            inline Storage::const_reverse_iterator crend() const {
+            constexpr Storage::const_reverse_iterator crend() const {
                 return data.crend();
             };
 
         };
+    }
+
+    struct StaticAllocator {
+        template<size_t Size, typename Type>
+        using AllocatedData = detail::InlineData<Size, Type, detail::DefaultAlignment<Size, Type>>;
     };
 
 }
@@ -0,0 +1,148 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_CPU_H
+#define RUSH_CPU_H
+
+#include <atomic>
+#include <cstdint>
+
+#include <rush/algorithm.h>
+
+#if defined(RUSH_INTRINSICS) && defined(_MSC_VER) && !defined(__clang__)
+
+#include <intrin.h>
+
+#define RUSH_DISPATCH
+// MSVC allows the use of any intrinsic without enabling
+// the instruction set at compile time.
+#define RUSH_TARGET_SSE4
+#define RUSH_TARGET_AVX2
+#define RUSH_TARGET_AVX512
+
+#elif defined(RUSH_INTRINSICS) && (defined(__GNUC__) || defined(__clang__))
+
+#define RUSH_DISPATCH
+#define RUSH_TARGET_SSE4 __attribute__((target("sse4.1")))
+#define RUSH_TARGET_AVX2 __attribute__((target("avx2,fma,f16c")))
+#define RUSH_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma,f16c")))
+
+#endif
+
+namespace rush {
+    /**
+     * The instruction sets Rush has kernels for.
+     * <p>
+     * The sets are ordered: a CPU supporting a set also
+     * supports all the previous ones.
+     * AVX2 implies FMA and F16C support.
+     */
+    enum class InstructionSet : uint8_t {
+        Generic,
+        SSE4,
+        AVX2,
+        AVX512
+    };
+
+    namespace cpu {
+        namespace detail {
+            inline InstructionSet detectInstructionSet() {
+#if defined(RUSH_DISPATCH) && defined(_MSC_VER) && !defined(__clang__)
+                int info[4];
+                __cpuid(info, 0);
+                int maxLeaf = info[0];
+
+                __cpuid(info, 1);
+                bool sse4 = (info[2] & (1 << 19)) != 0;
+                bool fma = (info[2] & (1 << 12)) != 0;
+                bool f16c = (info[2] & (1 << 29)) != 0;
+                bool osxsave = (info[2] & (1 << 27)) != 0;
+                if (!sse4) return InstructionSet::Generic;
+                if (!osxsave || maxLeaf < 7) return InstructionSet::SSE4;
+
+                // The OS must save the YMM (and ZMM) registers.
+                uint64_t xcr0 = _xgetbv(0);
+                if ((xcr0 & 0x6) != 0x6) return InstructionSet::SSE4;
+
+                __cpuidex(info, 7, 0);
+                bool avx2 = (info[1] & (1 << 5)) != 0;
+                bool avx512 = (info[1] & (1 << 16)) != 0;
+                if (!avx2 || !fma || !f16c) return InstructionSet::SSE4;
+                if (!avx512 || (xcr0 & 0xE6) != 0xE6) {
+                    return InstructionSet::AVX2;
+                }
+                return InstructionSet::AVX512;
+#elif defined(RUSH_DISPATCH)
+                // GCC and Clang also check that the OS saves
+                // the extended registers.
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx512f")) {
+                    return InstructionSet::AVX512;
+                }
+                if (__builtin_cpu_supports("avx2") &&
+                    __builtin_cpu_supports("fma") &&
+                    __builtin_cpu_supports("f16c")) {
+                    return InstructionSet::AVX2;
+                }
+                if (__builtin_cpu_supports("sse4.1")) {
+                    return InstructionSet::SSE4;
+                }
+                return InstructionSet::Generic;
+#else
+                return InstructionSet::Generic;
+#endif
+            }
+
+            inline std::atomic<InstructionSet>& activeInstructionSet() {
+                static std::atomic<InstructionSet> set = detectInstructionSet();
+                return set;
+            }
+        }
+
+        /**
+         * Returns the best instruction set supported by the CPU
+         * running this program.
+         * <p>
+         * The CPU is queried only once.
+         *
+         * @return the instruction set.
+         */
+        inline InstructionSet supportedInstructionSet() {
+            static const InstructionSet set = detail::detectInstructionSet();
+            return set;
+        }
+
+        /**
+         * Returns the instruction set the SIMD kernels are using.
+         * <p>
+         * This is the supported instruction set unless it
+         * was lowered using setInstructionSet().
+         *
+         * @return the instruction set.
+         */
+        inline InstructionSet instructionSet() {
+            return detail::activeInstructionSet().load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Changes the instruction set the SIMD kernels use.
+         * <p>
+         * The instruction set is clamped to the one supported
+         * by the CPU, so this can only be used to lower it.
+         * This is useful to test and benchmark the kernels of
+         * older CPUs.
+         *
+         * @param set the instruction set.
+         * @return the instruction set that will be used.
+         */
+        inline InstructionSet setInstructionSet(InstructionSet set) {
+            InstructionSet supported = supportedInstructionSet();
+            if (set > supported) set = supported;
+            detail::activeInstructionSet().store(set, std::memory_order_relaxed);
+            return set;
+        }
+    }
+}
+
+#endif //RUSH_CPU_H
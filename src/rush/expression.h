@@ -0,0 +1,268 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_EXPRESSION_H
+#define RUSH_EXPRESSION_H
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace rush {
+    /**
+     * The shape of a vector expression.
+     * <p>
+     * Vectors support element-wise products and divisions.
+     */
+    template<size_t Size>
+    struct VecShape {
+        static constexpr size_t ELEMENTS = Size;
+        static constexpr bool ELEMENT_WISE_PRODUCT = true;
+    };
+
+    /**
+     * The shape of a matrix expression.
+     * <p>
+     * Matrices can only be multiplied or divided by scalars
+     * inside lazy expressions: the matrix product
+     * is not an element-wise operation.
+     */
+    template<size_t Columns, size_t Rows>
+    struct MatShape {
+        static constexpr size_t ELEMENTS = Columns * Rows;
+        static constexpr bool ELEMENT_WISE_PRODUCT = false;
+    };
+
+    /**
+     * A lazy element-wise expression.
+     * <p>
+     * Lazy expressions are created using rush::lazy() and
+     * combined using the +, -, * and / operators.
+     * No values are computed until the expression is assigned to
+     * a Vec or a Mat, which evaluates the whole expression in a single
+     * loop without creating intermediate objects.
+     * <p>
+     * Expressions keep pointers to the data of their operands.
+     * They must be evaluated before any of their operands is destroyed,
+     * so they should not be stored in auto variables.
+     */
+    template<typename E>
+    concept Expression = requires(const E& e, size_t i) {
+        typename E::Shape;
+        typename E::ValueType;
+        { E::IS_EXPRESSION } -> std::convertible_to<bool>;
+        e.value(i);
+    };
+
+    /**
+     * Whether the given expression can be assigned to
+     * an object with the given shape and type.
+     */
+    template<typename E, typename Shape, typename Type>
+    concept ExpressionOf = Expression<E> &&
+                           std::is_same_v<typename E::Shape, Shape> &&
+                           std::is_convertible_v<typename E::ValueType, Type>;
+
+    // REGION NODES
+
+    template<typename S, typename Type>
+    struct ExpressionLeaf {
+        using Shape = S;
+        using ValueType = Type;
+        static constexpr bool IS_EXPRESSION = true;
+
+        const Type* data;
+
+        Type value(size_t i) const {
+            return data[i];
+        }
+    };
+
+    template<typename Type>
+    struct ExpressionScalar {
+        Type scalar;
+
+        Type value(size_t) const {
+            return scalar;
+        }
+    };
+
+    template<typename Inner>
+    struct ExpressionNegate {
+        using Shape = typename Inner::Shape;
+        using ValueType = typename Inner::ValueType;
+        static constexpr bool IS_EXPRESSION = true;
+
+        Inner inner;
+
+        ValueType value(size_t i) const {
+            return -inner.value(i);
+        }
+    };
+
+    template<typename Op, typename S, typename Type,
+        typename Left, typename Right>
+    struct ExpressionBinary {
+        using Shape = S;
+        using ValueType = Type;
+        static constexpr bool IS_EXPRESSION = true;
+
+        Left left;
+        Right right;
+
+        ValueType value(size_t i) const {
+            return Op::apply(left.value(i), right.value(i));
+        }
+    };
+
+    struct ExpressionAdd {
+        template<typename Type>
+        static Type apply(const Type& a, const Type& b) { return a + b; }
+    };
+
+    struct ExpressionSub {
+        template<typename Type>
+        static Type apply(const Type& a, const Type& b) { return a - b; }
+    };
+
+    struct ExpressionMul {
+        template<typename Type>
+        static Type apply(const Type& a, const Type& b) { return a * b; }
+    };
+
+    struct ExpressionDiv {
+        template<typename Type>
+        static Type apply(const Type& a, const Type& b) { return a / b; }
+    };
+
+    // ENDREGION
+
+    // REGION OPERANDS
+
+    /**
+     * Describes how an object takes part in a lazy expression.
+     * <p>
+     * Objects without a specialization are scalars.
+     * Vec and Mat specialize this struct in
+     * vec_expression.h and mat_expression.h.
+     */
+    template<typename T>
+    struct ExpressionOperand {
+        static constexpr bool IS_OPERAND = false;
+    };
+
+    template<typename E> requires Expression<E>
+    struct ExpressionOperand<E> {
+        static constexpr bool IS_OPERAND = true;
+        using Shape = typename E::Shape;
+        using ValueType = typename E::ValueType;
+
+        static const E& wrap(const E& e) {
+            return e;
+        }
+    };
+
+    namespace detail {
+        template<typename T>
+        constexpr bool IsOperand = ExpressionOperand<std::remove_cvref_t<T>>::IS_OPERAND;
+
+        template<typename L, typename R>
+        struct BinaryExpressionInfo;
+
+        template<typename L, typename R>
+            requires (IsOperand<L> && IsOperand<R>)
+        struct BinaryExpressionInfo<L, R> {
+            using Shape = typename ExpressionOperand<L>::Shape;
+            using ValueType = typename ExpressionOperand<L>::ValueType;
+            static constexpr bool VALID =
+                    std::is_same_v<Shape, typename ExpressionOperand<R>::Shape>;
+            static constexpr bool BOTH_OPERANDS = true;
+        };
+
+        template<typename L, typename R>
+            requires (IsOperand<L> && !IsOperand<R>)
+        struct BinaryExpressionInfo<L, R> {
+            using Shape = typename ExpressionOperand<L>::Shape;
+            using ValueType = typename ExpressionOperand<L>::ValueType;
+            static constexpr bool VALID = std::is_convertible_v<R, ValueType>;
+            static constexpr bool BOTH_OPERANDS = false;
+        };
+
+        template<typename L, typename R>
+            requires (!IsOperand<L> && IsOperand<R>)
+        struct BinaryExpressionInfo<L, R> {
+            using Shape = typename ExpressionOperand<R>::Shape;
+            using ValueType = typename ExpressionOperand<R>::ValueType;
+            static constexpr bool VALID = std::is_convertible_v<L, ValueType>;
+            static constexpr bool BOTH_OPERANDS = false;
+        };
+
+        template<typename ValueType, typename T>
+        auto wrapOperand(const T& t) {
+            if constexpr (IsOperand<T>) {
+                return ExpressionOperand<T>::wrap(t);
+            } else {
+                return ExpressionScalar<ValueType>{static_cast<ValueType>(t)};
+            }
+        }
+
+        template<typename Op, typename L, typename R>
+        auto makeBinary(const L& l, const R& r) {
+            using Info = BinaryExpressionInfo<L, R>;
+            using Type = typename Info::ValueType;
+            auto left = wrapOperand<Type>(l);
+            auto right = wrapOperand<Type>(r);
+            return ExpressionBinary<Op, typename Info::Shape, Type,
+                decltype(left), decltype(right)>{left, right};
+        }
+
+        /**
+         * Whether a binary lazy operation can be applied to L and R.
+         * At least one of them must be an expression: operations
+         * between plain vectors or matrices stay eager.
+         */
+        template<typename L, typename R>
+        concept LazyOperands = (Expression<L> || Expression<R>) &&
+                               BinaryExpressionInfo<L, R>::VALID;
+
+        template<typename L, typename R>
+        concept LazyProductOperands =
+                LazyOperands<L, R> &&
+                (!BinaryExpressionInfo<L, R>::BOTH_OPERANDS ||
+                 BinaryExpressionInfo<L, R>::Shape::ELEMENT_WISE_PRODUCT);
+    }
+
+    // ENDREGION
+}
+
+// REGION OPERATORS
+
+template<rush::Expression E>
+rush::ExpressionNegate<E> operator-(const E& e) {
+    return {e};
+}
+
+template<typename L, typename R> requires rush::detail::LazyOperands<L, R>
+auto operator+(const L& l, const R& r) {
+    return rush::detail::makeBinary<rush::ExpressionAdd>(l, r);
+}
+
+template<typename L, typename R> requires rush::detail::LazyOperands<L, R>
+auto operator-(const L& l, const R& r) {
+    return rush::detail::makeBinary<rush::ExpressionSub>(l, r);
+}
+
+template<typename L, typename R> requires rush::detail::LazyProductOperands<L, R>
+auto operator*(const L& l, const R& r) {
+    return rush::detail::makeBinary<rush::ExpressionMul>(l, r);
+}
+
+template<typename L, typename R> requires rush::detail::LazyProductOperands<L, R>
+auto operator/(const L& l, const R& r) {
+    return rush::detail::makeBinary<rush::ExpressionDiv>(l, r);
+}
+
+// ENDREGION
+
+#endif //RUSH_EXPRESSION_H
@@ -0,0 +1,786 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_FAST_MATH_H
+#define RUSH_FAST_MATH_H
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+
+#include <rush/cpu.h>
+#include <rush/simd.h>
+
+/**
+ * Fast approximations of the single-precision transcendental functions.
+ * <p>
+ * The functions use range reduction and minimax polynomials
+ * (the coefficients of the Cephes library). The scalar functions
+ * and the SIMD kernels share the same algorithms.
+ * <p>
+ * The documented errors are the maximum distance to the correctly
+ * rounded result, measured in units in the last place (ULP) over
+ * the documented domain. Results may differ by 1 ULP between
+ * instruction sets, as AVX2 kernels use fused multiply-add.
+ * <p>
+ * Denormal results are flushed to zero, and denormal inputs
+ * are treated as zero.
+ * <p>
+ * These functions are used by the vector functions of rush/vector/vec_math.h
+ * when their Algorithm has Precision::Low.
+ */
+namespace rush::fast {
+    namespace detail {
+        enum class Function {
+            Sin,
+            Cos,
+            SinCos,
+            Atan2,
+            Exp,
+            Log,
+            Pow
+        };
+
+        constexpr float TWO_OVER_PI = 0.636619772367581343f;
+        constexpr float HALF_PI = std::numbers::pi_v<float> / 2.0f;
+        constexpr float QUARTER_PI = std::numbers::pi_v<float> / 4.0f;
+
+        // PI / 2 split in three parts.
+        // The first two parts have few significant bits,
+        // so j * PART is exact for the reduced range.
+        constexpr float HALF_PI_HIGH = 1.5703125f;
+        constexpr float HALF_PI_MID = 4.837512969970703125e-4f;
+        constexpr float HALF_PI_LOW = 7.54978995489188216e-8f;
+
+        constexpr float MAX_TRIG_ARGUMENT = 8192.0f;
+
+        constexpr float SIN_COEFFICIENTS[] = {
+            -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f
+        };
+        constexpr float COS_COEFFICIENTS[] = {
+            4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f
+        };
+
+        constexpr float TAN_PI_8 = 0.414213562373095f;
+        constexpr float ATAN_COEFFICIENTS[] = {
+            -3.33329491539e-1f, 1.99777106478e-1f, -1.38776856032e-1f, 8.05374449538e-2f
+        };
+
+        // ln(2) split in two parts.
+        constexpr float LN2_HIGH = 0.693359375f;
+        constexpr float LN2_LOW = -2.12194440e-4f;
+        constexpr float LOG2E = 1.44269504088896341f;
+
+        constexpr float EXP_MAX = 88.3762626647949f;
+        constexpr float EXP_MIN = -87.3365447505531f;
+        constexpr float EXP_COEFFICIENTS[] = {
+            5.0000001201e-1f, 1.6666665459e-1f, 4.1665795894e-2f,
+            8.3334519073e-3f, 1.3981999507e-3f, 1.9875691500e-4f
+        };
+
+        constexpr float SQRT_HALF = 0.707106781186547524f;
+        constexpr float LOG_COEFFICIENTS[] = {
+            3.3333331174e-1f, -2.4999993993e-1f, 2.0000714765e-1f,
+            -1.6668057665e-1f, 1.4249322787e-1f, -1.2420140846e-1f,
+            1.1676998740e-1f, -1.1514610310e-1f, 7.0376836292e-2f
+        };
+
+        constexpr float INF = std::numeric_limits<float>::infinity();
+        constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+
+        template<size_t N>
+        inline float polynomial(float x, const float (&coefficients)[N]) {
+            float result = coefficients[N - 1];
+            for (size_t i = N - 1; i-- > 0;) {
+                result = result * x + coefficients[i];
+            }
+            return result;
+        }
+
+        /**
+         * Rounds to the nearest integer, ties to even.
+         * Only valid for |v| < 2^22.
+         */
+        inline float roundNearest(float v) {
+            constexpr float SHIFTER = 12582912.0f; // 1.5 * 2^23
+            return (v + SHIFTER) - SHIFTER;
+        }
+
+        inline float flipSign(float v, uint32_t signBit) {
+            return std::bit_cast<float>(std::bit_cast<uint32_t>(v) ^ signBit);
+        }
+    }
+
+    /**
+     * Computes the sine and cosine of the given angle.
+     * <p>
+     * Max error: 2 ULP for |x| <= PI.
+     * For |x| <= 8192 the absolute error stays below 1e-7,
+     * but results close to zero lose relative precision.
+     * Larger or non-finite arguments use std::sin and std::cos.
+     *
+     * @param x the angle, in radians.
+     * @param s where the sine is written.
+     * @param c where the cosine is written.
+     */
+    inline void sincos(float x, float& s, float& c) {
+        using namespace detail;
+        if (!(std::abs(x) <= MAX_TRIG_ARGUMENT)) {
+            s = std::sin(x);
+            c = std::cos(x);
+            return;
+        }
+
+        float j = roundNearest(x * TWO_OVER_PI);
+        auto q = static_cast<uint32_t>(static_cast<int32_t>(j));
+        float r = ((x - j * HALF_PI_HIGH) - j * HALF_PI_MID) - j * HALF_PI_LOW;
+        float z = r * r;
+
+        float ps = r + r * z * polynomial(z, SIN_COEFFICIENTS);
+        float pc = 1.0f - z * 0.5f + z * z * polynomial(z, COS_COEFFICIENTS);
+
+        bool odd = (q & 1) != 0;
+        s = flipSign(odd ? pc : ps, (q & 2) << 30);
+        c = flipSign(odd ? ps : pc, ((q + 1) & 2) << 30);
+    }
+
+    /**
+     * Computes the sine of the given angle.
+     * <p>
+     * Max error: 2 ULP for |x| <= PI, 1e-7 absolute for |x| <= 8192.
+     * Larger or non-finite arguments use std::sin.
+     *
+     * @param x the angle, in radians.
+     * @return the sine.
+     */
+    inline float sin(float x) {
+        float s, c;
+        sincos(x, s, c);
+        return s;
+    }
+
+    /**
+     * Computes the cosine of the given angle.
+     * <p>
+     * Max error: 2 ULP for |x| <= PI, 1e-7 absolute for |x| <= 8192.
+     * Larger or non-finite arguments use std::cos.
+     *
+     * @param x the angle, in radians.
+     * @return the cosine.
+     */
+    inline float cos(float x) {
+        float s, c;
+        sincos(x, s, c);
+        return c;
+    }
+
+    /**
+     * Computes the angle of the point (x, y).
+     * <p>
+     * Max error: 3 ULP for finite inputs.
+     * Unlike std::atan2, the sign of a zero x is ignored
+     * and infinite inputs return NaN.
+     *
+     * @param y the y coordinate.
+     * @param x the x coordinate.
+     * @return the angle in radians, in the range [-PI, PI].
+     */
+    inline float atan2(float y, float x) {
+        using namespace detail;
+        if (std::isnan(x) || std::isnan(y)) return x + y;
+
+        float ax = std::abs(x);
+        float ay = std::abs(y);
+        float mx = std::max(ax, ay);
+        float a = mx == 0.0f ? 0.0f : std::min(ax, ay) / mx;
+
+        bool big = TAN_PI_8 < a;
+        float t = big ? (a - 1.0f) / (a + 1.0f) : a;
+        float z = t * t;
+        float r = (big ? QUARTER_PI : 0.0f) + (polynomial(z, ATAN_COEFFICIENTS) * z * t + t);
+
+        if (ax < ay) r = HALF_PI - r;
+        if (x < 0.0f) r = std::numbers::pi_v<float> - r;
+        return flipSign(r, std::bit_cast<uint32_t>(y) & 0x80000000u);
+    }
+
+    /**
+     * Computes e raised to the given power.
+     * <p>
+     * Max error: 1 ULP for results in the normal range.
+     *
+     * @param x the exponent.
+     * @return e^x.
+     */
+    inline float exp(float x) {
+        using namespace detail;
+        if (std::isnan(x)) return x;
+        if (x > EXP_MAX) return INF;
+        if (x < EXP_MIN) return 0.0f;
+
+        float n = roundNearest(x * LOG2E);
+        float r = (x - n * LN2_HIGH) - n * LN2_LOW;
+        float p = polynomial(r, EXP_COEFFICIENTS) * r * r + r + 1.0f;
+
+        auto exponent = static_cast<uint32_t>(static_cast<int32_t>(n) + 127) << 23;
+        return p * std::bit_cast<float>(exponent);
+    }
+
+    /**
+     * Computes the natural logarithm of the given value.
+     * <p>
+     * Max error: 1 ULP.
+     *
+     * @param x the value.
+     * @return ln(x). -inf if x is zero, NaN if x is negative.
+     */
+    inline float log(float x) {
+        using namespace detail;
+        if (!(x >= 0.0f)) return NaN;
+        if (x < std::numeric_limits<float>::min()) return -INF;
+        if (x == INF) return INF;
+
+        auto bits = std::bit_cast<uint32_t>(x);
+        auto e = static_cast<float>(static_cast<int32_t>(bits >> 23) - 126);
+        float m = std::bit_cast<float>((bits & 0x007FFFFFu) | 0x3F000000u);
+
+        bool small = m < SQRT_HALF;
+        e -= small ? 1.0f : 0.0f;
+        m = (m - 1.0f) + (small ? m : 0.0f);
+
+        float z = m * m;
+        float y = polynomial(m, LOG_COEFFICIENTS) * m * z;
+        y += e * LN2_LOW;
+        y -= z * 0.5f;
+        return (m + y) + e * LN2_HIGH;
+    }
+
+    /**
+     * Computes x raised to y, as exp(y * log(x)).
+     * <p>
+     * x must be positive or zero.
+     * The error grows with the magnitude of y * log(x):
+     * it is at most 2 ULP when |y * log(x)| <= 1, and it is bounded by
+     * 2 + 2 * |y * log(x)| ULP otherwise.
+     *
+     * @param x the base.
+     * @param y the exponent.
+     * @return x^y. NaN if x is negative.
+     */
+    inline float pow(float x, float y) {
+        if (y == 0.0f) return 1.0f;
+        if (x < 0.0f) return detail::NaN;
+        return exp(y * log(x));
+    }
+
+#ifdef RUSH_DISPATCH
+
+    // REGION KERNELS
+
+    namespace detail {
+        // REGION SSE4
+
+        RUSH_TARGET_SSE4 inline void sincosSSE4(__m128 x, __m128& s, __m128& c) {
+            using O = simd::SSE4<float>;
+            auto q = O::roundToInt(O::mul(x, O::set1(TWO_OVER_PI)));
+            auto j = O::toFloat(q);
+            auto r = O::sub(O::sub(O::sub(x, O::mul(j, O::set1(HALF_PI_HIGH))),
+                                   O::mul(j, O::set1(HALF_PI_MID))),
+                            O::mul(j, O::set1(HALF_PI_LOW)));
+            auto z = O::mul(r, r);
+
+            auto ps = O::set1(SIN_COEFFICIENTS[2]);
+            ps = O::fmadd(ps, z, O::set1(SIN_COEFFICIENTS[1]));
+            ps = O::fmadd(ps, z, O::set1(SIN_COEFFICIENTS[0]));
+            ps = O::add(r, O::mul(O::mul(r, z), ps));
+
+            auto pc = O::set1(COS_COEFFICIENTS[2]);
+            pc = O::fmadd(pc, z, O::set1(COS_COEFFICIENTS[1]));
+            pc = O::fmadd(pc, z, O::set1(COS_COEFFICIENTS[0]));
+            pc = O::add(O::sub(O::set1(1.0f), O::mul(z, O::set1(0.5f))),
+                        O::mul(O::mul(z, z), pc));
+
+            // select() only checks the sign bit of the mask.
+            auto odd = O::asFloat(O::shiftLeftInt<31>(q));
+            auto two = O::set1Int(2);
+            auto sinSign = O::asFloat(O::shiftLeftInt<30>(O::andInt(q, two)));
+            auto cosSign = O::asFloat(O::shiftLeftInt<30>(O::andInt(O::addInt(q, O::set1Int(1)), two)));
+
+            s = O::bitXor(O::select(odd, pc, ps), sinSign);
+            c = O::bitXor(O::select(odd, ps, pc), cosSign);
+        }
+
+        RUSH_TARGET_SSE4 inline __m128 atan2SSE4(__m128 y, __m128 x) {
+            using O = simd::SSE4<float>;
+            auto absMask = O::asFloat(O::set1Int(0x7FFFFFFF));
+            auto zero = O::zero();
+            auto one = O::set1(1.0f);
+
+            auto ax = O::bitAnd(x, absMask);
+            auto ay = O::bitAnd(y, absMask);
+            auto mx = O::max(ax, ay);
+            auto a = O::select(O::equal(mx, zero), zero, O::div(O::min(ax, ay), mx));
+
+            auto big = O::less(O::set1(TAN_PI_8), a);
+            auto t = O::select(big, O::div(O::sub(a, one), O::add(a, one)), a);
+            auto z = O::mul(t, t);
+
+            auto p = O::set1(ATAN_COEFFICIENTS[3]);
+            p = O::fmadd(p, z, O::set1(ATAN_COEFFICIENTS[2]));
+            p = O::fmadd(p, z, O::set1(ATAN_COEFFICIENTS[1]));
+            p = O::fmadd(p, z, O::set1(ATAN_COEFFICIENTS[0]));
+            auto r = O::add(O::bitAnd(big, O::set1(QUARTER_PI)),
+                            O::add(O::mul(O::mul(p, z), t), t));
+
+            r = O::select(O::less(ax, ay), O::sub(O::set1(HALF_PI), r), r);
+            r = O::select(O::less(x, zero), O::sub(O::set1(std::numbers::pi_v<float>), r), r);
+            r = O::bitXor(r, O::bitAnd(y, O::set1(-0.0f)));
+            return O::select(O::unordered(x, y), O::add(x, y), r);
+        }
+
+        RUSH_TARGET_SSE4 inline __m128 expSSE4(__m128 x) {
+            using O = simd::SSE4<float>;
+            auto clamped = O::min(O::max(x, O::set1(EXP_MIN)), O::set1(EXP_MAX));
+            auto k = O::roundToInt(O::mul(clamped, O::set1(LOG2E)));
+            auto n = O::toFloat(k);
+            auto r = O::sub(O::sub(clamped, O::mul(n, O::set1(LN2_HIGH))),
+                            O::mul(n, O::set1(LN2_LOW)));
+
+            auto p = O::set1(EXP_COEFFICIENTS[5]);
+            for (size_t i = 5; i-- > 0;) {
+                p = O::fmadd(p, r, O::set1(EXP_COEFFICIENTS[i]));
+            }
+            p = O::add(O::add(O::mul(O::mul(p, r), r), r), O::set1(1.0f));
+
+            auto scale = O::asFloat(O::shiftLeftInt<23>(O::addInt(k, O::set1Int(127))));
+            auto result = O::mul(p, scale);
+            result = O::select(O::less(x, O::set1(EXP_MIN)), O::zero(), result);
+            result = O::select(O::less(O::set1(EXP_MAX), x), O::set1(INF), result);
+            return O::select(O::unordered(x, x), x, result);
+        }
+
+        RUSH_TARGET_SSE4 inline __m128 logSSE4(__m128 x) {
+            using O = simd::SSE4<float>;
+            auto one = O::set1(1.0f);
+            auto bits = O::asInt(x);
+            auto e = O::toFloat(O::subInt(O::shiftRightInt<23>(bits), O::set1Int(126)));
+            auto m = O::bitOr(O::bitAnd(x, O::asFloat(O::set1Int(0x007FFFFF))), O::set1(0.5f));
+
+            auto small = O::less(m, O::set1(SQRT_HALF));
+            e = O::sub(e, O::bitAnd(small, one));
+            m = O::add(O::sub(m, one), O::bitAnd(small, m));
+
+            auto z = O::mul(m, m);
+            auto p = O::set1(LOG_COEFFICIENTS[8]);
+            for (size_t i = 8; i-- > 0;) {
+                p = O::fmadd(p, m, O::set1(LOG_COEFFICIENTS[i]));
+            }
+            auto y = O::mul(O::mul(p, m), z);
+            y = O::add(y, O::mul(e, O::set1(LN2_LOW)));
+            y = O::sub(y, O::mul(z, O::set1(0.5f)));
+            auto result = O::add(O::add(m, y), O::mul(e, O::set1(LN2_HIGH)));
+
+            auto zero = O::zero();
+            result = O::select(O::less(x, O::set1(std::numeric_limits<float>::min())),
+                               O::set1(-INF), result);
+            result = O::select(O::equal(x, O::set1(INF)), x, result);
+            return O::select(O::bitOr(O::less(x, zero), O::unordered(x, x)),
+                             O::set1(NaN), result);
+        }
+
+        RUSH_TARGET_SSE4 inline __m128 powSSE4(__m128 x, __m128 y) {
+            using O = simd::SSE4<float>;
+            auto result = expSSE4(O::mul(y, logSSE4(x)));
+            return O::select(O::equal(y, O::zero()), O::set1(1.0f), result);
+        }
+
+        template<Function F, simd::Broadcast B>
+        RUSH_TARGET_SSE4 inline void stepSSE4(const float* a, const float* b,
+                                              float* out, float* out2) {
+            using O = simd::SSE4<float>;
+            auto x = O::load(a);
+            if constexpr (F == Function::Sin || F == Function::Cos || F == Function::SinCos) {
+                O::Reg s, c;
+                sincosSSE4(x, s, c);
+                O::store(out, F == Function::Cos ? c : s);
+                if constexpr (F == Function::SinCos) O::store(out2, c);
+
+                auto absolute = O::bitAnd(x, O::asFloat(O::set1Int(0x7FFFFFFF)));
+                int fallback = O::signMask(O::bitOr(O::less(O::set1(MAX_TRIG_ARGUMENT), absolute),
+                                                    O::unordered(x, x)));
+                for (size_t l = 0; fallback != 0; ++l, fallback >>= 1) {
+                    if ((fallback & 1) == 0) continue;
+                    if constexpr (F == Function::Cos) {
+                        out[l] = std::cos(a[l]);
+                    } else {
+                        out[l] = std::sin(a[l]);
+                    }
+                    if constexpr (F == Function::SinCos) out2[l] = std::cos(a[l]);
+                }
+            } else if constexpr (F == Function::Exp) {
+                O::store(out, expSSE4(x));
+            } else if constexpr (F == Function::Log) {
+                O::store(out, logSSE4(x));
+            } else {
+                auto y = B == simd::Broadcast::Right ? O::set1(*b) : O::load(b);
+                if constexpr (F == Function::Atan2) O::store(out, atan2SSE4(x, y));
+                if constexpr (F == Function::Pow) O::store(out, powSSE4(x, y));
+            }
+        }
+
+        // ENDREGION
+
+        // REGION AVX2
+
+        RUSH_TARGET_AVX2 inline void sincosAVX2(__m256 x, __m256& s, __m256& c) {
+            using O = simd::AVX2<float>;
+            auto q = O::roundToInt(O::mul(x, O::set1(TWO_OVER_PI)));
+            auto j = O::toFloat(q);
+            auto r = O::sub(O::sub(O::sub(x, O::mul(j, O::set1(HALF_PI_HIGH))),
+                                   O::mul(j, O::set1(HALF_PI_MID))),
+                            O::mul(j, O::set1(HALF_PI_LOW)));
+            auto z = O::mul(r, r);
+
+            auto ps = O::set1(SIN_COEFFICIENTS[2]);
+            ps = O::fmadd(ps, z, O::set1(SIN_COEFFICIENTS[1]));
+            ps = O::fmadd(ps, z, O::set1(SIN_COEFFICIENTS[0]));
+            ps = O::add(r, O::mul(O::mul(r, z), ps));
+
+            auto pc = O::set1(COS_COEFFICIENTS[2]);
+            pc = O::fmadd(pc, z, O::set1(COS_COEFFICIENTS[1]));
+            pc = O::fmadd(pc, z, O::set1(COS_COEFFICIENTS[0]));
+            pc = O::add(O::sub(O::set1(1.0f), O::mul(z, O::set1(0.5f))),
+                        O::mul(O::mul(z, z), pc));
+
+            // select() only checks the sign bit of the mask.
+            auto odd = O::asFloat(O::shiftLeftInt<31>(q));
+            auto two = O::set1Int(2);
+            auto sinSign = O::asFloat(O::shiftLeftInt<30>(O::andInt(q, two)));
+            auto cosSign = O::asFloat(O::shiftLeftInt<30>(O::andInt(O::addInt(q, O::set1Int(1)), two)));
+
+            s = O::bitXor(O::select(odd, pc, ps), sinSign);
+            c = O::bitXor(O::select(odd, ps, pc), cosSign);
+        }
+
+        RUSH_TARGET_AVX2 inline __m256 atan2AVX2(__m256 y, __m256 x) {
+            using O = simd::AVX2<float>;
+            auto absMask = O::asFloat(O::set1Int(0x7FFFFFFF));
+            auto zero = O::zero();
+            auto one = O::set1(1.0f);
+
+            auto ax = O::bitAnd(x, absMask);
+            auto ay = O::bitAnd(y, absMask);
+            auto mx = O::max(ax, ay);
+            auto a = O::select(O::equal(mx, zero), zero, O::div(O::min(ax, ay), mx));
+
+            auto big = O::less(O::set1(TAN_PI_8), a);
+            auto t = O::select(big, O::div(O::sub(a, one), O::add(a, one)), a);
+            auto z = O::mul(t, t);
+
+            auto p = O::set1(ATAN_COEFFICIENTS[3]);
+            p = O::fmadd(p, z, O::set1(ATAN_COEFFICIENTS[2]));
+            p = O::fmadd(p, z, O::set1(ATAN_COEFFICIENTS[1]));
+            p = O::fmadd(p, z, O::set1(ATAN_COEFFICIENTS[0]));
+            auto r = O::add(O::bitAnd(big, O::set1(QUARTER_PI)),
+                            O::add(O::mul(O::mul(p, z), t), t));
+
+            r = O::select(O::less(ax, ay), O::sub(O::set1(HALF_PI), r), r);
+            r = O::select(O::less(x, zero), O::sub(O::set1(std::numbers::pi_v<float>), r), r);
+            r = O::bitXor(r, O::bitAnd(y, O::set1(-0.0f)));
+            return O::select(O::unordered(x, y), O::add(x, y), r);
+        }
+
+        RUSH_TARGET_AVX2 inline __m256 expAVX2(__m256 x) {
+            using O = simd::AVX2<float>;
+            auto clamped = O::min(O::max(x, O::set1(EXP_MIN)), O::set1(EXP_MAX));
+            auto k = O::roundToInt(O::mul(clamped, O::set1(LOG2E)));
+            auto n = O::toFloat(k);
+            auto r = O::sub(O::sub(clamped, O::mul(n, O::set1(LN2_HIGH))),
+                            O::mul(n, O::set1(LN2_LOW)));
+
+            auto p = O::set1(EXP_COEFFICIENTS[5]);
+            for (size_t i = 5; i-- > 0;) {
+                p = O::fmadd(p, r, O::set1(EXP_COEFFICIENTS[i]));
+            }
+            p = O::add(O::add(O::mul(O::mul(p, r), r), r), O::set1(1.0f));
+
+            auto scale = O::asFloat(O::shiftLeftInt<23>(O::addInt(k, O::set1Int(127))));
+            auto result = O::mul(p, scale);
+            result = O::select(O::less(x, O::set1(EXP_MIN)), O::zero(), result);
+            result = O::select(O::less(O::set1(EXP_MAX), x), O::set1(INF), result);
+            return O::select(O::unordered(x, x), x, result);
+        }
+
+        RUSH_TARGET_AVX2 inline __m256 logAVX2(__m256 x) {
+            using O = simd::AVX2<float>;
+            auto one = O::set1(1.0f);
+            auto bits = O::asInt(x);
+            auto e = O::toFloat(O::subInt(O::shiftRightInt<23>(bits), O::set1Int(126)));
+            auto m = O::bitOr(O::bitAnd(x, O::asFloat(O::set1Int(0x007FFFFF))), O::set1(0.5f));
+
+            auto small = O::less(m, O::set1(SQRT_HALF));
+            e = O::sub(e, O::bitAnd(small, one));
+            m = O::add(O::sub(m, one), O::bitAnd(small, m));
+
+            auto z = O::mul(m, m);
+            auto p = O::set1(LOG_COEFFICIENTS[8]);
+            for (size_t i = 8; i-- > 0;) {
+                p = O::fmadd(p, m, O::set1(LOG_COEFFICIENTS[i]));
+            }
+            auto y = O::mul(O::mul(p, m), z);
+            y = O::add(y, O::mul(e, O::set1(LN2_LOW)));
+            y = O::sub(y, O::mul(z, O::set1(0.5f)));
+            auto result = O::add(O::add(m, y), O::mul(e, O::set1(LN2_HIGH)));
+
+            auto zero = O::zero();
+            result = O::select(O::less(x, O::set1(std::numeric_limits<float>::min())),
+                               O::set1(-INF), result);
+            result = O::select(O::equal(x, O::set1(INF)), x, result);
+            return O::select(O::bitOr(O::less(x, zero), O::unordered(x, x)),
+                             O::set1(NaN), result);
+        }
+
+        RUSH_TARGET_AVX2 inline __m256 powAVX2(__m256 x, __m256 y) {
+            using O = simd::AVX2<float>;
+            auto result = expAVX2(O::mul(y, logAVX2(x)));
+            return O::select(O::equal(y, O::zero()), O::set1(1.0f), result);
+        }
+
+        template<Function F, simd::Broadcast B>
+        RUSH_TARGET_AVX2 inline void stepAVX2(const float* a, const float* b,
+                                              float* out, float* out2) {
+            using O = simd::AVX2<float>;
+            auto x = O::load(a);
+            if constexpr (F == Function::Sin || F == Function::Cos || F == Function::SinCos) {
+                O::Reg s, c;
+                sincosAVX2(x, s, c);
+                O::store(out, F == Function::Cos ? c : s);
+                if constexpr (F == Function::SinCos) O::store(out2, c);
+
+                auto absolute = O::bitAnd(x, O::asFloat(O::set1Int(0x7FFFFFFF)));
+                int fallback = O::signMask(O::bitOr(O::less(O::set1(MAX_TRIG_ARGUMENT), absolute),
+                                                    O::unordered(x, x)));
+                for (size_t l = 0; fallback != 0; ++l, fallback >>= 1) {
+                    if ((fallback & 1) == 0) continue;
+                    if constexpr (F == Function::Cos) {
+                        out[l] = std::cos(a[l]);
+                    } else {
+                        out[l] = std::sin(a[l]);
+                    }
+                    if constexpr (F == Function::SinCos) out2[l] = std::cos(a[l]);
+                }
+            } else if constexpr (F == Function::Exp) {
+                O::store(out, expAVX2(x));
+            } else if constexpr (F == Function::Log) {
+                O::store(out, logAVX2(x));
+            } else {
+                auto y = B == simd::Broadcast::Right ? O::set1(*b) : O::load(b);
+                if constexpr (F == Function::Atan2) O::store(out, atan2AVX2(x, y));
+                if constexpr (F == Function::Pow) O::store(out, powAVX2(x, y));
+            }
+        }
+
+        // ENDREGION
+
+        /**
+         * Applies the step to all full registers, then copies the
+         * remaining elements into zero-padded buffers, so the tail
+         * uses the same kernel as the rest of the array.
+         */
+        template<size_t Lanes, Function F, simd::Broadcast B, typename Step>
+        inline void bulkLoop(const float* a, const float* b,
+                             float* out, float* out2, size_t n, Step step) {
+            constexpr bool Binary = F == Function::Atan2 || F == Function::Pow;
+            constexpr bool BroadcastB = B == simd::Broadcast::Right;
+
+            size_t i = 0;
+            for (; i + Lanes <= n; i += Lanes) {
+                step(a + i, BroadcastB ? b : b + i, out + i, out2 + i);
+            }
+            if (i == n) return;
+
+            float ta[Lanes] = {}, tb[Lanes] = {}, to[Lanes], to2[Lanes];
+            for (size_t l = 0; l < n - i; ++l) {
+                ta[l] = a[i + l];
+                if constexpr (Binary && !BroadcastB) tb[l] = b[i + l];
+            }
+            step(ta, BroadcastB ? b : tb, to, to2);
+            for (size_t l = 0; l < n - i; ++l) {
+                out[i + l] = to[l];
+                if constexpr (F == Function::SinCos) out2[i + l] = to2[l];
+            }
+        }
+
+        template<Function F, simd::Broadcast B>
+        RUSH_TARGET_SSE4 inline void bulkSSE4(const float* a, const float* b,
+                                              float* out, float* out2, size_t n) {
+            bulkLoop<simd::SSE4<float>::Lanes, F, B>(
+                a, b, out, out2, n, stepSSE4<F, B>);
+        }
+
+        template<Function F, simd::Broadcast B>
+        RUSH_TARGET_AVX2 inline void bulkAVX2(const float* a, const float* b,
+                                              float* out, float* out2, size_t n) {
+            bulkLoop<simd::AVX2<float>::Lanes, F, B>(
+                a, b, out, out2, n, stepAVX2<F, B>);
+        }
+    }
+
+    // ENDREGION
+
+#endif
+
+    namespace detail {
+        template<Function F, simd::Broadcast B>
+        inline void bulkGeneric(const float* a, const float* b,
+                                float* out, float* out2, size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                if constexpr (F == Function::Sin) out[i] = fast::sin(a[i]);
+                if constexpr (F == Function::Cos) out[i] = fast::cos(a[i]);
+                if constexpr (F == Function::SinCos) fast::sincos(a[i], out[i], out2[i]);
+                if constexpr (F == Function::Exp) out[i] = fast::exp(a[i]);
+                if constexpr (F == Function::Log) out[i] = fast::log(a[i]);
+                if constexpr (F == Function::Atan2 || F == Function::Pow) {
+                    float y = B == simd::Broadcast::Right ? b[0] : b[i];
+                    if constexpr (F == Function::Atan2) out[i] = fast::atan2(a[i], y);
+                    if constexpr (F == Function::Pow) out[i] = fast::pow(a[i], y);
+                }
+            }
+        }
+
+        template<Function F, simd::Broadcast B = simd::Broadcast::None>
+        inline void bulk(const float* a, const float* b,
+                         float* out, float* out2, size_t n) {
+#ifdef RUSH_DISPATCH
+            switch (cpu::instructionSet()) {
+                // A 512-bit kernel would only save a few instructions
+                // per register. AVX-512 CPUs use the AVX2 kernels.
+                case InstructionSet::AVX512:
+                case InstructionSet::AVX2:
+                    bulkAVX2<F, B>(a, b, out, out2, n);
+                    return;
+                case InstructionSet::SSE4:
+                    bulkSSE4<F, B>(a, b, out, out2, n);
+                    return;
+                default:
+                    break;
+            }
+#endif
+            bulkGeneric<F, B>(a, b, out, out2, n);
+        }
+    }
+
+    // REGION BULK
+
+    /**
+     * Computes the sine of every element of the given array.
+     * See sin(float) for the error bounds.
+     * <p>
+     * The kernel is selected at runtime using the
+     * instruction set returned by cpu::instructionSet().
+     * out may alias in.
+     *
+     * @param in the angles, in radians.
+     * @param out the output array.
+     * @param n the length of the arrays.
+     */
+    inline void sin(const float* in, float* out, size_t n) {
+        detail::bulk<detail::Function::Sin>(in, in, out, out, n);
+    }
+
+    /**
+     * Computes the cosine of every element of the given array.
+     * See cos(float) for the error bounds.
+     *
+     * @param in the angles, in radians.
+     * @param out the output array.
+     * @param n the length of the arrays.
+     */
+    inline void cos(const float* in, float* out, size_t n) {
+        detail::bulk<detail::Function::Cos>(in, in, out, out, n);
+    }
+
+    /**
+     * Computes the sine and cosine of every element of the given array.
+     * See sincos(float, float&, float&) for the error bounds.
+     *
+     * @param in the angles, in radians.
+     * @param sinOut the output array of the sines.
+     * @param cosOut the output array of the cosines.
+     * @param n the length of the arrays.
+     */
+    inline void sincos(const float* in, float* sinOut, float* cosOut, size_t n) {
+        detail::bulk<detail::Function::SinCos>(in, in, sinOut, cosOut, n);
+    }
+
+    /**
+     * Computes atan2(y[i], x[i]) for every element of the given arrays.
+     * See atan2(float, float) for the error bounds.
+     *
+     * @param y the y coordinates.
+     * @param x the x coordinates.
+     * @param out the output array.
+     * @param n the length of the arrays.
+     */
+    inline void atan2(const float* y, const float* x, float* out, size_t n) {
+        detail::bulk<detail::Function::Atan2>(y, x, out, out, n);
+    }
+
+    /**
+     * Computes e^x for every element of the given array.
+     * See exp(float) for the error bounds.
+     *
+     * @param in the exponents.
+     * @param out the output array.
+     * @param n the length of the arrays.
+     */
+    inline void exp(const float* in, float* out, size_t n) {
+        detail::bulk<detail::Function::Exp>(in, in, out, out, n);
+    }
+
+    /**
+     * Computes the natural logarithm of every element of the given array.
+     * See log(float) for the error bounds.
+     *
+     * @param in the values.
+     * @param out the output array.
+     * @param n the length of the arrays.
+     */
+    inline void log(const float* in, float* out, size_t n) {
+        detail::bulk<detail::Function::Log>(in, in, out, out, n);
+    }
+
+    /**
+     * Computes x[i]^y[i] for every element of the given arrays.
+     * See pow(float, float) for the error bounds.
+     *
+     * @param x the bases.
+     * @param y the exponents.
+     * @param out the output array.
+     * @param n the length of the arrays.
+     */
+    inline void pow(const float* x, const float* y, float* out, size_t n) {
+        detail::bulk<detail::Function::Pow>(x, y, out, out, n);
+    }
+
+    /**
+     * Computes x[i]^y for every element of the given array.
+     * See pow(float, float) for the error bounds.
+     *
+     * @param x the bases.
+     * @param y the exponent.
+     * @param out the output array.
+     * @param n the length of the array.
+     */
+    inline void pow(const float* x, float y, float* out, size_t n) {
+        detail::bulk<detail::Function::Pow, simd::Broadcast::Right>(x, &y, out, out, n);
+    }
+
+    // ENDREGION
+}
+
+#endif //RUSH_FAST_MATH_H
@@ -57,6 +57,24 @@ namespace rush {
          */
         [[nodiscard]] static AABB fromEdges(VectorType a, VectorType b);
     };
+
+    /**
+     * Returns the smallest AABB containing all the given points.
+     * <p>
+     * The points are read only once.
+     * See minMax(const Range&, size_t) for more information.
+     * <p>
+     * The range must not be empty.
+     *
+     * @param points a contiguous range of points (std::vector, std::span...).
+     * @param threads the maximum amount of threads to use.
+     * 0 uses all the hardware threads.
+     * @return the AABB.
+     */
+    template<detail::VecRange Range>
+    AABB<detail::VecRangeTraits<detail::VecRangeValue<Range>>::Size,
+        typename detail::VecRangeTraits<detail::VecRangeValue<Range>>::Type>
+    bounds(const Range& points, size_t threads = 1);
 }
 
 #include <rush/geometry/aabb_impl.h>
@@ -44,5 +44,15 @@ namespace rush {
         VectorType radius = center - min;
         return {center, radius};
     }
+
+    template<detail::VecRange Range>
+    AABB<detail::VecRangeTraits<detail::VecRangeValue<Range>>::Size,
+        typename detail::VecRangeTraits<detail::VecRangeValue<Range>>::Type>
+    bounds(const Range& points, size_t threads) {
+        using Result = AABB<detail::VecRangeTraits<detail::VecRangeValue<Range>>::Size,
+            typename detail::VecRangeTraits<detail::VecRangeValue<Range>>::Type>;
+        auto [min, max] = minMax(points, threads);
+        return Result::fromEdges(min, max);
+    }
 }
 #endif //AABB_IMPL_H
@@ -7,6 +7,8 @@
 
 #include <rush/geometry/tree_base.h>
 #include <rush/allocator/pool.h>
+#include <concepts>
+#include <functional>
 #include <unordered_set>
 
 
@@ -43,11 +45,10 @@ namespace rush {
             std::unordered_set<TreeContent<Storage, Bounds>>& set,
             bool skipCollisionCheck) const;
 
-        template<typename Collider>
+        template<typename Collider, typename Consumer>
         void forEachIntersection(
             const Collider& collider,
-            std::function<void(
-                const TreeContent<Storage, Bounds>&)> consumer,
+            Consumer& consumer,
             bool skipCollisionCheck) const;
 
         template<typename RAllocator>
@@ -99,11 +100,10 @@ namespace rush {
                       std::unordered_set<TreeContent<Storage, Bounds>>& set,
                       bool skipCollisionCheck) const;
 
-        template<typename Collider>
+        template<typename Collider, typename Consumer>
         void forEachIntersection(
             const Collider& collider,
-            std::function<void(
-                const TreeContent<Storage, Bounds>&)> consumer,
+            Consumer& consumer,
             bool skipCollisionCheck) const;
 
         template<typename RAllocator>
@@ -151,6 +151,22 @@ namespace rush {
             const Collider& collider,
             std::function<void(
                 const TreeContent<Storage, Bounds>&)> consumer) const;
+
+        /**
+         * Calls the given consumer for each element
+         * intersecting the given collider.
+         * <p>
+         * Unlike the std::function overload, the consumer
+         * is not type-erased, and the compiler can inline it.
+         * @param collider the collider.
+         * @param consumer the consumer.
+         */
+        template<typename Collider, typename Consumer>
+            requires std::invocable<Consumer&,
+                const TreeContent<Storage, Bounds>&>
+        void forEachIntersection(
+            const Collider& collider,
+            Consumer&& consumer) const;
     };
 }
 
@@ -70,11 +70,11 @@ namespace rush {
 
     template<typename Storage, typename Bounds,
         size_t Dimensions, typename Type>
-    template<typename Collider>
+    template<typename Collider, typename Consumer>
     void StaticTreeLeaf<Storage, Bounds, Dimensions, Type>::
     forEachIntersection(
         const Collider& collider,
-        std::function<void(const TreeContent<Storage, Bounds>&)> consumer,
+        Consumer& consumer,
         bool skipCollisionCheck) const {
         if (!skipCollisionCheck && !intersects(_aabb, collider)) return;
 
@@ -251,12 +251,12 @@ namespace rush {
     template<typename Storage, typename Bounds, size_t Dimensions, typename Type
         , size_t MaxObjects, size_t Depth>
         requires(Depth > 0)
-    template<typename Collider>
+    template<typename Collider, typename Consumer>
     void
     StaticTreeNode<Storage, Bounds, Dimensions, Type, MaxObjects, Depth>::
     forEachIntersection(
         const Collider& collider,
-        std::function<void(const TreeContent<Storage, Bounds>&)> consumer,
+        Consumer& consumer,
         bool skipCollisionCheck) const {
         if (!skipCollisionCheck && !intersects(_aabb, collider)) return;
 
@@ -408,6 +408,20 @@ namespace rush {
             const TreeContent<Storage, Bounds>&)> consumer) const {
         _root.forEachIntersection(collider, consumer, false);
     }
+
+    template<typename Storage, typename Bounds, size_t Dimensions,
+        typename Type, size_t MaxObjects, size_t Depth>
+        requires(Depth > 0)
+    template<typename Collider, typename Consumer>
+        requires std::invocable<Consumer&,
+            const TreeContent<Storage, Bounds>&>
+    void
+    StaticTree<Storage, Bounds, Dimensions, Type, MaxObjects, Depth>::
+    forEachIntersection(
+        const Collider& collider,
+        Consumer&& consumer) const {
+        _root.forEachIntersection(collider, consumer, false);
+    }
 }
 
 #endif //RUSH_STATIC_TREE_IMPL_H
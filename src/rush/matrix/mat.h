@@ -10,6 +10,12 @@
 
 #include <rush/matrix/mat_base.h>
 #include <rush/matrix/mat_extra.h>
+#include <rush/matrix/mat_expression.h>
+#include <rush/matrix/mat_transform.h>
+#include <rush/matrix/mat_sparse_builder.h>
+#include <rush/matrix/mat_preconditioners.h>
+#include <rush/matrix/mat_sparse_cholesky.h>
+#include <rush/matrix/mat_iterative_solvers.h>
 
 namespace rush {
     using Mat1f = rush::Mat<1, 1, float>;
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include <rush/algorithm.h>
+#include <rush/expression.h>
 #include <rush/vector/vec.h>
 #include <rush/matrix/mat_dense_rep.h>
 
@@ -22,6 +23,20 @@ namespace rush {
     template<typename Type>
     struct Quat;
 
+    template<size_t Columns, size_t Rows, typename Type,
+        typename Representation, typename Allocator>
+    struct Mat;
+
+    namespace detail {
+        template<typename T>
+        constexpr bool IsMat = false;
+
+        template<size_t Columns, size_t Rows, typename Type,
+            typename Representation, typename Allocator>
+        constexpr bool IsMat<Mat<Columns, Rows, Type,
+            Representation, Allocator>> = true;
+    }
+
     template<size_t Columns, size_t Rows, typename Type,
         typename Representation = MatDenseRep,
         typename Allocator = StaticAllocator>
@@ -39,63 +54,107 @@ namespace rush {
         template<typename... T>
             requires (std::is_convertible_v<std::common_type_t<T...>, Type>
                       && sizeof...(T) <= Columns * Rows && sizeof...(T) > 1)
-        Mat(T... list);
+        constexpr Mat(T... list);
 
-        Mat();
+        constexpr Mat();
 
-        explicit Mat(Type diagonal);
+        constexpr explicit Mat(Type diagonal);
 
         explicit Mat(std::function<Type(size_t, size_t)> populator);
 
         explicit Mat(std::function<Type(size_t, size_t, size_t, size_t)> populator);
 
+        /**
+         * Creates a new matrix using the given population
+         * function to fill the matrix.
+         * The function will be called for each element,
+         * giving each time its column and row.
+         * <p>
+         * Unlike the std::function overload, the call to the
+         * function can be inlined by the compiler.
+         * Matrices are never used as population functions,
+         * even though they can be called.
+         * @param populator the population function.
+         */
+        template<typename Populator>
+            requires (std::is_invocable_r_v<Type, Populator&, size_t, size_t>
+                      && !detail::IsMat<std::remove_cvref_t<Populator>>)
+        constexpr explicit Mat(Populator&& populator);
+
+        /**
+         * Creates a new matrix using the given population
+         * function to fill the matrix.
+         * The function will be called for each element,
+         * giving each time its column and row,
+         * followed by the amount of columns and rows of the matrix.
+         * <p>
+         * Unlike the std::function overload, the call to the
+         * function can be inlined by the compiler.
+         * @param populator the population function.
+         */
+        template<typename Populator>
+            requires std::is_invocable_r_v<Type, Populator&,
+                size_t, size_t, size_t, size_t>
+        constexpr explicit Mat(Populator&& populator);
+
+        /**
+         * Creates a new matrix evaluating the given lazy expression.
+         * <p>
+         * The whole expression is evaluated in a single loop,
+         * without creating intermediate matrices.
+         * See rush::lazy().
+         * @param expression the expression.
+         */
+        template<typename E> requires ExpressionOf<E, MatShape<Columns, Rows>, Type>
+        constexpr Mat(const E& expression);
+
         template<size_t OColumns, size_t ORows, typename ORep, typename OAlloc>
             requires(Columns > OColumns || Rows > ORows)
-        Mat(const Mat<OColumns, ORows, Type, ORep, OAlloc>& other, Type diagonal);
+        constexpr Mat(const Mat<OColumns, ORows, Type, ORep, OAlloc>& other, Type diagonal);
 
         template<typename ORep, typename OAlloc>
-        Mat(const Mat<Columns, Rows, Type, ORep, OAlloc>& other);
+        constexpr Mat(const Mat<Columns, Rows, Type, ORep, OAlloc>& other);
 
         [[nodiscard]] constexpr size_t size() const;
 
-        const Type* toPointer() const requires Representation::PinnedMemory;
+        constexpr const Type* toPointer() const requires Representation::PinnedMemory;
 
-        Type* toPointer() requires Representation::PinnedMemory;
+        constexpr Type* toPointer() requires Representation::PinnedMemory;
 
         // REGION ACCESSORS
 
-        typename Rep::ColumnRef column(size_t column) requires Representation::PinnedMemory;
+        constexpr typename Rep::ColumnRef column(size_t column) requires Representation::PinnedMemory;
 
-        typename Rep::ColumnType column(size_t column) const;
+        constexpr typename Rep::ColumnType column(size_t column) const;
 
-        typename Rep::RowRef row(size_t row) requires Representation::PinnedMemory;
+        constexpr typename Rep::RowRef row(size_t row) requires Representation::PinnedMemory;
 
-        typename Rep::RowType row(size_t row) const;
+        constexpr typename Rep::RowType row(size_t row) const;
 
-        typename Rep::ColumnRef operator[](size_t column) requires Representation::PinnedMemory;
+        constexpr typename Rep::ColumnRef operator[](size_t column) requires Representation::PinnedMemory;
 
-        typename Rep::ColumnType operator[](size_t column) const;
+        constexpr typename Rep::ColumnType operator[](size_t column) const;
 
-        Type& operator()(size_t column, size_t row) requires Representation::PinnedMemory;
+        constexpr Type& operator()(size_t column, size_t row) requires Representation::PinnedMemory;
 
-        const Type& operator()(size_t column, size_t row) const;
+        constexpr const Type& operator()(size_t column, size_t row) const;
 
-        void pushValue(size_t column, size_t row, const Type& value);
+        constexpr void pushValue(size_t column, size_t row, const Type& value);
 
         // REGION OPERATORS
 
         // UNARY
 
-        Type determinant() const requires HasAdd<Type> &&
+        constexpr Type determinant() const requires HasAdd<Type> &&
                                           HasSub<Type> &&
                                           HasMul<Type> &&
                                           HasDiv<Type> &&
                                           (Columns == Rows);
 
-        Mat<Rows, Columns, Type, Representation, Allocator>
+        constexpr Mat<Rows, Columns, Type, Representation, Allocator>
         transpose() const;
 
-        Self inverse() const requires HasAdd<Type> &&
+        constexpr Self inverse() const requires HasAdd<Type> &&
                                       HasSub<Type> &&
                                       HasMul<Type> &&
                                       HasDiv<Type> &&
@@ -118,128 +177,139 @@ namespace rush {
         Vec<Rows, Type> solveLu(const Vec<Rows, Type>& r);
 
         template<typename To, typename ORep, typename OAlloc = Allocator>
-        Mat<Columns, Rows, To, ORep, OAlloc> cast() const;
+        constexpr Mat<Columns, Rows, To, ORep, OAlloc> cast() const;
 
-        Self& operator+();
+        constexpr Self& operator+();
 
-        Self& operator+() const;
+        constexpr Self& operator+() const;
 
-        Self operator-() const requires HasSub<Type>;
+        constexpr Self operator-() const requires HasSub<Type>;
 
 
         // ASSIGN MATRIX - SCALE
 
-        Self& operator+=(const Type& s) requires HasAdd<Type>;
+        constexpr Self& operator+=(const Type& s) requires HasAdd<Type>;
+
+        constexpr Self& operator-=(const Type& s) requires HasSub<Type>;
 
-        Self& operator-=(const Type& s) requires HasSub<Type>;
+        constexpr Self& operator*=(const Type& s) requires HasMul<Type>;
 
-        Self& operator*=(const Type& s) requires HasMul<Type>;
+        constexpr Self& operator/=(const Type& s) requires HasDiv<Type>;
 
-        Self& operator/=(const Type& s) requires HasDiv<Type>;
+        constexpr Self& operator<<=(const Type& s) requires HasShl<Type>;
 
-        Self& operator<<=(const Type& s) requires HasShl<Type>;
+        constexpr Self& operator>>=(const Type& s) requires HasShr<Type>;
 
-        Self& operator>>=(const Type& s) requires HasShr<Type>;
+        constexpr Self& operator&=(const Type& s) requires HasBitAnd<Type>;
 
-        Self& operator&=(const Type& s) requires HasBitAnd<Type>;
+        constexpr Self& operator|=(const Type& s) requires HasBitOr<Type>;
 
-        Self& operator|=(const Type& s) requires HasBitOr<Type>;
+        constexpr Self& operator^=(const Type& s) requires HasBitXor<Type>;
 
-        Self& operator^=(const Type& s) requires HasBitXor<Type>;
+        // ASSIGN MATRIX - EXPRESSION
+
+        template<typename E> requires ExpressionOf<E, MatShape<Columns, Rows>, Type>
+        constexpr Self& operator=(const E& expression) requires Representation::PinnedMemory;
+
+        template<typename E> requires ExpressionOf<E, MatShape<Columns, Rows>, Type>
+        constexpr Self& operator+=(const E& expression) requires (Representation::PinnedMemory && HasAdd<Type>);
+
+        template<typename E> requires ExpressionOf<E, MatShape<Columns, Rows>, Type>
+        constexpr Self& operator-=(const E& expression) requires (Representation::PinnedMemory && HasSub<Type>);
 
         // ASSIGN VECTOR - VECTOR
 
         template<typename OAlloc>
-        Mat& operator+=(
+        constexpr Mat& operator+=(
             const Mat<Columns, Rows, Type, OAlloc>& o) requires HasAdd<Type>;
 
         template<typename OAlloc>
-        Mat& operator-=(
+        constexpr Mat& operator-=(
             const Mat<Columns, Rows, Type, OAlloc>& o) requires HasSub<Type>;
 
         // MATRIX - SCALE
 
-        Self operator+(const Type& s) const requires HasAdd<Type>;
+        constexpr Self operator+(const Type& s) const requires HasAdd<Type>;
 
-        Self operator-(const Type& s) const requires HasSub<Type>;
+        constexpr Self operator-(const Type& s) const requires HasSub<Type>;
 
-        Self operator*(const Type& s) const requires HasMul<Type>;
+        constexpr Self operator*(const Type& s) const requires HasMul<Type>;
 
-        Self operator/(const Type& s) const requires HasDiv<Type>;
+        constexpr Self operator/(const Type& s) const requires HasDiv<Type>;
 
-        Self operator<<(const Type& s) const requires HasShl<Type>;
+        constexpr Self operator<<(const Type& s) const requires HasShl<Type>;
 
-        Self operator>>(const Type& s) const requires HasShr<Type>;
+        constexpr Self operator>>(const Type& s) const requires HasShr<Type>;
 
-        Self operator&(const Type& s) const requires HasBitAnd<Type>;
+        constexpr Self operator&(const Type& s) const requires HasBitAnd<Type>;
 
-        Self operator|(const Type& s) const requires HasBitOr<Type>;
+        constexpr Self operator|(const Type& s) const requires HasBitOr<Type>;
 
-        Self operator^(const Type& s) const requires HasBitXor<Type>;
+        constexpr Self operator^(const Type& s) const requires HasBitXor<Type>;
 
-        Self operator&&(const Type& s) const requires HasAnd<Type>;
+        constexpr Self operator&&(const Type& s) const requires HasAnd<Type>;
 
-        Self operator||(const Type& s) const requires HasOr<Type>;
+        constexpr Self operator||(const Type& s) const requires HasOr<Type>;
 
         // MATRIX - VECTOR
 
         template<typename OAlloc = Allocator>
-        Vec<Columns, Type, Allocator>
+        constexpr Vec<Rows, Type, Allocator>
         operator*(const Vec<Columns, Type, OAlloc>& other) const requires
             (HasAdd<Type> && HasMul<Type>);
 
         // MATRIX - MATRIX
 
         template<typename ORep, typename OAlloc>
-        Mat operator+(
+        constexpr Mat operator+(
             const Mat<Columns, Rows, Type, ORep, OAlloc>& other)
         const requires HasAdd<Type>;
 
         template<typename ORep, typename OAlloc>
-        Mat operator-(
+        constexpr Mat operator-(
             const Mat<Columns, Rows, Type, ORep, OAlloc>& other)
         const requires HasSub<Type>;
 
         template<size_t OC, size_t OR,
             typename ORep = MatDenseRep,
             typename OAlloc = Allocator>
-        Mat<OC, Rows, Type, Representation, Allocator>
+        constexpr Mat<OC, Rows, Type, Representation, Allocator>
         operator*(const Mat<OC, OR, Type, ORep, OAlloc>& other) const
             requires(Columns == OR && HasAdd<Type> && HasMul<Type>);
 
         template<typename ORep, typename OAlloc>
-        bool operator==(const Mat<Columns, Rows, Type, ORep, OAlloc>& other) const;
+        constexpr bool operator==(const Mat<Columns, Rows, Type, ORep, OAlloc>& other) const;
 
         template<typename ORep, typename OAlloc>
-        bool operator!=(const Mat<Columns, Rows, Type, ORep, OAlloc>& other) const;
+        constexpr bool operator!=(const Mat<Columns, Rows, Type, ORep, OAlloc>& other) const;
 
         // ENDREGION
 
         // REGION ITERATOR
 
-        auto begin();
+        constexpr auto begin();
 
-        auto end();
+        constexpr auto end();
 
-        auto cbegin() const;
+        constexpr auto cbegin() const;
 
-        auto cend() const;
+        constexpr auto cend() const;
 
-        auto rbegin();
+        constexpr auto rbegin();
 
-        auto rend();
+        constexpr auto rend();
 
-        auto crbegin() const;
+        constexpr auto crbegin() const;
 
-        auto crend() const;
+        constexpr auto crend() const;
 
-        auto sparseBegin() const;
+        constexpr auto sparseBegin() const;
 
-        auto sparseEnd() const;
+        constexpr auto sparseEnd() const;
 
-        auto reverseSparseBegin() const;
+        constexpr auto reverseSparseBegin() const;
 
-        auto reverseSparseEnd() const;
+        constexpr auto reverseSparseEnd() const;
 
         // ENDREGION
 
@@ -251,7 +321,7 @@ namespace rush {
          * @param t the amount of units.
          * @return the translation matrix.
          */
-        static Mat
+        static constexpr Mat
         translate(const Vec<3, Type>& t) requires (Columns == 4 && Rows == 4);
 
         /**
@@ -260,7 +330,7 @@ namespace rush {
          * @param s the given mount of units.
          * @return the scale matrix.
          */
-        static Mat scale(const Vec<3, Type>& s) requires (Columns == 4 && Rows == 4);
+        static constexpr Mat scale(const Vec<3, Type>& s) requires (Columns == 4 && Rows == 4);
 
         /**
          * Creates a rotation matrix that rotates
@@ -269,7 +339,7 @@ namespace rush {
          * @param radians the angle.
          * @return the rotation matrix.
          */
-        static Mat rotationX(Type radians) requires (Columns == 4 && Rows == 4);
+        static constexpr Mat rotationX(Type radians) requires (Columns == 4 && Rows == 4);
 
         /**
          * Creates a rotation matrix that rotates
@@ -278,7 +348,7 @@ namespace rush {
          * @param radians the angle.
          * @return the rotation matrix.
          */
-        static Mat rotationY(Type radians) requires (Columns == 4 && Rows == 4);
+        static constexpr Mat rotationY(Type radians) requires (Columns == 4 && Rows == 4);
 
         /**
          * Creates a rotation matrix that rotates
@@ -287,7 +357,7 @@ namespace rush {
          * @param radians the angle.
          * @return the rotation matrix.
          */
-        static Mat rotationZ(Type radians) requires (Columns == 4 && Rows == 4);
+        static constexpr Mat rotationZ(Type radians) requires (Columns == 4 && Rows == 4);
 
         /**
          * Creates a model matrix that transforms points
@@ -297,7 +367,7 @@ namespace rush {
          * @param t the translation.
          * @return the model matrix.
          */
-        static Mat model(const Vec<3, Type>& s, const Quat<Type>& r, const Vec<3, Type>& t)
+        static constexpr Mat model(const Vec<3, Type>& s, const Quat<Type>& r, const Vec<3, Type>& t)
             requires (Columns == 4 && Rows == 4);
 
         /**
@@ -307,7 +377,7 @@ namespace rush {
          * @param r the rotation.
          * @return the model matrix.
          */
-        static Mat normal(const Vec<3, Type>& s, const Quat<Type>& r) requires (Columns == 4 && Rows == 4);
+        static constexpr Mat normal(const Vec<3, Type>& s, const Quat<Type>& r) requires (Columns == 4 && Rows == 4);
 
         /**
          * Creates a view matrix for a camera that at
@@ -320,25 +390,25 @@ namespace rush {
          * @return the view matrix.
          */
         template<Hand Hand = Hand::Right>
-        static Mat lookAt(const Vec<3, Type>& origin, const Vec<3, Type>& direction, const Vec<3, Type>& up)
+        static constexpr Mat lookAt(const Vec<3, Type>& origin, const Vec<3, Type>& direction, const Vec<3, Type>& up)
             requires (Columns == 4 && Rows == 4);
 
         template<Hand Hand = Hand::Right,
             ProjectionFormat Format = ProjectionFormat::OpenGL>
-        static Mat frustum(Type left, Type right, Type bottom, Type top, Type near, Type far)
+        static constexpr Mat frustum(Type left, Type right, Type bottom, Type top, Type near, Type far)
             requires (Columns == 4 && Rows == 4);
 
         template<Hand Hand = Hand::Right,
             ProjectionFormat Format = ProjectionFormat::OpenGL>
-        static Mat orthogonal(Type left, Type right, Type bottom, Type top, Type near, Type far)
+        static constexpr Mat orthogonal(Type left, Type right, Type bottom, Type top, Type near, Type far)
             requires (Columns == 4 && Rows == 4);
 
         template<Hand Hand = Hand::Right,
             ProjectionFormat Format = ProjectionFormat::OpenGL>
-        static Mat perspective(Type fovY, Type aspectRatio, Type near, Type far) requires (Columns == 4 && Rows == 4);
+        static constexpr Mat perspective(Type fovY, Type aspectRatio, Type near, Type far) requires (Columns == 4 && Rows == 4);
 
         template<Hand Hand = Hand::Right>
-        static Mat infinitePerspective(Type fovY, Type aspectRatio, Type near) requires (Columns == 4 && Rows == 4);
+        static constexpr Mat infinitePerspective(Type fovY, Type aspectRatio, Type near) requires (Columns == 4 && Rows == 4);
 
         // ENDREGION
 
@@ -376,6 +446,27 @@ namespace rush {
 
         // ENDREGION
     };
+
+    /**
+     * Multiplies the given matrices.
+     * <p>
+     * Big dense float and double products are computed by simd::gemm(),
+     * whose work may be split across several threads.
+     * See parallelFor() for more information.
+     * Any other product is computed by Mat::operator*() in the calling thread.
+     *
+     * @param a the left matrix.
+     * @param b the right matrix.
+     * @param threads the maximum amount of threads to use.
+     * 0 uses all the hardware threads.
+     * @return the product a * b.
+     */
+    template<size_t Columns, size_t Rows, size_t OC, typename Type,
+        typename Representation, typename Allocator, typename ORep, typename OAlloc>
+    Mat<OC, Rows, Type, Representation, Allocator>
+    multiply(const Mat<Columns, Rows, Type, Representation, Allocator>& a,
+             const Mat<OC, Columns, Type, ORep, OAlloc>& b,
+             size_t threads = 1) requires (HasAdd<Type> && HasMul<Type>);
 }
 
 #include <rush/matrix/mat_impl.h>
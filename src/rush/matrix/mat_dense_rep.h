@@ -22,25 +22,25 @@ namespace rush {
             using difference_type = std::ptrdiff_t;
             using value_type = T;
 
-            SparseIterator(Rep collection, size_t index): _collection(collection), _index(index) {
+            constexpr SparseIterator(Rep collection, size_t index): _collection(collection), _index(index) {
                 if (_index < MaxValue && _collection->value(_index) == 0) {
                     this->operator++();
                 }
             }
 
-            value_type operator*() const {
+            constexpr value_type operator*() const {
                 return _collection->value(_index);
             }
 
-            [[nodiscard]] size_t row() const {
+            [[nodiscard]] constexpr size_t row() const {
                 return _index % Rows;
             }
 
-            [[nodiscard]] size_t column() const {
+            [[nodiscard]] constexpr size_t column() const {
                 return _index / Rows;
             }
 
-            void jumpToColumn(size_t column) {
+            constexpr void jumpToColumn(size_t column) {
                 _index = column * Rows;
                 if (_index < MaxValue && _collection->value(_index) == 0) {
                     this->operator++();
@@ -48,7 +48,7 @@ namespace rush {
             }
 
             // Prefix increment
-            SparseIterator& operator++() {
+            constexpr SparseIterator& operator++() {
                 do {
                     if constexpr (Reverse) {
                         --_index;
@@ -63,17 +63,17 @@ namespace rush {
             }
 
             // Postfix increment
-            SparseIterator operator++(int) {
+            constexpr SparseIterator operator++(int) {
                 SparseIterator tmp = *this;
                 ++*this;
                 return tmp;
             }
 
-            bool operator==(const SparseIterator& b) const {
+            constexpr bool operator==(const SparseIterator& b) const {
                 return _collection == b._collection && _index == b._index;
             };
 
-            bool operator!=(const SparseIterator& b) const {
+            constexpr bool operator!=(const SparseIterator& b) const {
                 return _collection != b._collection || _index != b._index;
             };
         };
@@ -92,23 +92,23 @@ namespace rush {
 
             Data data;
 
-            Type& value(size_t column, size_t row) {
+            constexpr Type& value(size_t column, size_t row) {
                 return data[column][row];
             }
 
-            const Type& value(size_t column, size_t row) const {
+            constexpr const Type& value(size_t column, size_t row) const {
                 return data[column][row];
             }
 
-            const Type& value(size_t index) const {
+            constexpr const Type& value(size_t index) const {
                 return data[index / Rows][index % Rows];
             }
 
-            void pushValue(size_t column, size_t row, const Type& value) {
+            constexpr void pushValue(size_t column, size_t row, const Type& value) {
                 data[column][row] = value;
             }
 
-            RowRef rowRef(size_t row) {
+            constexpr RowRef rowRef(size_t row) {
                 VecRef<Columns, Type> vec;
                 for (size_t i = 0; i < Columns; ++i) {
                     vec.references[i] = &data[i][row];
@@ -116,7 +116,7 @@ namespace rush {
                 return vec;
             }
 
-            RowType row(size_t row) const {
+            constexpr RowType row(size_t row) const {
                 Vec<Columns, Type> vec;
                 for (size_t i = 0; i < Columns; ++i) {
                     vec[i] = data[i][row];
@@ -124,75 +124,75 @@ namespace rush {
                 return vec;
             }
 
-            ColumnRef columnRef(size_t column) {
+            constexpr ColumnRef columnRef(size_t column) {
                 return data[column];
             }
 
-            ColumnType column(size_t column) const {
+            constexpr ColumnType column(size_t column) const {
                 return data[column];
             }
 
-            Type* toPointer() {
+            constexpr Type* toPointer() {
                 return data[0].toPointer();
             }
 
-            const Type* toPointer() const {
+            constexpr const Type* toPointer() const {
                 return data[0].toPointer();
             }
 
             // REGION ITERATOR
 
-            auto begin() {
+            constexpr auto begin() {
                 return data.begin();
             }
 
-            auto end() {
+            constexpr auto end() {
                 return data.end();
             }
 
-            auto cbegin() const {
+            constexpr auto cbegin() const {
                 return data.cbegin();
             }
 
-            auto cend() const {
+            constexpr auto cend() const {
                 return data.cend();
             }
 
-            auto rbegin() {
+            constexpr auto rbegin() {
                 return data.rbegin();
             }
 
-            auto rend() {
+            constexpr auto rend() {
                 return data.rend();
             }
 
-            auto crbegin() const {
+            constexpr auto crbegin() const {
                 return data.crbegin();
             }
 
-            auto crend() const {
+            constexpr auto crend() const {
                 return data.cbegin();
             }
 
-            auto sparseBegin() const {
+            constexpr auto sparseBegin() const {
                 return SparseIterator<const Representation*, Type, Rows, Columns * Rows, false>(
                     this, 0
                 );
             }
 
-            auto sparseEnd() const {
+            constexpr auto sparseEnd() const {
                 return SparseIterator<const Representation*, Type, Rows, Columns * Rows, false>(
                     this, std::numeric_limits<size_t>::max()
                 );
             }
 
-            auto reverseSparseBegin() const {
+            constexpr auto reverseSparseBegin() const {
                 return SparseIterator<const Representation*, Type, Rows, Columns * Rows, true>(
                     this, Columns * Rows - 1
                 );
             }
 
-            auto reverseSparseEnd() const {
+            constexpr auto reverseSparseEnd() const {
                 return SparseIterator<const Representation*, Type, Rows, Columns * Rows, true>(
                     this, std::numeric_limits<size_t>::max()
                 );
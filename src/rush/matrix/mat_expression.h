@@ -0,0 +1,52 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_MAT_EXPRESSION_H
+#define RUSH_MAT_EXPRESSION_H
+
+#include <rush/expression.h>
+#include <rush/matrix/mat_base.h>
+
+namespace rush {
+    template<size_t Columns, size_t Rows, typename Type, typename Allocator>
+    struct ExpressionOperand<Mat<Columns, Rows, Type, MatDenseRep, Allocator>> {
+        static constexpr bool IS_OPERAND = true;
+        using Shape = MatShape<Columns, Rows>;
+        using ValueType = Type;
+
+        static ExpressionLeaf<Shape, Type> wrap(
+            const Mat<Columns, Rows, Type, MatDenseRep, Allocator>& m) {
+            return {m.toPointer()};
+        }
+    };
+
+    /**
+     * Starts a lazy expression with the given dense matrix.
+     * <p>
+     * Operations involving the returned expression are not
+     * evaluated until they are assigned to a matrix:
+     * <pre>
+     * Mat4f r = rush::lazy(a) + rush::lazy(b) * 2.0f - c;
+     * </pre>
+     * evaluates the three operations in a single loop and
+     * creates no intermediate matrices.
+     * <p>
+     * Operators bind as usual, so subexpressions without a lazy operand
+     * are evaluated eagerly: in rush::lazy(a) + b * 2.0f,
+     * b * 2.0f creates an intermediate matrix.
+     * <p>
+     * Only element-wise operations are lazy: matrices can be
+     * multiplied or divided by scalars, but not by other matrices.
+     *
+     * @param m the matrix.
+     * @return the expression.
+     */
+    template<size_t Columns, size_t Rows, typename Type, typename Allocator>
+    ExpressionLeaf<MatShape<Columns, Rows>, Type>
+    lazy(const Mat<Columns, Rows, Type, MatDenseRep, Allocator>& m) {
+        return {m.toPointer()};
+    }
+}
+
+#endif //RUSH_MAT_EXPRESSION_H
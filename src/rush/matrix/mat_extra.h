@@ -44,7 +44,7 @@ struct std::hash<rush::Mat<C, R, Type, Representation, Allocator>> {
 
 template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     requires rush::HasAdd<Type>
-inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator+(
+constexpr rush::Mat<Columns, Rows, Type, Representation, Allocator> operator+(
     const Type& s,
     const rush::Mat<Columns, Rows, Type, Representation, Allocator>& m) {
     rush::Mat<Columns, Rows, Type, Representation, Allocator> result;
@@ -56,7 +56,7 @@ inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator+(
 
 template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     requires rush::HasSub<Type>
-inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator-(
+constexpr rush::Mat<Columns, Rows, Type, Representation, Allocator> operator-(
     const Type& s,
     const rush::Mat<Columns, Rows, Type, Representation, Allocator>& m) {
     rush::Mat<Columns, Rows, Type, Representation, Allocator> result;
@@ -68,7 +68,7 @@ inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator-(
 
 template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     requires rush::HasMul<Type>
-inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator*(
+constexpr rush::Mat<Columns, Rows, Type, Representation, Allocator> operator*(
     const Type& s,
     const rush::Mat<Columns, Rows, Type, Representation, Allocator>& m) {
     rush::Mat<Columns, Rows, Type, Representation, Allocator> result;
@@ -80,7 +80,7 @@ inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator*(
 
 template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     requires rush::HasDiv<Type>
-inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator/(
+constexpr rush::Mat<Columns, Rows, Type, Representation, Allocator> operator/(
     const Type& s,
     const rush::Mat<Columns, Rows, Type, Representation, Allocator>& m) {
     rush::Mat<Columns, Rows, Type, Representation, Allocator> result;
@@ -92,7 +92,7 @@ inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator/(
 
 template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     requires rush::HasShl<Type>
-inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator<<(
+constexpr rush::Mat<Columns, Rows, Type, Representation, Allocator> operator<<(
     const Type& s,
     const rush::Mat<Columns, Rows, Type, Representation, Allocator>& m) {
     rush::Mat<Columns, Rows, Type, Representation, Allocator> result;
@@ -104,7 +104,7 @@ inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator<<(
 
 template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     requires rush::HasShr<Type>
-inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator>>(
+constexpr rush::Mat<Columns, Rows, Type, Representation, Allocator> operator>>(
     const Type& s,
     const rush::Mat<Columns, Rows, Type, Representation, Allocator>& m) {
     rush::Mat<Columns, Rows, Type, Representation, Allocator> result;
@@ -116,7 +116,7 @@ inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator>>(
 
 template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     requires rush::HasBitAnd<Type>
-inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator&(
+constexpr rush::Mat<Columns, Rows, Type, Representation, Allocator> operator&(
     const Type& s,
     const rush::Mat<Columns, Rows, Type, Representation, Allocator>& m) {
     rush::Mat<Columns, Rows, Type, Representation, Allocator> result;
@@ -128,7 +128,7 @@ inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator&(
 
 template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     requires rush::HasBitOr<Type>
-inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator|(
+constexpr rush::Mat<Columns, Rows, Type, Representation, Allocator> operator|(
     const Type& s,
     const rush::Mat<Columns, Rows, Type, Representation, Allocator>& m) {
     rush::Mat<Columns, Rows, Type, Representation, Allocator> result;
@@ -140,7 +140,7 @@ inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator|(
 
 template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     requires rush::HasBitXor<Type>
-inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator^(
+constexpr rush::Mat<Columns, Rows, Type, Representation, Allocator> operator^(
     const Type& s,
     const rush::Mat<Columns, Rows, Type, Representation, Allocator>& m) {
     rush::Mat<Columns, Rows, Type, Representation, Allocator> result;
@@ -152,7 +152,7 @@ inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator^(
 
 template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     requires rush::HasAnd<Type>
-inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator&&(
+constexpr rush::Mat<Columns, Rows, Type, Representation, Allocator> operator&&(
     const Type& s,
     const rush::Mat<Columns, Rows, Type, Representation, Allocator>& m) {
     rush::Mat<Columns, Rows, Type, Representation, Allocator> result;
@@ -164,7 +164,7 @@ inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator&&(
 
 template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     requires rush::HasOr<Type>
-inline rush::Mat<Columns, Rows, Type, Representation, Allocator> operator||(
+constexpr rush::Mat<Columns, Rows, Type, Representation, Allocator> operator||(
     const Type& s,
     const rush::Mat<Columns, Rows, Type, Representation, Allocator>& m) {
     rush::Mat<Columns, Rows, Type, Representation, Allocator> result;
@@ -0,0 +1,363 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_MAT_GEMM_H
+#define RUSH_MAT_GEMM_H
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <rush/algorithm.h>
+#include <rush/cpu.h>
+#include <rush/parallel.h>
+#include <rush/simd.h>
+
+namespace rush::simd {
+    /**
+     * The minimum amount of multiply-adds a dense matrix product
+     * must have to be computed by gemm().
+     * Smaller products are faster without packing their operands.
+     */
+    constexpr size_t GEMM_THRESHOLD = 48 * 48 * 48;
+
+    /**
+     * The minimum amount of multiply-adds a thread must compute
+     * when gemm() is split across several threads.
+     */
+    constexpr size_t GEMM_MIN_CHUNK = 1 << 18;
+
+    /**
+     * Whether dense products of the given type should be
+     * computed using gemm().
+     */
+    template<typename Type>
+    constexpr bool HasGemmKernel = Algorithm().useIntrinsics() &&
+                                   HasBulkKernel<Type>;
+
+    namespace detail {
+        /**
+         * The sizes of the blocks gemm() splits the operands into.
+         * <p>
+         * A KC x NR panel of B fits in the L1 cache, an MC x KC block
+         * of A fits in the L2 cache and a KC x NC block of B fits
+         * in the L3 cache.
+         */
+        template<typename Type>
+        struct GemmBlocking {
+            static constexpr size_t KC = 256;
+            static constexpr size_t MC = 128 * 4 / sizeof(Type);
+            static constexpr size_t NC = 4096;
+        };
+
+        // REGION MICRO-KERNELS
+
+        // A micro-kernel computes C += A * B for an MR x NR tile of C.
+        // A is a packed panel storing MR values for each step of k,
+        // and B is a packed panel storing NR values for each step of k.
+        // The whole tile is accumulated in registers.
+
+        template<typename Type>
+        struct GemmGeneric {
+            static constexpr size_t MR = 4;
+            static constexpr size_t NR = 4;
+
+            static void run(size_t kc, const Type* a, const Type* b, Type* c, size_t ldc) {
+                Type acc[NR][MR] = {};
+                for (size_t p = 0; p < kc; ++p) {
+                    for (size_t j = 0; j < NR; ++j) {
+                        for (size_t i = 0; i < MR; ++i) {
+                            acc[j][i] += a[i] * b[j];
+                        }
+                    }
+                    a += MR;
+                    b += NR;
+                }
+                for (size_t j = 0; j < NR; ++j) {
+                    for (size_t i = 0; i < MR; ++i) {
+                        c[j * ldc + i] += acc[j][i];
+                    }
+                }
+            }
+        };
+
+#ifdef RUSH_DISPATCH
+
+        // Two registers of A and six columns of B: 12 accumulators,
+        // which leaves room for the operands in the 16 vector registers.
+        // The kernels are written once per instruction set,
+        // as their target must match the one of the operations they use.
+
+        template<typename Type>
+        struct GemmSSE4 {
+            using O = SSE4<Type>;
+            static constexpr size_t MR = 2 * O::Lanes;
+            static constexpr size_t NR = 6;
+
+            RUSH_TARGET_SSE4 static void run(size_t kc, const Type* a, const Type* b,
+                                             Type* c, size_t ldc) {
+                typename O::Reg c0[NR], c1[NR];
+                for (size_t j = 0; j < NR; ++j) {
+                    c0[j] = O::zero();
+                    c1[j] = O::zero();
+                }
+                for (size_t p = 0; p < kc; ++p) {
+                    auto a0 = O::load(a);
+                    auto a1 = O::load(a + O::Lanes);
+                    for (size_t j = 0; j < NR; ++j) {
+                        auto bj = O::set1(b[j]);
+                        c0[j] = O::fmadd(a0, bj, c0[j]);
+                        c1[j] = O::fmadd(a1, bj, c1[j]);
+                    }
+                    a += MR;
+                    b += NR;
+                }
+                for (size_t j = 0; j < NR; ++j) {
+                    Type* cj = c + j * ldc;
+                    O::store(cj, O::add(O::load(cj), c0[j]));
+                    O::store(cj + O::Lanes, O::add(O::load(cj + O::Lanes), c1[j]));
+                }
+            }
+        };
+
+        template<typename Type>
+        struct GemmAVX2 {
+            using O = AVX2<Type>;
+            static constexpr size_t MR = 2 * O::Lanes;
+            static constexpr size_t NR = 6;
+
+            RUSH_TARGET_AVX2 static void run(size_t kc, const Type* a, const Type* b,
+                                             Type* c, size_t ldc) {
+                typename O::Reg c0[NR], c1[NR];
+                for (size_t j = 0; j < NR; ++j) {
+                    c0[j] = O::zero();
+                    c1[j] = O::zero();
+                }
+                for (size_t p = 0; p < kc; ++p) {
+                    auto a0 = O::load(a);
+                    auto a1 = O::load(a + O::Lanes);
+                    for (size_t j = 0; j < NR; ++j) {
+                        auto bj = O::set1(b[j]);
+                        c0[j] = O::fmadd(a0, bj, c0[j]);
+                        c1[j] = O::fmadd(a1, bj, c1[j]);
+                    }
+                    a += MR;
+                    b += NR;
+                }
+                for (size_t j = 0; j < NR; ++j) {
+                    Type* cj = c + j * ldc;
+                    O::store(cj, O::add(O::load(cj), c0[j]));
+                    O::store(cj + O::Lanes, O::add(O::load(cj + O::Lanes), c1[j]));
+                }
+            }
+        };
+
+        template<typename Type>
+        struct GemmAVX512 {
+            using O = AVX512<Type>;
+            static constexpr size_t MR = 2 * O::Lanes;
+            static constexpr size_t NR = 6;
+
+            RUSH_TARGET_AVX512 static void run(size_t kc, const Type* a, const Type* b,
+                                               Type* c, size_t ldc) {
+                typename O::Reg c0[NR], c1[NR];
+                for (size_t j = 0; j < NR; ++j) {
+                    c0[j] = O::zero();
+                    c1[j] = O::zero();
+                }
+                for (size_t p = 0; p < kc; ++p) {
+                    auto a0 = O::load(a);
+                    auto a1 = O::load(a + O::Lanes);
+                    for (size_t j = 0; j < NR; ++j) {
+                        auto bj = O::set1(b[j]);
+                        c0[j] = O::fmadd(a0, bj, c0[j]);
+                        c1[j] = O::fmadd(a1, bj, c1[j]);
+                    }
+                    a += MR;
+                    b += NR;
+                }
+                for (size_t j = 0; j < NR; ++j) {
+                    Type* cj = c + j * ldc;
+                    O::store(cj, O::add(O::load(cj), c0[j]));
+                    O::store(cj + O::Lanes, O::add(O::load(cj + O::Lanes), c1[j]));
+                }
+            }
+        };
+
+#endif
+
+        // ENDREGION
+
+        // REGION PACKING
+
+        /**
+         * Copies the mc x kc block of A starting at a into panels of MR rows.
+         * Each panel stores the MR values of every step of k contiguously.
+         * Rows past mc are filled with zeros.
+         */
+        template<size_t MR, typename Type>
+        void packA(size_t mc, size_t kc, const Type* a, size_t lda, Type* out) {
+            for (size_t ir = 0; ir < mc; ir += MR) {
+                size_t mr = std::min(MR, mc - ir);
+                for (size_t p = 0; p < kc; ++p) {
+                    const Type* column = a + p * lda + ir;
+                    for (size_t i = 0; i < mr; ++i) out[i] = column[i];
+                    for (size_t i = mr; i < MR; ++i) out[i] = Type(0);
+                    out += MR;
+                }
+            }
+        }
+
+        /**
+         * Copies the kc x nc block of B starting at b into panels of NR columns.
+         * Each panel stores the NR values of every step of k contiguously.
+         * Columns past nc are filled with zeros.
+         */
+        template<size_t NR, typename Type>
+        void packB(size_t kc, size_t nc, const Type* b, size_t ldb, Type* out) {
+            for (size_t jr = 0; jr < nc; jr += NR) {
+                size_t nr = std::min(NR, nc - jr);
+                for (size_t j = 0; j < nr; ++j) {
+                    const Type* column = b + (jr + j) * ldb;
+                    for (size_t p = 0; p < kc; ++p) out[p * NR + j] = column[p];
+                }
+                for (size_t j = nr; j < NR; ++j) {
+                    for (size_t p = 0; p < kc; ++p) out[p * NR + j] = Type(0);
+                }
+                out += kc * NR;
+            }
+        }
+
+        // ENDREGION
+
+        /**
+         * Computes C += A * B using the given micro-kernel,
+         * being A an m x k matrix, B a k x n matrix and C an m x n matrix.
+         * All of them are column-major, with the given leading dimensions.
+         */
+        template<typename Kernel, typename Type>
+        void gemmBlocked(size_t m, size_t n, size_t k,
+                         const Type* a, size_t lda,
+                         const Type* b, size_t ldb,
+                         Type* c, size_t ldc) {
+            constexpr size_t MR = Kernel::MR;
+            constexpr size_t NR = Kernel::NR;
+            constexpr size_t KC = GemmBlocking<Type>::KC;
+            constexpr size_t MC = GemmBlocking<Type>::MC / MR * MR;
+            constexpr size_t NC = GemmBlocking<Type>::NC / NR * NR;
+
+            size_t maxKC = std::min(KC, k);
+            size_t maxMC = (std::min(MC, m) + MR - 1) / MR * MR;
+            size_t maxNC = (std::min(NC, n) + NR - 1) / NR * NR;
+            std::vector<Type> packedA(maxMC * maxKC);
+            std::vector<Type> packedB(maxKC * maxNC);
+            Type edge[MR * NR];
+
+            for (size_t jc = 0; jc < n; jc += NC) {
+                size_t nc = std::min(NC, n - jc);
+                for (size_t pc = 0; pc < k; pc += KC) {
+                    size_t kc = std::min(KC, k - pc);
+                    packB<NR>(kc, nc, b + jc * ldb + pc, ldb, packedB.data());
+
+                    for (size_t ic = 0; ic < m; ic += MC) {
+                        size_t mc = std::min(MC, m - ic);
+                        packA<MR>(mc, kc, a + pc * lda + ic, lda, packedA.data());
+
+                        for (size_t jr = 0; jr < nc; jr += NR) {
+                            size_t nr = std::min(NR, nc - jr);
+                            const Type* pb = packedB.data() + jr * kc;
+                            for (size_t ir = 0; ir < mc; ir += MR) {
+                                size_t mr = std::min(MR, mc - ir);
+                                const Type* pa = packedA.data() + ir * kc;
+                                Type* tile = c + (jc + jr) * ldc + ic + ir;
+
+                                if (mr == MR && nr == NR) {
+                                    Kernel::run(kc, pa, pb, tile, ldc);
+                                    continue;
+                                }
+
+                                // Border tiles are computed into a full tile.
+                                std::fill_n(edge, MR * NR, Type(0));
+                                Kernel::run(kc, pa, pb, edge, MR);
+                                for (size_t j = 0; j < nr; ++j) {
+                                    for (size_t i = 0; i < mr; ++i) {
+                                        tile[j * ldc + i] += edge[j * MR + i];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * Splits the columns of C across several threads.
+         * Each thread packs its own blocks, so no synchronization is needed.
+         */
+        template<typename Kernel, typename Type>
+        void gemmParallel(size_t m, size_t n, size_t k,
+                          const Type* a, size_t lda,
+                          const Type* b, size_t ldb,
+                          Type* c, size_t ldc, size_t threads) {
+            constexpr size_t NR = Kernel::NR;
+            size_t panels = (n + NR - 1) / NR;
+            size_t panelWork = std::max<size_t>(m * k * NR, 1);
+            size_t minPanels = std::max<size_t>(GEMM_MIN_CHUNK / panelWork, 1);
+
+            parallelFor(panels, threads, [&](size_t from, size_t to) {
+                size_t first = from * NR;
+                size_t last = std::min(to * NR, n);
+                gemmBlocked<Kernel>(m, last - first, k, a, lda,
+                                    b + first * ldb, ldb, c + first * ldc, ldc);
+            }, minPanels);
+        }
+    }
+
+    /**
+     * Computes C += A * B, being A an m x k matrix, B a k x n matrix
+     * and C an m x n matrix.
+     * All of them are column-major and the columns of each matrix
+     * are separated by the given leading dimension.
+     * C must not alias A or B.
+     * <p>
+     * The operands are packed into cache-sized blocks and multiplied
+     * by a register-blocked micro-kernel of the instruction set returned
+     * by cpu::instructionSet().
+     * <p>
+     * The columns of C may be split across several threads.
+     * See parallelFor() for more information.
+     *
+     * @param threads the maximum amount of threads to use.
+     * 0 uses all the hardware threads.
+     */
+    template<typename Type>
+    void gemm(size_t m, size_t n, size_t k,
+              const Type* a, size_t lda,
+              const Type* b, size_t ldb,
+              Type* c, size_t ldc, size_t threads = 1) {
+        if (m == 0 || n == 0 || k == 0) return;
+#ifdef RUSH_DISPATCH
+        if constexpr (HasBulkKernel<Type>) {
+            switch (cpu::instructionSet()) {
+                case InstructionSet::AVX512:
+                    detail::gemmParallel<detail::GemmAVX512<Type>>(m, n, k, a, lda, b, ldb, c, ldc, threads);
+                    return;
+                case InstructionSet::AVX2:
+                    detail::gemmParallel<detail::GemmAVX2<Type>>(m, n, k, a, lda, b, ldb, c, ldc, threads);
+                    return;
+                case InstructionSet::SSE4:
+                    detail::gemmParallel<detail::GemmSSE4<Type>>(m, n, k, a, lda, b, ldb, c, ldc, threads);
+                    return;
+                default:
+                    break;
+            }
+        }
+#endif
+        detail::gemmParallel<detail::GemmGeneric<Type>>(m, n, k, a, lda, b, ldb, c, ldc, threads);
+    }
+}
+
+#endif //RUSH_MAT_GEMM_H
@@ -7,13 +7,63 @@
 
 #include <rush/quaternion/quat.h>
 #include <rush/matrix/matrix_lu_decompose.h>
+#include <rush/matrix/mat_simd.h>
+#include <rush/matrix/mat_gemm.h>
+#include <rush/matrix/mat_sparse_product.h>
+#include <rush/matrix/mat_sparse_triangular.h>
 
 namespace rush {
+    namespace detail {
+        /**
+         * Whether a Mat with the given parameters can be computed using
+         * the 4x4 kernels of rush/matrix/mat_simd.h.
+         * The columns of a dense matrix are stored one after another,
+         * so its values can be read as a flat array.
+         */
+        template<size_t Columns, size_t Rows, typename Type, typename Representation>
+        constexpr bool HasMat4Kernel = Columns == 4 && Rows == 4 &&
+                                       std::is_same_v<Representation, MatDenseRep> &&
+                                       sizeof(Vec<4, Type>) == 4 * sizeof(Type) &&
+                                       simd::HasMat4Kernel<Type>;
+
+        /**
+         * Whether the product of a Mat<Columns, Rows> and a Mat<OC, Columns>
+         * should be computed by simd::gemm().
+         * Both must be dense matrices whose values can be read as a flat array.
+         */
+        template<size_t Columns, size_t Rows, size_t OC, typename Type,
+            typename Representation, typename ORep>
+        constexpr bool UsesGemm = std::is_same_v<Representation, MatDenseRep> &&
+                                  std::is_same_v<ORep, MatDenseRep> &&
+                                  sizeof(Vec<Rows, Type>) == Rows * sizeof(Type) &&
+                                  sizeof(Vec<Columns, Type>) == Columns * sizeof(Type) &&
+                                  simd::HasGemmKernel<Type> &&
+                                  Columns * Rows * OC >= simd::GEMM_THRESHOLD;
+
+        /**
+         * Computes y += a * x, being x and y arrays of N values.
+         * Short columns do not amortize the dispatch of the bulk kernels.
+         */
+        template<size_t N, typename Type>
+        constexpr void addScaledColumn(const Type& a, const Type* x, Type* y) {
+            if constexpr (N >= simd::BULK_THRESHOLD && simd::HasBulkKernel<Type> &&
+                          Algorithm().useIntrinsics()) {
+                if (!std::is_constant_evaluated()) {
+                    simd::axpy(a, x, y, N);
+                    return;
+                }
+            }
+            for (size_t i = 0; i < N; ++i) {
+                y[i] += a * x[i];
+            }
+        }
+    }
+
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     template<typename... T>
         requires (std::is_convertible_v<std::common_type_t<T...>, Type>
                   && sizeof...(T) <= Columns * Rows && sizeof...(T) > 1)
-    Mat<Columns, Rows, Type, Representation, Allocator>::Mat(T... list) {
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Mat(T... list) {
         size_t index = 0;
         std::initializer_list<int>{
             ([&] {
@@ -24,10 +74,10 @@ namespace rush {
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Mat() : rep() {}
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Mat() : rep() {}
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    Mat<Columns, Rows, Type, Representation,
+    constexpr Mat<Columns, Rows, Type, Representation,
         Allocator>::Mat(Type diagonal) : rep() {
         for (size_t i = 0; i < std::min(Columns, Rows); ++i) {
             rep.pushValue(i, i, diagonal);
@@ -54,9 +104,43 @@ namespace rush {
         }
     }
 
+    template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
+    template<typename Populator>
+        requires (std::is_invocable_r_v<Type, Populator&, size_t, size_t>
+                  && !detail::IsMat<std::remove_cvref_t<Populator>>)
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Mat(Populator&& populator) {
+        for (size_t c = 0; c < Columns; ++c) {
+            for (size_t r = 0; r < Rows; ++r) {
+                rep.pushValue(c, r, populator(c, r));
+            }
+        }
+    }
+
+    template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
+    template<typename Populator>
+        requires std::is_invocable_r_v<Type, Populator&,
+            size_t, size_t, size_t, size_t>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Mat(Populator&& populator) {
+        for (size_t c = 0; c < Columns; ++c) {
+            for (size_t r = 0; r < Rows; ++r) {
+                rep.pushValue(c, r, populator(c, r, Columns, Rows));
+            }
+        }
+    }
+
+    template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
+    template<typename E> requires ExpressionOf<E, MatShape<Columns, Rows>, Type>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Mat(const E& expression) {
+        for (size_t c = 0; c < Columns; ++c) {
+            for (size_t r = 0; r < Rows; ++r) {
+                rep.pushValue(c, r, expression.value(c * Rows + r));
+            }
+        }
+    }
+
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     template<size_t OColumns, size_t ORows, typename ORep, typename OAlloc> requires(Columns > OColumns || Rows > ORows)
-    Mat<Columns, Rows, Type, Representation, Allocator>::Mat(
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Mat(
         const Mat<OColumns, ORows, Type, ORep, OAlloc>& other, Type diagonal) : Mat(diagonal) {
         for (size_t c = 0; c < std::min(Columns, OColumns); ++c) {
             for (size_t r = 0; r < std::min(Rows, ORows); ++r) {
@@ -67,7 +151,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     template<typename ORep, typename OAlloc>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Mat(const Mat<Columns, Rows, Type, ORep, OAlloc>& other) {
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Mat(const Mat<Columns, Rows, Type, ORep, OAlloc>& other) {
         for (size_t c = 0; c < Columns; ++c) {
             for (size_t r = 0; r < Rows; ++r) {
                 rep.pushValue(c, r, other[c][r]);
@@ -81,73 +165,73 @@ namespace rush {
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    const Type* Mat<Columns, Rows, Type, Representation,
+    constexpr const Type* Mat<Columns, Rows, Type, Representation,
         Allocator>::toPointer() const requires Representation::PinnedMemory {
         return rep.toPointer();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    Type* Mat<Columns, Rows, Type, Representation, Allocator>::toPointer() requires Representation::PinnedMemory {
+    constexpr Type* Mat<Columns, Rows, Type, Representation, Allocator>::toPointer() requires Representation::PinnedMemory {
         return rep.toPointer();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Rep::ColumnRef
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Rep::ColumnRef
     Mat<Columns, Rows, Type, Representation, Allocator>::column(size_t column) requires Representation::PinnedMemory {
         return rep.columnRef(column);
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Rep::ColumnType
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Rep::ColumnType
     Mat<Columns, Rows, Type, Representation, Allocator>::
     column(size_t column) const {
         return rep.column(column);
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Rep::RowRef
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Rep::RowRef
     Mat<Columns, Rows, Type, Representation, Allocator>::row(size_t row) requires Representation::PinnedMemory {
         return rep.rowRef(row);
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Rep::RowType
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Rep::RowType
     Mat<Columns, Rows, Type, Representation, Allocator>::row(size_t row) const {
         return rep.row(row);
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Rep::ColumnRef
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Rep::ColumnRef
     Mat<Columns, Rows, Type, Representation, Allocator>::operator[](size_t column) requires
         Representation::PinnedMemory {
         return rep.columnRef(column);
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Rep::ColumnType
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Rep::ColumnType
     Mat<Columns, Rows, Type, Representation, Allocator>::operator[](size_t column) const {
         return rep.column(column);
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    Type& Mat<Columns, Rows, Type, Representation, Allocator>::operator()(size_t column, size_t row)
+    constexpr Type& Mat<Columns, Rows, Type, Representation, Allocator>::operator()(size_t column, size_t row)
         requires Representation::PinnedMemory {
         return rep.value(column, row);
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    const Type& Mat<Columns, Rows, Type, Representation, Allocator>::operator()(size_t column, size_t row) const {
+    constexpr const Type& Mat<Columns, Rows, Type, Representation, Allocator>::operator()(size_t column, size_t row) const {
         return rep.value(column, row);
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    void Mat<Columns, Rows, Type, Representation, Allocator>::pushValue(size_t column, size_t row, const Type& value) {
+    constexpr void Mat<Columns, Rows, Type, Representation, Allocator>::pushValue(size_t column, size_t row, const Type& value) {
         rep.pushValue(column, row, value);
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    Type Mat<Columns, Rows, Type, Representation, Allocator>::determinant() const requires
+    constexpr Type Mat<Columns, Rows, Type, Representation, Allocator>::determinant() const requires
         HasAdd<Type> && HasSub<Type> && HasMul<Type> && HasDiv<Type> && (Columns == Rows) {
         if constexpr (Columns == 1) {
             return rep.value(0, 0);
@@ -165,14 +249,23 @@ namespace rush {
                    (rep.value(1, 0) * rep.value(2, 1)
                     - rep.value(1, 1) * rep.value(2, 0));
         } else {
+            if constexpr (detail::HasMat4Kernel<Columns, Rows, Type, Representation>) {
+                if (!std::is_constant_evaluated()) {
+                    Type det;
+                    if (simd::mat4Inverse(toPointer(), static_cast<Type*>(nullptr), det)) {
+                        return det;
+                    }
+                }
+            }
+
             // Generic method
             Self tempM = *this;
 
-            Type det = tempM[0][0];
+            Type det = Type(1);
             for (size_t i = 0; i < Columns; i++) {
                 size_t pivot = i;
                 for (size_t j = i + 1; j < Columns; j++) {
-                    if (std::abs(tempM[j][i]) > std::abs(tempM[pivot][i])) {
+                    if (rush::abs(tempM[j][i]) > rush::abs(tempM[pivot][i])) {
                         pivot = j;
                     }
                 }
@@ -182,9 +275,7 @@ namespace rush {
                     det = -det;
                 }
 
-                if (i != 0) {
-                    det *= tempM[i][i];
-                }
+                det *= tempM[i][i];
                 if (tempM[i][i] == 0) return det;
 
                 for (size_t j = i + 1; j < Columns; j++) {
@@ -200,10 +291,10 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Rows, Columns, Type, Representation, Allocator>
+    constexpr Mat<Rows, Columns, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::transpose() const {
         if constexpr (std::is_same_v<Representation, MatSparseRep>) {
-            Mat transposed;
+            Mat<Rows, Columns, Type, Representation, Allocator> transposed;
             transposed.rep.vals.resize(rep.vals.size());
             transposed.rep.rows.resize(rep.vals.size());
 
@@ -211,8 +302,8 @@ namespace rush {
                 ++transposed.rep.cols[rep.rows[i] + 1];
             }
 
-            for (size_t i = 1; i <= Columns; ++i) {
-                transposed.rep.cols[i] += rep.cols[i - 1];
+            for (size_t i = 1; i <= Rows; ++i) {
+                transposed.rep.cols[i] += transposed.rep.cols[i - 1];
             }
 
             auto positions = transposed.rep.cols;
@@ -229,6 +320,15 @@ namespace rush {
 
             return transposed;
         } else {
+            if constexpr (detail::HasMat4Kernel<Columns, Rows, Type, Representation>) {
+                if (!std::is_constant_evaluated()) {
+                    Self transposed;
+                    if (simd::mat4Transpose(toPointer(), transposed.toPointer())) {
+                        return transposed;
+                    }
+                }
+            }
+
             return Mat<Rows, Columns, Type, Representation, Allocator>
             ([this](size_t c, size_t r) {
                 return operator()(r, c);
@@ -238,7 +338,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::inverse() const
         requires HasAdd<Type> && HasSub<Type> && HasMul<Type> && HasDiv<Type> && (Columns == Rows) && (Columns < 5) {
         auto& d = *this;
@@ -261,6 +361,23 @@ namespace rush {
             inverse.pushValue(2, 2, +(d[0][0] * d[1][1] - d[1][0] * d[0][1]));
             return inverse / det;
         } else {
+            if constexpr (detail::HasMat4Kernel<Columns, Rows, Type, Representation>) {
+                if (!std::is_constant_evaluated()) {
+                    Self inv;
+                    Type det;
+                    if (simd::mat4Inverse(toPointer(), inv.toPointer(), det)) {
+                        return inv;
+                    }
+                }
+            } else if constexpr (std::is_same_v<Representation, MatSparseRep> &&
+                                 detail::HasMat4Kernel<Columns, Rows, Type, MatDenseRep>) {
+                // A 4x4 sparse matrix is cheaper to invert as a dense one.
+                // This also keeps the results of both representations equal.
+                if (!std::is_constant_evaluated()) {
+                    return Self(Mat<Columns, Rows, Type>(*this).inverse());
+                }
+            }
+
             // Based of https://github.com/g-truc/glm/blob/master/glm/gtc/matrix_inverse.inl
             Type s00 = d[2][2] * d[3][3] - d[3][2] * d[2][3];
             Type s01 = d[2][1] * d[3][3] - d[3][1] * d[2][3];
@@ -329,6 +446,14 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     Vec<Rows, Type> Mat<Columns, Rows, Type, Representation, Allocator>::solveLu(const Vec<Rows, Type>& r) {
+        if constexpr (std::is_same_v<Representation, MatSparseRep>) {
+            // Walk the compressed columns instead of searching every value.
+            Vec<Rows, Type> x = r;
+            sparseTriangularSolve(*this, SparseTriangle::UnitLower, x.toPointer());
+            sparseTriangularSolve(*this, SparseTriangle::Upper, x.toPointer());
+            return x;
+        }
+
         Vec<Rows, Type> x, y;
 
         for (size_t i = 0; i < Columns; i++) {
@@ -354,7 +479,7 @@ namespace rush {
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
     template<typename To, typename ORep, typename OAlloc>
-    Mat<Columns, Rows, To, ORep, OAlloc>
+    constexpr Mat<Columns, Rows, To, ORep, OAlloc>
     Mat<Columns, Rows, Type, Representation, Allocator>::cast() const {
         return Mat<Columns, Rows, To, ORep, OAlloc>([this](size_t c, size_t r) {
             return static_cast<To>(this->operator()(c, r));
@@ -363,21 +488,21 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator+() {
         return *this;
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator+() const {
         return *this;
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::operator-() const
         requires HasSub<Type> {
         Self result;
@@ -393,9 +518,47 @@ namespace rush {
         return result;
     }
 
+    template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
+    template<typename E> requires ExpressionOf<E, MatShape<Columns, Rows>, Type>
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    Mat<Columns, Rows, Type, Representation, Allocator>::operator=(
+        const E& expression) requires Representation::PinnedMemory {
+        // Element i of an expression only depends on the element i
+        // of its operands, so this matrix can be part of the expression.
+        Type* data = toPointer();
+        for (size_t i = 0; i < Columns * Rows; ++i) {
+            data[i] = expression.value(i);
+        }
+        return *this;
+    }
+
+    template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
+    template<typename E> requires ExpressionOf<E, MatShape<Columns, Rows>, Type>
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    Mat<Columns, Rows, Type, Representation, Allocator>::operator+=(
+        const E& expression) requires (Representation::PinnedMemory && HasAdd<Type>) {
+        Type* data = toPointer();
+        for (size_t i = 0; i < Columns * Rows; ++i) {
+            data[i] += expression.value(i);
+        }
+        return *this;
+    }
+
+    template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
+    template<typename E> requires ExpressionOf<E, MatShape<Columns, Rows>, Type>
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    Mat<Columns, Rows, Type, Representation, Allocator>::operator-=(
+        const E& expression) requires (Representation::PinnedMemory && HasSub<Type>) {
+        Type* data = toPointer();
+        for (size_t i = 0; i < Columns * Rows; ++i) {
+            data[i] -= expression.value(i);
+        }
+        return *this;
+    }
+
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator+=(
         const Type& s) requires HasAdd<Type> {
         for (size_t c = 0; c < Columns; ++c) {
@@ -408,7 +571,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator-=(
         const Type& s) requires HasSub<Type> {
         for (size_t c = 0; c < Columns; ++c) {
@@ -421,7 +584,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator*=(
         const Type& s) requires HasMul<Type> {
         for (size_t c = 0; c < Columns; ++c) {
@@ -434,7 +597,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator/=(
         const Type& s) requires HasDiv<Type> {
         for (size_t c = 0; c < Columns; ++c) {
@@ -447,7 +610,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator<<=(
         const Type& s) requires HasShl<Type> {
         for (size_t c = 0; c < Columns; ++c) {
@@ -460,7 +623,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator>>=(
         const Type& s) requires HasShr<Type> {
         for (size_t c = 0; c < Columns; ++c) {
@@ -473,7 +636,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator&=(
         const Type& s) requires HasBitAnd<Type> {
         for (size_t c = 0; c < Columns; ++c) {
@@ -486,7 +649,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator|=(
         const Type& s) requires HasBitOr<Type> {
         for (size_t c = 0; c < Columns; ++c) {
@@ -499,7 +662,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
+    constexpr typename Mat<Columns, Rows, Type, Representation, Allocator>::Self&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator^=(
         const Type& s) requires HasBitXor<Type> {
         for (size_t c = 0; c < Columns; ++c) {
@@ -513,7 +676,7 @@ namespace rush {
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
     template<typename OAlloc>
-    Mat<Columns, Rows, Type, Representation, Allocator>&
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator+=(
         const Mat<Columns, Rows, Type, OAlloc>& o) requires HasAdd<Type> {
         for (size_t c = 0; c < Columns; ++c) {
@@ -527,7 +690,7 @@ namespace rush {
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
     template<typename OAlloc>
-    Mat<Columns, Rows, Type, Representation, Allocator>&
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>&
     Mat<Columns, Rows, Type, Representation, Allocator>::operator-=(
         const Mat<Columns, Rows, Type, OAlloc>& o) requires HasSub<Type> {
         for (size_t c = 0; c < Columns; ++c) {
@@ -540,7 +703,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::operator+(
         const Type& s) const requires
         HasAdd<Type> {
@@ -557,7 +720,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::operator-(
         const Type& s) const requires
         HasSub<Type> {
@@ -574,7 +737,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::operator*(
         const Type& s) const requires
         HasMul<Type> {
@@ -593,7 +756,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::operator/(
         const Type& s) const requires
         HasDiv<Type> {
@@ -612,7 +775,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::operator<<(
         const Type& s) const requires
         HasShl<Type> {
@@ -629,7 +792,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::operator>>(
         const Type& s) const requires
         HasShr<Type> {
@@ -646,7 +809,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::operator&(
         const Type& s) const requires
         HasBitAnd<Type> {
@@ -665,7 +828,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::operator|(
         const Type& s) const requires
         HasBitOr<Type> {
@@ -682,7 +845,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::operator^(
         const Type& s) const requires
         HasBitXor<Type> {
@@ -699,7 +862,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::operator&&(
         const Type& s) const requires
         HasAnd<Type> {
@@ -718,7 +881,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>::Self
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>::Self
     Mat<Columns, Rows, Type, Representation, Allocator>::operator||(
         const Type& s) const requires
         HasOr<Type> {
@@ -734,20 +897,40 @@ namespace rush {
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
     template<typename OAlloc>
-    Vec<Columns, Type, Allocator>
+    constexpr Vec<Rows, Type, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::operator*(
         const Vec<Columns, Type, OAlloc>& other) const requires
         (HasAdd<Type> && HasMul<Type>) {
-        auto transposed = transpose();
-        return Vec<Columns, Type, Allocator>([&](size_t r) {
-            return transposed.column(r).dot(other);
-        });
+        if constexpr (detail::HasMat4Kernel<Columns, Rows, Type, Representation>) {
+            if (!std::is_constant_evaluated()) {
+                Vec<Rows, Type, Allocator> result;
+                if (simd::mat4MulVec(toPointer(), other.toPointer(), result.toPointer())) {
+                    return result;
+                }
+            }
+        }
+
+        if constexpr (std::is_same_v<Representation, MatDenseRep>) {
+            // The result is the sum of the columns weighted by
+            // the components of the vector: one pass over the matrix.
+            Vec<Rows, Type, Allocator> result;
+            for (size_t c = 0; c < Columns; ++c) {
+                detail::addScaledColumn<Rows>(other[c], rep.data[c].toPointer(), result.toPointer());
+            }
+            return result;
+        } else {
+            // Walk the compressed columns once. See sparseMultiply().
+            Vec<Rows, Type, Allocator> result;
+            detail::sparseMultiplyColumns(rep.cols.toPointer(), rep.rows.data(), rep.vals.data(),
+                                          other.toPointer(), result.toPointer(), 0, Columns);
+            return result;
+        }
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
     template<typename ORep, typename OAlloc>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::operator+(
         const Mat<Columns, Rows, Type, ORep, OAlloc>& other) const requires
         HasAdd<Type> {
@@ -765,7 +948,7 @@ namespace rush {
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
     template<typename ORep, typename OAlloc>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::operator-(
         const Mat<Columns, Rows, Type, ORep, OAlloc>& other) const requires
         HasSub<Type> {
@@ -783,20 +966,76 @@ namespace rush {
     template<size_t Columns, size_t Rows, typename Type,
         typename Representation, typename Allocator>
     template<size_t OC, size_t OR, typename ORep, typename OAlloc>
-    Mat<OC, Rows, Type, Representation, Allocator>
+    constexpr Mat<OC, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::operator*(
         const Mat<OC, OR, Type, ORep, OAlloc>& other) const requires
         (Columns == OR && HasAdd<Type> && HasMul<Type>) {
-        auto transposed = transpose();
-        return Mat<OC, Rows, Type, Representation, Allocator>(
-            [&](size_t c, size_t r) {
-                return transposed.column(r).dot(other.column(c));
-            });
+        if constexpr (detail::HasMat4Kernel<Columns, Rows, Type, Representation> &&
+                      detail::HasMat4Kernel<OC, OR, Type, ORep>) {
+            if (!std::is_constant_evaluated()) {
+                Mat<OC, Rows, Type, Representation, Allocator> result;
+                if (simd::mat4Mul(toPointer(), other.toPointer(), result.toPointer())) {
+                    return result;
+                }
+            }
+        } else if constexpr (std::is_same_v<Representation, MatSparseRep> &&
+                             std::is_same_v<ORep, MatSparseRep> &&
+                             detail::HasMat4Kernel<Columns, Rows, Type, MatDenseRep> &&
+                             detail::HasMat4Kernel<OC, OR, Type, MatDenseRep>) {
+            // Small sparse products are cheaper as dense ones,
+            // and both representations return the same values.
+            if (!std::is_constant_evaluated()) {
+                return Mat<OC, Rows, Type, Representation, Allocator>(
+                    Mat<Columns, Rows, Type>(*this) * Mat<OC, OR, Type>(other));
+            }
+        }
+
+        if constexpr (detail::UsesGemm<Columns, Rows, OC, Type, Representation, ORep>) {
+            if (!std::is_constant_evaluated()) {
+                Mat<OC, Rows, Type, Representation, Allocator> result;
+                simd::gemm(Rows, OC, Columns, toPointer(), Rows,
+                           other.toPointer(), OR, result.toPointer(), Rows);
+                return result;
+            }
+        }
+
+        if constexpr (std::is_same_v<Representation, MatDenseRep>) {
+            // Column c of the result is the sum of the columns of this matrix
+            // weighted by the values of the column c of the other one.
+            // Every column is streamed in order and no transposed copy is made.
+            Mat<OC, Rows, Type, Representation, Allocator> result;
+            for (size_t c = 0; c < OC; ++c) {
+                Type* out = result.rep.data[c].toPointer();
+                if constexpr (std::is_same_v<ORep, MatSparseRep>) {
+                    // Only the stored values of a sparse matrix contribute.
+                    for (size_t i = other.rep.cols[c]; i < other.rep.cols[c + 1]; ++i) {
+                        detail::addScaledColumn<Rows>(other.rep.vals[i],
+                                                      rep.data[other.rep.rows[i]].toPointer(), out);
+                    }
+                } else {
+                    for (size_t k = 0; k < Columns; ++k) {
+                        detail::addScaledColumn<Rows>(other(c, k), rep.data[k].toPointer(), out);
+                    }
+                }
+            }
+            return result;
+        } else if constexpr (std::is_same_v<ORep, MatSparseRep>) {
+            // Gustavson's algorithm. See sparseMultiplySymbolic().
+            Mat<OC, Rows, Type, Representation, Allocator> result;
+            sparseMultiplyNumeric(*this, other, sparseMultiplySymbolic(*this, other), result);
+            return result;
+        } else {
+            auto transposed = transpose();
+            return Mat<OC, Rows, Type, Representation, Allocator>(
+                [&](size_t c, size_t r) {
+                    return transposed.column(r).dot(other.column(c));
+                });
+        }
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     template<typename ORep, typename OAlloc>
-    bool Mat<Columns, Rows, Type, Representation, Allocator>::operator==(
+    constexpr bool Mat<Columns, Rows, Type, Representation, Allocator>::operator==(
         const Mat<Columns, Rows, Type, ORep, OAlloc>& other) const {
         if constexpr (std::is_same_v<Mat, Mat<Columns, Rows, Type, OAlloc>>) {
             if (this == &other) return true;
@@ -806,7 +1045,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
     template<typename ORep, typename OAlloc>
-    bool Mat<Columns, Rows, Type, Representation, Allocator>::operator!=(
+    constexpr bool Mat<Columns, Rows, Type, Representation, Allocator>::operator!=(
         const Mat<Columns, Rows, Type, ORep, OAlloc>& other) const {
         if constexpr (std::is_same_v<Mat, Mat<Columns, Rows, Type, OAlloc>>) {
             if (this == &other) return false;
@@ -816,75 +1055,75 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    auto Mat<Columns, Rows, Type, Representation, Allocator>::begin() {
+    constexpr auto Mat<Columns, Rows, Type, Representation, Allocator>::begin() {
         return rep.begin();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    auto Mat<Columns, Rows, Type, Representation, Allocator>::end() {
+    constexpr auto Mat<Columns, Rows, Type, Representation, Allocator>::end() {
         return rep.end();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    auto Mat<Columns, Rows, Type, Representation, Allocator>::cbegin() const {
+    constexpr auto Mat<Columns, Rows, Type, Representation, Allocator>::cbegin() const {
         return rep.cbegin();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    auto Mat<Columns, Rows, Type, Representation, Allocator>::cend() const {
+    constexpr auto Mat<Columns, Rows, Type, Representation, Allocator>::cend() const {
         return rep.cend();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    auto Mat<Columns, Rows, Type, Representation, Allocator>::rbegin() {
+    constexpr auto Mat<Columns, Rows, Type, Representation, Allocator>::rbegin() {
         return rep.rbegin();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    auto Mat<Columns, Rows, Type, Representation, Allocator>::rend() {
+    constexpr auto Mat<Columns, Rows, Type, Representation, Allocator>::rend() {
         return rep.rend();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    auto Mat<Columns, Rows, Type, Representation, Allocator>::crbegin() const {
+    constexpr auto Mat<Columns, Rows, Type, Representation, Allocator>::crbegin() const {
         return rep.crbegin();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    auto Mat<Columns, Rows, Type, Representation, Allocator>::crend() const {
+    constexpr auto Mat<Columns, Rows, Type, Representation, Allocator>::crend() const {
         return rep.crend();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    auto Mat<Columns, Rows, Type, Representation, Allocator>::sparseBegin() const {
+    constexpr auto Mat<Columns, Rows, Type, Representation, Allocator>::sparseBegin() const {
         return rep.sparseBegin();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    auto Mat<Columns, Rows, Type, Representation, Allocator>::sparseEnd() const {
+    constexpr auto Mat<Columns, Rows, Type, Representation, Allocator>::sparseEnd() const {
         return rep.sparseEnd();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    auto Mat<Columns, Rows, Type, Representation, Allocator>::reverseSparseBegin() const {
+    constexpr auto Mat<Columns, Rows, Type, Representation, Allocator>::reverseSparseBegin() const {
         return rep.reverseSparseBegin();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation, typename Allocator>
-    auto Mat<Columns, Rows, Type, Representation, Allocator>::reverseSparseEnd() const {
+    constexpr auto Mat<Columns, Rows, Type, Representation, Allocator>::reverseSparseEnd() const {
         return rep.reverseSparseEnd();
     }
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::translate(
         const Vec<3, Type>& t) requires (Columns == 4 && Rows == 4) {
         Type o = Type(1);
@@ -899,7 +1138,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::scale(
         const rush::Vec<3, Type>& s) requires (Columns == 4 && Rows == 4) {
         Type o = Type(1);
@@ -914,12 +1153,12 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::rotationX(Type radians)
         requires (
             Columns == 4 && Rows == 4) {
-        Type c = std::cos(radians);
-        Type s = std::sin(radians);
+        Type c = rush::cos(radians);
+        Type s = rush::sin(radians);
         Type o = Type(1);
         Type z = Type(0);
         return Mat(
@@ -932,12 +1171,12 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::rotationY(Type radians)
         requires (
             Columns == 4 && Rows == 4) {
-        Type c = std::cos(radians);
-        Type s = std::sin(radians);
+        Type c = rush::cos(radians);
+        Type s = rush::sin(radians);
         Type o = Type(1);
         Type z = Type(0);
         return Mat(
@@ -950,12 +1189,12 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::rotationZ(Type radians)
         requires (
             Columns == 4 && Rows == 4) {
-        Type c = std::cos(radians);
-        Type s = std::sin(radians);
+        Type c = rush::cos(radians);
+        Type s = rush::sin(radians);
         Type o = Type(1);
         Type z = Type(0);
         return Mat(
@@ -968,7 +1207,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::model(
         const Vec<3, Type>& s,
         const Quat<Type>& r,
@@ -997,7 +1236,7 @@ namespace rush {
 
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::normal(
         const Vec<3, Type>& s,
         const Quat<Type>& r) requires (
@@ -1029,7 +1268,7 @@ namespace rush {
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
     template<Hand H>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::lookAt(
         const Vec<3, Type>& origin,
         const Vec<3, Type>& direction,
@@ -1062,7 +1301,7 @@ namespace rush {
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
     template<Hand Hand, ProjectionFormat Format>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::frustum(
         Type left, Type right,
         Type bottom, Type top,
@@ -1111,7 +1350,7 @@ namespace rush {
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
     template<Hand Hand, ProjectionFormat Format>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::orthogonal(
         Type left, Type right,
         Type bottom, Type top,
@@ -1156,13 +1395,13 @@ namespace rush {
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
     template<Hand Hand, ProjectionFormat Format>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::perspective(Type fovY,
                                                                      Type aspectRatio,
                                                                      Type n,
                                                                      Type f) requires (
         Columns == 4 && Rows == 4) {
-        Type top = std::tan(fovY / Type(2)) * n;
+        Type top = rush::tan(fovY / Type(2)) * n;
         Type right = top * aspectRatio;
         return frustum<Hand, Format>(-right, right, -top, top, n, f);
     }
@@ -1170,11 +1409,11 @@ namespace rush {
     template<size_t Columns, size_t Rows, typename Type, typename Representation
         , typename Allocator>
     template<Hand Hand>
-    Mat<Columns, Rows, Type, Representation, Allocator>
+    constexpr Mat<Columns, Rows, Type, Representation, Allocator>
     Mat<Columns, Rows, Type, Representation, Allocator>::infinitePerspective(
         Type fovY, Type aspectRatio, Type n) requires (
         Columns == 4 && Rows == 4) {
-        Type top = std::tan(fovY / Type(2)) * n;
+        Type top = rush::tan(fovY / Type(2)) * n;
         Type right = top * aspectRatio;
 
         Mat m = Mat();
@@ -1193,6 +1432,22 @@ namespace rush {
 
         return m;
     }
+
+    template<size_t Columns, size_t Rows, size_t OC, typename Type,
+        typename Representation, typename Allocator, typename ORep, typename OAlloc>
+    Mat<OC, Rows, Type, Representation, Allocator>
+    multiply(const Mat<Columns, Rows, Type, Representation, Allocator>& a,
+             const Mat<OC, Columns, Type, ORep, OAlloc>& b,
+             size_t threads) requires (HasAdd<Type> && HasMul<Type>) {
+        if constexpr (detail::UsesGemm<Columns, Rows, OC, Type, Representation, ORep>) {
+            Mat<OC, Rows, Type, Representation, Allocator> result;
+            simd::gemm(Rows, OC, Columns, a.toPointer(), Rows,
+                       b.toPointer(), Columns, result.toPointer(), Rows, threads);
+            return result;
+        } else {
+            return a * b;
+        }
+    }
 }
 
 #endif //RUSH_MAT_IMPL_H
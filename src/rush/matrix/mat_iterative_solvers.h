@@ -0,0 +1,399 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_MAT_ITERATIVE_SOLVERS_H
+#define RUSH_MAT_ITERATIVE_SOLVERS_H
+
+#include <cmath>
+#include <vector>
+#include <type_traits>
+#include <rush/simd.h>
+#include <rush/matrix/mat_sparse_rep.h>
+#include <rush/matrix/mat_sparse_product.h>
+#include <rush/matrix/mat_preconditioners.h>
+
+namespace rush {
+    /**
+     * The parameters of an iterative solver.
+     *
+     * @tparam Type the type of the values of the system.
+     */
+    template<typename Type>
+    struct SolverOptions {
+        /**
+         * The solver stops when ||b - Ax|| <= tolerance * ||b||.
+         */
+        Type tolerance = static_cast<Type>(1e-8);
+
+        /**
+         * The maximum amount of iterations.
+         * Each iteration of GMRES is one step of its Arnoldi process.
+         */
+        size_t maxIterations = 1000;
+
+        /**
+         * The amount of iterations between GMRES restarts.
+         * GMRES stores restart + 1 vectors.
+         */
+        size_t restart = 30;
+
+        /**
+         * The maximum amount of threads used by the matrix-vector products.
+         * 0 uses all the hardware threads. See sparseMultiply().
+         */
+        size_t threads = 1;
+    };
+
+    /**
+     * The outcome of an iterative solver.
+     *
+     * @tparam Type the type of the values of the system.
+     */
+    template<typename Type>
+    struct SolverResult {
+        /**
+         * Whether the tolerance was reached.
+         */
+        bool converged = false;
+
+        /**
+         * The amount of iterations done.
+         */
+        size_t iterations = 0;
+
+        /**
+         * The relative residual ||b - Ax|| / ||b|| of the returned solution.
+         */
+        Type residual = static_cast<Type>(0);
+
+        /**
+         * The relative residual before the first iteration
+         * and after every iteration.
+         * GMRES reports the residual estimated by its least squares problem.
+         */
+        std::vector<Type> history;
+    };
+
+    namespace detail {
+        template<typename Type>
+        Type solverNorm(const Type* v, size_t n) {
+            return std::sqrt(simd::dot(v, v, n));
+        }
+
+        /**
+         * Computes r = b - A * x and returns ||r||.
+         */
+        template<size_t Size, typename Type, typename Allocator>
+        Type solverResidual(const Mat<Size, Size, Type, MatSparseRep, Allocator>& a,
+                            const Type* b, const Type* x, std::vector<Type>& r, size_t threads) {
+            sparseMultiplyInto(a, x, r.data(), threads);
+            for (size_t i = 0; i < Size; ++i) {
+                r[i] = b[i] - r[i];
+            }
+            return solverNorm(r.data(), Size);
+        }
+
+        /**
+         * Records the relative residual in the result and checks the tolerance.
+         */
+        template<typename Type>
+        bool solverRecord(SolverResult<Type>& result, Type norm, Type normB, Type tolerance) {
+            result.residual = norm / normB;
+            result.history.push_back(result.residual);
+            result.converged = result.residual <= tolerance;
+            return result.converged;
+        }
+    }
+
+    /**
+     * Solves the system Ax = b using the conjugate gradient method.
+     * <p>
+     * A and the preconditioner M must be symmetric and positive definite.
+     * The method stores five vectors of the size of the system,
+     * and every iteration costs one product A * p and one application of M.
+     *
+     * @param a the matrix of the system.
+     * @param b the right-hand side of the system.
+     * @param x the initial guess. The solution is stored here.
+     * @param options the tolerance, the iteration cap and the threads to use.
+     * @param preconditioner the preconditioner M. See IsPreconditioner.
+     * @return whether the method converged, the iterations done and the residual history.
+     */
+    template<size_t Size, typename Type, typename Allocator, typename BAlloc, typename XAlloc,
+        typename Preconditioner = IdentityPreconditioner<Size>>
+    SolverResult<Type> solveCg(const Mat<Size, Size, Type, MatSparseRep, Allocator>& a,
+                               const Vec<Size, Type, BAlloc>& b,
+                               Vec<Size, Type, XAlloc>& x,
+                               const SolverOptions<Type>& options = {},
+                               const Preconditioner& preconditioner = {})
+        requires std::is_floating_point_v<Type> && IsPreconditioner<Preconditioner, Type> {
+        constexpr Type ZERO = static_cast<Type>(0);
+        SolverResult<Type> result;
+        Type* xp = x.toPointer();
+
+        const Type* bp = b.toPointer();
+        Type normB = detail::solverNorm(bp, Size);
+        if (normB == ZERO) {
+            x = Vec<Size, Type, XAlloc>();
+            result.converged = true;
+            result.history.push_back(ZERO);
+            return result;
+        }
+
+        std::vector<Type> r(Size), z(Size), p(Size), ap(Size);
+        Type norm = detail::solverResidual(a, bp, xp, r, options.threads);
+        if (detail::solverRecord(result, norm, normB, options.tolerance)) return result;
+
+        preconditioner.apply(r.data(), z.data());
+        p = z;
+        Type rz = simd::dot(r.data(), z.data(), Size);
+        while (result.iterations < options.maxIterations) {
+            detail::sparseMultiplyInto(a, p.data(), ap.data(), options.threads);
+            Type pAp = simd::dot(p.data(), ap.data(), Size);
+            if (pAp == ZERO) break;
+
+            Type alpha = rz / pAp;
+            simd::axpy(alpha, p.data(), xp, Size);
+            simd::axpy(-alpha, ap.data(), r.data(), Size);
+            ++result.iterations;
+
+            if (detail::solverRecord(result, detail::solverNorm(r.data(), Size),
+                                     normB, options.tolerance)) break;
+
+            preconditioner.apply(r.data(), z.data());
+            Type rzNew = simd::dot(r.data(), z.data(), Size);
+            Type beta = rzNew / rz;
+            for (size_t i = 0; i < Size; ++i) {
+                p[i] = z[i] + beta * p[i];
+            }
+            rz = rzNew;
+        }
+
+        return result;
+    }
+
+    /**
+     * Solves the system Ax = b using the stabilized biconjugate gradient method.
+     * <p>
+     * A may be nonsymmetric.
+     * The preconditioner is applied from the right, so the reported residuals
+     * are the ones of the original system.
+     * The method stores nine vectors of the size of the system,
+     * and every iteration costs two matrix-vector products and two applications of M.
+     *
+     * @param a the matrix of the system.
+     * @param b the right-hand side of the system.
+     * @param x the initial guess. The solution is stored here.
+     * @param options the tolerance, the iteration cap and the threads to use.
+     * @param preconditioner the preconditioner M. See IsPreconditioner.
+     * @return whether the method converged, the iterations done and the residual history.
+     */
+    template<size_t Size, typename Type, typename Allocator, typename BAlloc, typename XAlloc,
+        typename Preconditioner = IdentityPreconditioner<Size>>
+    SolverResult<Type> solveBiCgStab(const Mat<Size, Size, Type, MatSparseRep, Allocator>& a,
+                                     const Vec<Size, Type, BAlloc>& b,
+                                     Vec<Size, Type, XAlloc>& x,
+                                     const SolverOptions<Type>& options = {},
+                                     const Preconditioner& preconditioner = {})
+        requires std::is_floating_point_v<Type> && IsPreconditioner<Preconditioner, Type> {
+        constexpr Type ZERO = static_cast<Type>(0);
+        SolverResult<Type> result;
+        Type* xp = x.toPointer();
+
+        const Type* bp = b.toPointer();
+        Type normB = detail::solverNorm(bp, Size);
+        if (normB == ZERO) {
+            x = Vec<Size, Type, XAlloc>();
+            result.converged = true;
+            result.history.push_back(ZERO);
+            return result;
+        }
+
+        std::vector<Type> r(Size), p(Size, ZERO), v(Size, ZERO), s(Size), t(Size);
+        std::vector<Type> pHat(Size), sHat(Size);
+        Type norm = detail::solverResidual(a, bp, xp, r, options.threads);
+        if (detail::solverRecord(result, norm, normB, options.tolerance)) return result;
+
+        std::vector<Type> shadow = r;
+        Type rho = static_cast<Type>(1);
+        Type alpha = static_cast<Type>(1);
+        Type omega = static_cast<Type>(1);
+
+        while (result.iterations < options.maxIterations) {
+            Type rhoNew = simd::dot(shadow.data(), r.data(), Size);
+            if (rhoNew == ZERO) break;
+
+            Type beta = rhoNew / rho * (alpha / omega);
+            for (size_t i = 0; i < Size; ++i) {
+                p[i] = r[i] + beta * (p[i] - omega * v[i]);
+            }
+
+            preconditioner.apply(p.data(), pHat.data());
+            detail::sparseMultiplyInto(a, pHat.data(), v.data(), options.threads);
+            Type shadowV = simd::dot(shadow.data(), v.data(), Size);
+            if (shadowV == ZERO) break;
+            alpha = rhoNew / shadowV;
+            rho = rhoNew;
+
+            for (size_t i = 0; i < Size; ++i) {
+                s[i] = r[i] - alpha * v[i];
+            }
+            simd::axpy(alpha, pHat.data(), xp, Size);
+            ++result.iterations;
+
+            Type normS = detail::solverNorm(s.data(), Size);
+            if (normS <= options.tolerance * normB) {
+                r = s;
+                detail::solverRecord(result, normS, normB, options.tolerance);
+                break;
+            }
+
+            preconditioner.apply(s.data(), sHat.data());
+            detail::sparseMultiplyInto(a, sHat.data(), t.data(), options.threads);
+            Type tt = simd::dot(t.data(), t.data(), Size);
+            omega = tt == ZERO ? ZERO : simd::dot(t.data(), s.data(), Size) / tt;
+
+            simd::axpy(omega, sHat.data(), xp, Size);
+            for (size_t i = 0; i < Size; ++i) {
+                r[i] = s[i] - omega * t[i];
+            }
+
+            Type normR = detail::solverNorm(r.data(), Size);
+            if (detail::solverRecord(result, normR, normB, options.tolerance)) break;
+            if (omega == ZERO) break;
+        }
+
+        return result;
+    }
+
+    /**
+     * Solves the system Ax = b using the restarted generalized minimal residual method.
+     * <p>
+     * A may be nonsymmetric.
+     * The preconditioner is applied from the right, so the reported residuals
+     * are the ones of the original system.
+     * The method stores options.restart + 1 basis vectors of the size of the system.
+     * Every iteration costs one matrix-vector product, one application of M, and orthogonalizes
+     * the new basis vector using the modified Gram-Schmidt process.
+     * The least squares problem is updated with Givens rotations,
+     * so the residual is known at every iteration without computing it.
+     *
+     * @param a the matrix of the system.
+     * @param b the right-hand side of the system.
+     * @param x the initial guess. The solution is stored here.
+     * @param options the tolerance, the iteration cap, the restart length and the threads to use.
+     * @param preconditioner the preconditioner M. See IsPreconditioner.
+     * @return whether the method converged, the iterations done and the residual history.
+     */
+    template<size_t Size, typename Type, typename Allocator, typename BAlloc, typename XAlloc,
+        typename Preconditioner = IdentityPreconditioner<Size>>
+    SolverResult<Type> solveGmres(const Mat<Size, Size, Type, MatSparseRep, Allocator>& a,
+                                  const Vec<Size, Type, BAlloc>& b,
+                                  Vec<Size, Type, XAlloc>& x,
+                                  const SolverOptions<Type>& options = {},
+                                  const Preconditioner& preconditioner = {})
+        requires std::is_floating_point_v<Type> && IsPreconditioner<Preconditioner, Type> {
+        constexpr Type ZERO = static_cast<Type>(0);
+        SolverResult<Type> result;
+        Type* xp = x.toPointer();
+
+        const Type* bp = b.toPointer();
+        Type normB = detail::solverNorm(bp, Size);
+        if (normB == ZERO) {
+            x = Vec<Size, Type, XAlloc>();
+            result.converged = true;
+            result.history.push_back(ZERO);
+            return result;
+        }
+
+        size_t m = std::max<size_t>(std::min(options.restart, Size), 1);
+        std::vector<Type> r(Size), z(Size), update(Size);
+        std::vector<Type> basis((m + 1) * Size);
+        // Hessenberg matrix, stored by columns of m + 1 values.
+        std::vector<Type> h((m + 1) * m);
+        std::vector<Type> cs(m), sn(m), g(m + 1), y(m);
+
+        Type norm = detail::solverResidual(a, bp, xp, r, options.threads);
+        if (detail::solverRecord(result, norm, normB, options.tolerance)) return result;
+
+        while (result.iterations < options.maxIterations) {
+            for (size_t i = 0; i < Size; ++i) {
+                basis[i] = r[i] / norm;
+            }
+            std::fill(g.begin(), g.end(), ZERO);
+            g[0] = norm;
+
+            size_t k = 0;
+            bool estimated = false;
+            bool breakdown = false;
+            while (k < m && !estimated && !breakdown && result.iterations < options.maxIterations) {
+                Type* w = basis.data() + (k + 1) * Size;
+                Type* column = h.data() + k * (m + 1);
+                preconditioner.apply(basis.data() + k * Size, z.data());
+                detail::sparseMultiplyInto(a, z.data(), w, options.threads);
+
+                for (size_t i = 0; i <= k; ++i) {
+                    const Type* vi = basis.data() + i * Size;
+                    column[i] = simd::dot(w, vi, Size);
+                    simd::axpy(-column[i], vi, w, Size);
+                }
+                Type normW = detail::solverNorm(w, Size);
+                column[k + 1] = normW;
+                if (normW != ZERO) {
+                    for (size_t i = 0; i < Size; ++i) {
+                        w[i] /= normW;
+                    }
+                }
+
+                for (size_t i = 0; i < k; ++i) {
+                    Type temp = cs[i] * column[i] + sn[i] * column[i + 1];
+                    column[i + 1] = -sn[i] * column[i] + cs[i] * column[i + 1];
+                    column[i] = temp;
+                }
+
+                Type denominator = std::hypot(column[k], column[k + 1]);
+                cs[k] = denominator == ZERO ? static_cast<Type>(1) : column[k] / denominator;
+                sn[k] = denominator == ZERO ? ZERO : column[k + 1] / denominator;
+                column[k] = denominator;
+                column[k + 1] = ZERO;
+                g[k + 1] = -sn[k] * g[k];
+                g[k] = cs[k] * g[k];
+
+                ++k;
+                ++result.iterations;
+                estimated = detail::solverRecord(result, std::abs(g[k]), normB, options.tolerance);
+                // The Krylov space is invariant: the solution cannot improve further.
+                breakdown = normW == ZERO;
+            }
+
+            // Solve the triangular system H y = g and add M⁻¹ V y to x.
+            for (size_t j = k; j > 0; --j) {
+                size_t i = j - 1;
+                Type sum = g[i];
+                for (size_t l = i + 1; l < k; ++l) {
+                    sum -= h[l * (m + 1) + i] * y[l];
+                }
+                Type diagonal = h[i * (m + 1) + i];
+                y[i] = diagonal == ZERO ? ZERO : sum / diagonal;
+            }
+            std::fill(update.begin(), update.end(), ZERO);
+            for (size_t i = 0; i < k; ++i) {
+                simd::axpy(y[i], basis.data() + i * Size, update.data(), Size);
+            }
+            preconditioner.apply(update.data(), z.data());
+            simd::axpy(static_cast<Type>(1), z.data(), xp, Size);
+
+            norm = detail::solverResidual(a, bp, xp, r, options.threads);
+            result.residual = norm / normB;
+            result.converged = result.residual <= options.tolerance;
+            // The estimated residual may differ from the true one due to rounding.
+            // If so, the method restarts from the true residual.
+            if (result.converged || breakdown) break;
+        }
+
+        return result;
+    }
+}
+
+#endif //RUSH_MAT_ITERATIVE_SOLVERS_H
@@ -0,0 +1,327 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_MAT_PRECONDITIONERS_H
+#define RUSH_MAT_PRECONDITIONERS_H
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <rush/matrix/mat_sparse_rep.h>
+
+namespace rush {
+    /**
+     * A preconditioner M of a system Ax = b.
+     * apply(r, z) computes z = M⁻¹ r, being r and z arrays
+     * of the size of the system. z must not be r.
+     */
+    template<typename P, typename Type>
+    concept IsPreconditioner = requires(const P& p, const Type* r, Type* z) {
+        p.apply(r, z);
+    };
+
+    /**
+     * The preconditioner that does nothing: M = I.
+     * This is the one used by the solvers when none is given.
+     *
+     * @tparam Size the size of the system.
+     */
+    template<size_t Size>
+    struct IdentityPreconditioner {
+        template<typename Type>
+        void apply(const Type* r, Type* z) const {
+            std::copy(r, r + Size, z);
+        }
+    };
+
+    /**
+     * The Jacobi preconditioner: M = diag(A).
+     * <p>
+     * Rows whose diagonal value is zero are left unscaled.
+     *
+     * @tparam Size the size of the system.
+     * @tparam Type the type of the values.
+     */
+    template<size_t Size, typename Type>
+    class JacobiPreconditioner {
+        std::vector<Type> _inverseDiagonal;
+
+    public:
+        /**
+         * Creates the preconditioner of the given matrix.
+         * @param a the matrix of the system.
+         */
+        template<typename Allocator>
+        explicit JacobiPreconditioner(const Mat<Size, Size, Type, MatSparseRep, Allocator>& a)
+            : _inverseDiagonal(Size, static_cast<Type>(1)) {
+            for (size_t c = 0; c < Size; ++c) {
+                for (size_t p = a.rep.cols[c]; p < a.rep.cols[c + 1]; ++p) {
+                    if (a.rep.rows[p] == c) {
+                        _inverseDiagonal[c] = static_cast<Type>(1) / a.rep.vals[p];
+                        break;
+                    }
+                }
+            }
+        }
+
+        void apply(const Type* r, Type* z) const {
+            for (size_t i = 0; i < Size; ++i) {
+                z[i] = r[i] * _inverseDiagonal[i];
+            }
+        }
+
+        template<typename RAlloc, typename ZAlloc>
+        void apply(const Vec<Size, Type, RAlloc>& r, Vec<Size, Type, ZAlloc>& z) const {
+            apply(r.toPointer(), z.toPointer());
+        }
+    };
+
+    /**
+     * The incomplete LU factorization with zero fill-in: M = LU,
+     * being L unit lower triangular and U upper triangular.
+     * <p>
+     * L and U are computed like in sparseLUDecompose(), but every value
+     * outside the pattern of A is dropped. Both factors are stored in the
+     * cols and rows arrays of A, so they take as much memory as A.
+     * <p>
+     * The factorization fails if a diagonal value is missing or becomes zero.
+     * See valid().
+     *
+     * @tparam Size the size of the system.
+     * @tparam Type the type of the values.
+     */
+    template<size_t Size, typename Type>
+    class IluPreconditioner {
+        Mat<Size, Size, Type, MatSparseRep> _factors;
+        std::vector<size_t> _diagonal;
+        bool _valid;
+
+    public:
+        /**
+         * Factorizes the given matrix.
+         * The rows of every column must be sorted, as done by Mat and SparseBuilder.
+         * @param a the matrix of the system.
+         */
+        template<typename Allocator>
+        explicit IluPreconditioner(const Mat<Size, Size, Type, MatSparseRep, Allocator>& a)
+            : _diagonal(Size), _valid(true) {
+            constexpr Type ZERO = static_cast<Type>(0);
+            _factors.rep.cols = a.rep.cols;
+            _factors.rep.rows = a.rep.rows;
+            _factors.rep.vals = a.rep.vals;
+
+            auto& cols = _factors.rep.cols;
+            auto& rows = _factors.rep.rows;
+            auto& vals = _factors.rep.vals;
+
+            // The position of each row inside the current column, or vals.size() if absent.
+            std::vector<size_t> position(Size, vals.size());
+
+            for (size_t j = 0; j < Size && _valid; ++j) {
+                for (size_t p = cols[j]; p < cols[j + 1]; ++p) {
+                    position[rows[p]] = p;
+                }
+
+                // Left-looking update: U(k, j) is final once every k' < k is applied.
+                size_t p = cols[j];
+                for (; p < cols[j + 1] && rows[p] < j; ++p) {
+                    size_t k = rows[p];
+                    Type ukj = vals[p];
+                    for (size_t q = _diagonal[k] + 1; q < cols[k + 1]; ++q) {
+                        size_t target = position[rows[q]];
+                        if (target != vals.size()) {
+                            vals[target] -= vals[q] * ukj;
+                        }
+                    }
+                }
+
+                if (p == cols[j + 1] || rows[p] != j || vals[p] == ZERO) {
+                    _valid = false;
+                } else {
+                    _diagonal[j] = p;
+                    Type inverse = static_cast<Type>(1) / vals[p];
+                    for (++p; p < cols[j + 1]; ++p) {
+                        vals[p] *= inverse;
+                    }
+                }
+
+                for (size_t q = cols[j]; q < cols[j + 1]; ++q) {
+                    position[rows[q]] = vals.size();
+                }
+            }
+        }
+
+        /**
+         * @return whether the factorization succeeded.
+         * Applying an invalid preconditioner produces undefined values.
+         */
+        [[nodiscard]] bool valid() const {
+            return _valid;
+        }
+
+        /**
+         * @return L and U stored in the pattern of A.
+         * The unit diagonal of L is not stored.
+         */
+        [[nodiscard]] const Mat<Size, Size, Type, MatSparseRep>& factors() const {
+            return _factors;
+        }
+
+        void apply(const Type* r, Type* z) const {
+            const auto& cols = _factors.rep.cols;
+            const auto& rows = _factors.rep.rows;
+            const auto& vals = _factors.rep.vals;
+            std::copy(r, r + Size, z);
+
+            // L y = r, by columns.
+            for (size_t j = 0; j < Size; ++j) {
+                Type yj = z[j];
+                for (size_t p = _diagonal[j] + 1; p < cols[j + 1]; ++p) {
+                    z[rows[p]] -= vals[p] * yj;
+                }
+            }
+
+            // U z = y, by columns.
+            for (size_t j = Size; j > 0; --j) {
+                size_t c = j - 1;
+                Type zc = z[c] / vals[_diagonal[c]];
+                z[c] = zc;
+                for (size_t p = cols[c]; p < _diagonal[c]; ++p) {
+                    z[rows[p]] -= vals[p] * zc;
+                }
+            }
+        }
+
+        template<typename RAlloc, typename ZAlloc>
+        void apply(const Vec<Size, Type, RAlloc>& r, Vec<Size, Type, ZAlloc>& z) const {
+            apply(r.toPointer(), z.toPointer());
+        }
+    };
+
+    /**
+     * The incomplete Cholesky factorization with zero fill-in: M = LLᵀ.
+     * <p>
+     * A must be symmetric positive definite.
+     * Only its lower triangle is read, and L keeps its pattern.
+     * <p>
+     * The factorization fails if a diagonal value is missing
+     * or a pivot is not positive. See valid().
+     *
+     * @tparam Size the size of the system.
+     * @tparam Type the type of the values.
+     */
+    template<size_t Size, typename Type>
+    class IcPreconditioner {
+        Mat<Size, Size, Type, MatSparseRep> _factor;
+        bool _valid;
+
+    public:
+        /**
+         * Factorizes the given matrix.
+         * The rows of every column must be sorted, as done by Mat and SparseBuilder.
+         * @param a the matrix of the system.
+         */
+        template<typename Allocator>
+        explicit IcPreconditioner(const Mat<Size, Size, Type, MatSparseRep, Allocator>& a)
+            : _valid(true) {
+            constexpr Type ZERO = static_cast<Type>(0);
+            auto& cols = _factor.rep.cols;
+            auto& rows = _factor.rep.rows;
+            auto& vals = _factor.rep.vals;
+
+            // Copy the lower triangle. The diagonal becomes the first value of each column.
+            cols[0] = 0;
+            for (size_t j = 0; j < Size; ++j) {
+                size_t p = a.rep.cols[j];
+                while (p < a.rep.cols[j + 1] && a.rep.rows[p] < j) ++p;
+                if (p == a.rep.cols[j + 1] || a.rep.rows[p] != j) {
+                    _valid = false;
+                    return;
+                }
+                for (; p < a.rep.cols[j + 1]; ++p) {
+                    rows.push_back(a.rep.rows[p]);
+                    vals.push_back(a.rep.vals[p]);
+                }
+                cols[j + 1] = vals.size();
+            }
+
+            // Right-looking factorization restricted to the pattern.
+            for (size_t k = 0; k < Size; ++k) {
+                Type pivot = vals[cols[k]];
+                if (!(pivot > ZERO)) {
+                    _valid = false;
+                    return;
+                }
+                Type diagonal = std::sqrt(pivot);
+                vals[cols[k]] = diagonal;
+                for (size_t p = cols[k] + 1; p < cols[k + 1]; ++p) {
+                    vals[p] /= diagonal;
+                }
+
+                // L(i, j) -= L(i, k) * L(j, k) for every i >= j > k inside both patterns.
+                for (size_t p = cols[k] + 1; p < cols[k + 1]; ++p) {
+                    size_t j = rows[p];
+                    Type ljk = vals[p];
+                    size_t q = cols[j];
+                    for (size_t s = p; s < cols[k + 1]; ++s) {
+                        size_t i = rows[s];
+                        while (q < cols[j + 1] && rows[q] < i) ++q;
+                        if (q == cols[j + 1]) break;
+                        if (rows[q] == i) {
+                            vals[q] -= vals[s] * ljk;
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @return whether the factorization succeeded.
+         * Applying an invalid preconditioner produces undefined values.
+         */
+        [[nodiscard]] bool valid() const {
+            return _valid;
+        }
+
+        /**
+         * @return L, whose columns start with their diagonal value.
+         */
+        [[nodiscard]] const Mat<Size, Size, Type, MatSparseRep>& factor() const {
+            return _factor;
+        }
+
+        void apply(const Type* r, Type* z) const {
+            const auto& cols = _factor.rep.cols;
+            const auto& rows = _factor.rep.rows;
+            const auto& vals = _factor.rep.vals;
+            std::copy(r, r + Size, z);
+
+            // L y = r, by columns.
+            for (size_t j = 0; j < Size; ++j) {
+                Type yj = z[j] / vals[cols[j]];
+                z[j] = yj;
+                for (size_t p = cols[j] + 1; p < cols[j + 1]; ++p) {
+                    z[rows[p]] -= vals[p] * yj;
+                }
+            }
+
+            // Lᵀ z = y. Row j of Lᵀ is column j of L.
+            for (size_t j = Size; j > 0; --j) {
+                size_t c = j - 1;
+                Type sum = z[c];
+                for (size_t p = cols[c] + 1; p < cols[c + 1]; ++p) {
+                    sum -= vals[p] * z[rows[p]];
+                }
+                z[c] = sum / vals[cols[c]];
+            }
+        }
+
+        template<typename RAlloc, typename ZAlloc>
+        void apply(const Vec<Size, Type, RAlloc>& r, Vec<Size, Type, ZAlloc>& z) const {
+            apply(r.toPointer(), z.toPointer());
+        }
+    };
+}
+
+#endif //RUSH_MAT_PRECONDITIONERS_H
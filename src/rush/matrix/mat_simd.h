@@ -0,0 +1,510 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_MAT_SIMD_H
+#define RUSH_MAT_SIMD_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include <rush/algorithm.h>
+#include <rush/cpu.h>
+#include <rush/simd.h>
+
+namespace rush::simd {
+    /**
+     * Whether the operations of a dense Mat<4, 4, Type> should be
+     * computed using the kernels defined in this file.
+     * <p>
+     * The kernels read the matrix as a flat array of 16 values,
+     * column after column.
+     * Float matrices have SSE4 and AVX2 kernels.
+     * Double matrices only have AVX2 kernels: a column of four doubles
+     * fills a whole AVX register. On SSE4 CPUs they fall back to
+     * the generic implementation.
+     *
+     * @tparam Type the type of the matrix.
+     */
+    template<typename Type>
+    constexpr bool HasMat4Kernel = Algorithm().useIntrinsics() &&
+                                   HasBulkKernel<Type>;
+
+#ifdef RUSH_DISPATCH
+
+    namespace detail {
+        // REGION FOUR-LANE REGISTER OPERATIONS
+
+        // The inverse works on 2x2 blocks stored as four-lane registers.
+        // These structs provide the shuffles it needs for both
+        // a __m128 of floats and a __m256d of doubles.
+
+        struct Mat4SSE4 {
+            using Reg = __m128;
+
+            RUSH_TARGET_SSE4 static Reg load(const float* p) { return _mm_loadu_ps(p); }
+            RUSH_TARGET_SSE4 static void store(float* p, Reg v) { _mm_storeu_ps(p, v); }
+            RUSH_TARGET_SSE4 static Reg set(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+            RUSH_TARGET_SSE4 static Reg add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+            RUSH_TARGET_SSE4 static Reg sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+            RUSH_TARGET_SSE4 static Reg mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+            RUSH_TARGET_SSE4 static Reg div(Reg a, Reg b) { return _mm_div_ps(a, b); }
+            RUSH_TARGET_SSE4 static float first(Reg v) { return _mm_cvtss_f32(v); }
+
+            /**
+             * Returns the lanes (a[X], a[Y], b[Z], b[W]).
+             */
+            template<int X, int Y, int Z, int W>
+            RUSH_TARGET_SSE4 static Reg shuffle(Reg a, Reg b) {
+                return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+            }
+
+            template<int X, int Y, int Z, int W>
+            RUSH_TARGET_SSE4 static Reg swizzle(Reg v) {
+                return shuffle<X, Y, Z, W>(v, v);
+            }
+
+            /**
+             * Returns a register with the sum of all lanes in every lane.
+             */
+            RUSH_TARGET_SSE4 static Reg sum(Reg v) {
+                v = _mm_hadd_ps(v, v);
+                return _mm_hadd_ps(v, v);
+            }
+
+            RUSH_TARGET_SSE4 static void transpose(Reg& c0, Reg& c1, Reg& c2, Reg& c3) {
+                _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+            }
+        };
+
+        struct Mat4AVX2 {
+            using Reg = __m256d;
+
+            RUSH_TARGET_AVX2 static Reg load(const double* p) { return _mm256_loadu_pd(p); }
+            RUSH_TARGET_AVX2 static void store(double* p, Reg v) { _mm256_storeu_pd(p, v); }
+            RUSH_TARGET_AVX2 static Reg set(double x, double y, double z, double w) { return _mm256_setr_pd(x, y, z, w); }
+            RUSH_TARGET_AVX2 static Reg add(Reg a, Reg b) { return _mm256_add_pd(a, b); }
+            RUSH_TARGET_AVX2 static Reg sub(Reg a, Reg b) { return _mm256_sub_pd(a, b); }
+            RUSH_TARGET_AVX2 static Reg mul(Reg a, Reg b) { return _mm256_mul_pd(a, b); }
+            RUSH_TARGET_AVX2 static Reg div(Reg a, Reg b) { return _mm256_div_pd(a, b); }
+            RUSH_TARGET_AVX2 static double first(Reg v) { return _mm256_cvtsd_f64(v); }
+
+            template<int X, int Y, int Z, int W>
+            RUSH_TARGET_AVX2 static Reg swizzle(Reg v) {
+                return _mm256_permute4x64_pd(v, _MM_SHUFFLE(W, Z, Y, X));
+            }
+
+            /**
+             * Returns the lanes (a[X], a[Y], b[Z], b[W]).
+             */
+            template<int X, int Y, int Z, int W>
+            RUSH_TARGET_AVX2 static Reg shuffle(Reg a, Reg b) {
+                if constexpr (X == 0 && Y == 1 && Z == 0 && W == 1) {
+                    return _mm256_permute2f128_pd(a, b, 0x20);
+                } else if constexpr (X == 2 && Y == 3 && Z == 2 && W == 3) {
+                    return _mm256_permute2f128_pd(a, b, 0x31);
+                } else {
+                    Reg low = swizzle<X, Y, X, Y>(a);
+                    Reg high = swizzle<Z, W, Z, W>(b);
+                    return _mm256_blend_pd(low, high, 0b1100);
+                }
+            }
+
+            RUSH_TARGET_AVX2 static Reg sum(Reg v) {
+                v = _mm256_hadd_pd(v, v);
+                return _mm256_add_pd(v, _mm256_permute2f128_pd(v, v, 0x01));
+            }
+
+            RUSH_TARGET_AVX2 static void transpose(Reg& c0, Reg& c1, Reg& c2, Reg& c3) {
+                __m256d t0 = _mm256_unpacklo_pd(c0, c1);
+                __m256d t1 = _mm256_unpackhi_pd(c0, c1);
+                __m256d t2 = _mm256_unpacklo_pd(c2, c3);
+                __m256d t3 = _mm256_unpackhi_pd(c2, c3);
+                c0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+                c1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+                c2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+                c3 = _mm256_permute2f128_pd(t1, t3, 0x31);
+            }
+        };
+
+        // ENDREGION
+
+        // REGION BLOCK INVERSE
+
+        // The inverse splits the matrix into four 2x2 blocks
+        //     | A B |
+        //     | C D |
+        // and computes the adjugate of each block of the inverse using
+        // 2x2 products. Each block is stored in a register as (m00, m01, m10, m11).
+        // The inverse of the transposed matrix is the transposed inverse,
+        // so it does not matter whether the columns are read as rows.
+        // See https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+
+        // The kernels below are written once per instruction set,
+        // as their target must match the one of the operations they use.
+
+        RUSH_TARGET_SSE4 inline float inverseSSE4(const float* m, float* out) {
+            using O = Mat4SSE4;
+            auto c0 = O::load(m), c1 = O::load(m + 4), c2 = O::load(m + 8), c3 = O::load(m + 12);
+
+            auto a = O::shuffle<0, 1, 0, 1>(c0, c1);
+            auto b = O::shuffle<2, 3, 2, 3>(c0, c1);
+            auto c = O::shuffle<0, 1, 0, 1>(c2, c3);
+            auto d = O::shuffle<2, 3, 2, 3>(c2, c3);
+
+            // (|A|, |B|, |C|, |D|)
+            auto dets = O::sub(
+                O::mul(O::shuffle<0, 2, 0, 2>(c0, c2), O::shuffle<1, 3, 1, 3>(c1, c3)),
+                O::mul(O::shuffle<1, 3, 1, 3>(c0, c2), O::shuffle<0, 2, 0, 2>(c1, c3)));
+            auto detA = O::swizzle<0, 0, 0, 0>(dets);
+            auto detB = O::swizzle<1, 1, 1, 1>(dets);
+            auto detC = O::swizzle<2, 2, 2, 2>(dets);
+            auto detD = O::swizzle<3, 3, 3, 3>(dets);
+
+            // Adj(A) * B and Adj(D) * C
+            auto adjAB = O::sub(O::mul(O::swizzle<3, 3, 0, 0>(a), b),
+                                O::mul(O::swizzle<1, 1, 2, 2>(a), O::swizzle<2, 3, 0, 1>(b)));
+            auto adjDC = O::sub(O::mul(O::swizzle<3, 3, 0, 0>(d), c),
+                                O::mul(O::swizzle<1, 1, 2, 2>(d), O::swizzle<2, 3, 0, 1>(c)));
+
+            // X = |D| A - B Adj(D) C
+            auto x = O::sub(O::mul(detD, a),
+                            O::add(O::mul(b, O::swizzle<0, 3, 0, 3>(adjDC)),
+                                   O::mul(O::swizzle<1, 0, 3, 2>(b), O::swizzle<2, 1, 2, 1>(adjDC))));
+            // W = |A| D - C Adj(A) B
+            auto w = O::sub(O::mul(detA, d),
+                            O::add(O::mul(c, O::swizzle<0, 3, 0, 3>(adjAB)),
+                                   O::mul(O::swizzle<1, 0, 3, 2>(c), O::swizzle<2, 1, 2, 1>(adjAB))));
+            // Y = |B| C - D Adj(Adj(A) B)
+            auto y = O::sub(O::mul(detB, c),
+                            O::sub(O::mul(d, O::swizzle<3, 0, 3, 0>(adjAB)),
+                                   O::mul(O::swizzle<1, 0, 3, 2>(d), O::swizzle<2, 1, 2, 1>(adjAB))));
+            // Z = |C| B - A Adj(Adj(D) C)
+            auto z = O::sub(O::mul(detC, b),
+                            O::sub(O::mul(a, O::swizzle<3, 0, 3, 0>(adjDC)),
+                                   O::mul(O::swizzle<1, 0, 3, 2>(a), O::swizzle<2, 1, 2, 1>(adjDC))));
+
+            // |M| = |A| |D| + |B| |C| - tr(Adj(A) B Adj(D) C)
+            auto trace = O::sum(O::mul(adjAB, O::swizzle<0, 2, 1, 3>(adjDC)));
+            auto det = O::sub(O::add(O::mul(detA, detD), O::mul(detB, detC)), trace);
+            if (out == nullptr) return O::first(det);
+
+            auto inverseDet = O::div(O::set(1.0f, -1.0f, -1.0f, 1.0f), det);
+            x = O::mul(x, inverseDet);
+            y = O::mul(y, inverseDet);
+            z = O::mul(z, inverseDet);
+            w = O::mul(w, inverseDet);
+
+            // Applies the adjugate of each block while storing it.
+            O::store(out, O::shuffle<3, 1, 3, 1>(x, y));
+            O::store(out + 4, O::shuffle<2, 0, 2, 0>(x, y));
+            O::store(out + 8, O::shuffle<3, 1, 3, 1>(z, w));
+            O::store(out + 12, O::shuffle<2, 0, 2, 0>(z, w));
+            return O::first(det);
+        }
+
+        RUSH_TARGET_AVX2 inline double inverseAVX2(const double* m, double* out) {
+            using O = Mat4AVX2;
+            auto c0 = O::load(m), c1 = O::load(m + 4), c2 = O::load(m + 8), c3 = O::load(m + 12);
+
+            auto a = O::shuffle<0, 1, 0, 1>(c0, c1);
+            auto b = O::shuffle<2, 3, 2, 3>(c0, c1);
+            auto c = O::shuffle<0, 1, 0, 1>(c2, c3);
+            auto d = O::shuffle<2, 3, 2, 3>(c2, c3);
+
+            // (|A|, |B|, |C|, |D|)
+            auto dets = O::sub(
+                O::mul(O::shuffle<0, 2, 0, 2>(c0, c2), O::shuffle<1, 3, 1, 3>(c1, c3)),
+                O::mul(O::shuffle<1, 3, 1, 3>(c0, c2), O::shuffle<0, 2, 0, 2>(c1, c3)));
+            auto detA = O::swizzle<0, 0, 0, 0>(dets);
+            auto detB = O::swizzle<1, 1, 1, 1>(dets);
+            auto detC = O::swizzle<2, 2, 2, 2>(dets);
+            auto detD = O::swizzle<3, 3, 3, 3>(dets);
+
+            // Adj(A) * B and Adj(D) * C
+            auto adjAB = O::sub(O::mul(O::swizzle<3, 3, 0, 0>(a), b),
+                                O::mul(O::swizzle<1, 1, 2, 2>(a), O::swizzle<2, 3, 0, 1>(b)));
+            auto adjDC = O::sub(O::mul(O::swizzle<3, 3, 0, 0>(d), c),
+                                O::mul(O::swizzle<1, 1, 2, 2>(d), O::swizzle<2, 3, 0, 1>(c)));
+
+            // X = |D| A - B Adj(D) C
+            auto x = O::sub(O::mul(detD, a),
+                            O::add(O::mul(b, O::swizzle<0, 3, 0, 3>(adjDC)),
+                                   O::mul(O::swizzle<1, 0, 3, 2>(b), O::swizzle<2, 1, 2, 1>(adjDC))));
+            // W = |A| D - C Adj(A) B
+            auto w = O::sub(O::mul(detA, d),
+                            O::add(O::mul(c, O::swizzle<0, 3, 0, 3>(adjAB)),
+                                   O::mul(O::swizzle<1, 0, 3, 2>(c), O::swizzle<2, 1, 2, 1>(adjAB))));
+            // Y = |B| C - D Adj(Adj(A) B)
+            auto y = O::sub(O::mul(detB, c),
+                            O::sub(O::mul(d, O::swizzle<3, 0, 3, 0>(adjAB)),
+                                   O::mul(O::swizzle<1, 0, 3, 2>(d), O::swizzle<2, 1, 2, 1>(adjAB))));
+            // Z = |C| B - A Adj(Adj(D) C)
+            auto z = O::sub(O::mul(detC, b),
+                            O::sub(O::mul(a, O::swizzle<3, 0, 3, 0>(adjDC)),
+                                   O::mul(O::swizzle<1, 0, 3, 2>(a), O::swizzle<2, 1, 2, 1>(adjDC))));
+
+            // |M| = |A| |D| + |B| |C| - tr(Adj(A) B Adj(D) C)
+            auto trace = O::sum(O::mul(adjAB, O::swizzle<0, 2, 1, 3>(adjDC)));
+            auto det = O::sub(O::add(O::mul(detA, detD), O::mul(detB, detC)), trace);
+            if (out == nullptr) return O::first(det);
+
+            auto inverseDet = O::div(O::set(1.0, -1.0, -1.0, 1.0), det);
+            x = O::mul(x, inverseDet);
+            y = O::mul(y, inverseDet);
+            z = O::mul(z, inverseDet);
+            w = O::mul(w, inverseDet);
+
+            // Applies the adjugate of each block while storing it.
+            O::store(out, O::shuffle<3, 1, 3, 1>(x, y));
+            O::store(out + 4, O::shuffle<2, 0, 2, 0>(x, y));
+            O::store(out + 8, O::shuffle<3, 1, 3, 1>(z, w));
+            O::store(out + 12, O::shuffle<2, 0, 2, 0>(z, w));
+            return O::first(det);
+        }
+
+        // ENDREGION
+
+        // REGION PRODUCTS
+
+        // Column j of the product is the sum of the columns of the left
+        // matrix weighted by the components of the column j of the right one.
+        // No transposition is needed.
+        // The AVX2 kernels use fused multiply-adds, so their results
+        // may differ from the SSE4 ones in the last bit.
+
+        RUSH_TARGET_SSE4 inline __m128 mulColumnSSE4(__m128 c0, __m128 c1, __m128 c2, __m128 c3,
+                                                     __m128 v) {
+            __m128 low = _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v, v, 0x00)),
+                                    _mm_mul_ps(c1, _mm_shuffle_ps(v, v, 0x55)));
+            __m128 high = _mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(v, v, 0xAA)),
+                                     _mm_mul_ps(c3, _mm_shuffle_ps(v, v, 0xFF)));
+            return _mm_add_ps(low, high);
+        }
+
+        RUSH_TARGET_SSE4 inline void mulSSE4(const float* a, const float* b, float* out) {
+            __m128 c0 = _mm_loadu_ps(a), c1 = _mm_loadu_ps(a + 4);
+            __m128 c2 = _mm_loadu_ps(a + 8), c3 = _mm_loadu_ps(a + 12);
+            __m128 r0 = mulColumnSSE4(c0, c1, c2, c3, _mm_loadu_ps(b));
+            __m128 r1 = mulColumnSSE4(c0, c1, c2, c3, _mm_loadu_ps(b + 4));
+            __m128 r2 = mulColumnSSE4(c0, c1, c2, c3, _mm_loadu_ps(b + 8));
+            __m128 r3 = mulColumnSSE4(c0, c1, c2, c3, _mm_loadu_ps(b + 12));
+            _mm_storeu_ps(out, r0);
+            _mm_storeu_ps(out + 4, r1);
+            _mm_storeu_ps(out + 8, r2);
+            _mm_storeu_ps(out + 12, r3);
+        }
+
+        RUSH_TARGET_AVX2 inline __m256 mulColumnsAVX2(__m256 c0, __m256 c1, __m256 c2, __m256 c3,
+                                                      __m256 v) {
+            __m256 low = _mm256_fmadd_ps(c1, _mm256_shuffle_ps(v, v, 0x55),
+                                         _mm256_mul_ps(c0, _mm256_shuffle_ps(v, v, 0x00)));
+            __m256 high = _mm256_fmadd_ps(c3, _mm256_shuffle_ps(v, v, 0xFF),
+                                          _mm256_mul_ps(c2, _mm256_shuffle_ps(v, v, 0xAA)));
+            return _mm256_add_ps(low, high);
+        }
+
+        RUSH_TARGET_AVX2 inline void mulAVX2(const float* a, const float* b, float* out) {
+            // Two columns of the result are computed at once:
+            // every column of the left matrix is duplicated in both halves.
+            __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a));
+            __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 4));
+            __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 8));
+            __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 12));
+            __m256 r01 = mulColumnsAVX2(c0, c1, c2, c3, _mm256_loadu_ps(b));
+            __m256 r23 = mulColumnsAVX2(c0, c1, c2, c3, _mm256_loadu_ps(b + 8));
+            _mm256_storeu_ps(out, r01);
+            _mm256_storeu_ps(out + 8, r23);
+        }
+
+        RUSH_TARGET_AVX2 inline __m256d mulColumnAVX2(__m256d c0, __m256d c1, __m256d c2, __m256d c3,
+                                                      const double* v) {
+            __m256d low = _mm256_fmadd_pd(c1, _mm256_broadcast_sd(v + 1),
+                                          _mm256_mul_pd(c0, _mm256_broadcast_sd(v)));
+            __m256d high = _mm256_fmadd_pd(c3, _mm256_broadcast_sd(v + 3),
+                                           _mm256_mul_pd(c2, _mm256_broadcast_sd(v + 2)));
+            return _mm256_add_pd(low, high);
+        }
+
+        RUSH_TARGET_AVX2 inline void mulAVX2(const double* a, const double* b, double* out) {
+            __m256d c0 = _mm256_loadu_pd(a), c1 = _mm256_loadu_pd(a + 4);
+            __m256d c2 = _mm256_loadu_pd(a + 8), c3 = _mm256_loadu_pd(a + 12);
+            __m256d r0 = mulColumnAVX2(c0, c1, c2, c3, b);
+            __m256d r1 = mulColumnAVX2(c0, c1, c2, c3, b + 4);
+            __m256d r2 = mulColumnAVX2(c0, c1, c2, c3, b + 8);
+            __m256d r3 = mulColumnAVX2(c0, c1, c2, c3, b + 12);
+            _mm256_storeu_pd(out, r0);
+            _mm256_storeu_pd(out + 4, r1);
+            _mm256_storeu_pd(out + 8, r2);
+            _mm256_storeu_pd(out + 12, r3);
+        }
+
+        RUSH_TARGET_SSE4 inline void mulVecSSE4(const float* a, const float* v, float* out) {
+            _mm_storeu_ps(out, mulColumnSSE4(_mm_loadu_ps(a), _mm_loadu_ps(a + 4),
+                                             _mm_loadu_ps(a + 8), _mm_loadu_ps(a + 12),
+                                             _mm_loadu_ps(v)));
+        }
+
+        RUSH_TARGET_AVX2 inline void mulVecAVX2(const double* a, const double* v, double* out) {
+            _mm256_storeu_pd(out, mulColumnAVX2(_mm256_loadu_pd(a), _mm256_loadu_pd(a + 4),
+                                                _mm256_loadu_pd(a + 8), _mm256_loadu_pd(a + 12), v));
+        }
+
+        // ENDREGION
+
+        RUSH_TARGET_SSE4 inline void transposeSSE4(const float* m, float* out) {
+            using O = Mat4SSE4;
+            auto c0 = O::load(m), c1 = O::load(m + 4), c2 = O::load(m + 8), c3 = O::load(m + 12);
+            O::transpose(c0, c1, c2, c3);
+            O::store(out, c0);
+            O::store(out + 4, c1);
+            O::store(out + 8, c2);
+            O::store(out + 12, c3);
+        }
+
+        RUSH_TARGET_AVX2 inline void transposeAVX2(const double* m, double* out) {
+            using O = Mat4AVX2;
+            auto c0 = O::load(m), c1 = O::load(m + 4), c2 = O::load(m + 8), c3 = O::load(m + 12);
+            O::transpose(c0, c1, c2, c3);
+            O::store(out, c0);
+            O::store(out + 4, c1);
+            O::store(out + 8, c2);
+            O::store(out + 12, c3);
+        }
+    }
+
+#endif
+
+    // REGION DISPATCH
+
+    // Each function returns false when the current instruction set
+    // has no kernel for the given type. The caller must then
+    // compute the result using its generic implementation.
+
+    /**
+     * Computes out = a * b, being a, b and out column-major 4x4 matrices.
+     * out may alias a or b.
+     */
+    template<typename Type>
+    inline bool mat4Mul(const Type* a, const Type* b, Type* out) {
+#ifdef RUSH_DISPATCH
+        if constexpr (HasMat4Kernel<Type>) {
+            switch (cpu::instructionSet()) {
+                case InstructionSet::AVX512:
+                case InstructionSet::AVX2:
+                    detail::mulAVX2(a, b, out);
+                    return true;
+                case InstructionSet::SSE4:
+                    if constexpr (std::is_same_v<Type, float>) {
+                        detail::mulSSE4(a, b, out);
+                        return true;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+#endif
+        return false;
+    }
+
+    /**
+     * Computes out = m * v, being m a column-major 4x4 matrix
+     * and v and out four-component vectors.
+     */
+    template<typename Type>
+    inline bool mat4MulVec(const Type* m, const Type* v, Type* out) {
+#ifdef RUSH_DISPATCH
+        if constexpr (HasMat4Kernel<Type>) {
+            switch (cpu::instructionSet()) {
+                case InstructionSet::AVX512:
+                case InstructionSet::AVX2:
+                    if constexpr (std::is_same_v<Type, float>) {
+                        detail::mulVecSSE4(m, v, out);
+                    } else {
+                        detail::mulVecAVX2(m, v, out);
+                    }
+                    return true;
+                case InstructionSet::SSE4:
+                    if constexpr (std::is_same_v<Type, float>) {
+                        detail::mulVecSSE4(m, v, out);
+                        return true;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+#endif
+        return false;
+    }
+
+    /**
+     * Writes the transpose of the column-major 4x4 matrix m into out.
+     */
+    template<typename Type>
+    inline bool mat4Transpose(const Type* m, Type* out) {
+#ifdef RUSH_DISPATCH
+        if constexpr (HasMat4Kernel<Type>) {
+            switch (cpu::instructionSet()) {
+                case InstructionSet::AVX512:
+                case InstructionSet::AVX2:
+                    // Four floats fill a SSE register: AVX2 has nothing to add.
+                    if constexpr (std::is_same_v<Type, float>) {
+                        detail::transposeSSE4(m, out);
+                    } else {
+                        detail::transposeAVX2(m, out);
+                    }
+                    return true;
+                case InstructionSet::SSE4:
+                    if constexpr (std::is_same_v<Type, float>) {
+                        detail::transposeSSE4(m, out);
+                        return true;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+#endif
+        return false;
+    }
+
+    /**
+     * Writes the inverse of the column-major 4x4 matrix m into out
+     * and its determinant into det.
+     * <p>
+     * If out is null, only the determinant is computed.
+     * The inverse of a singular matrix is not finite.
+     */
+    template<typename Type>
+    inline bool mat4Inverse(const Type* m, Type* out, Type& det) {
+#ifdef RUSH_DISPATCH
+        if constexpr (HasMat4Kernel<Type>) {
+            switch (cpu::instructionSet()) {
+                case InstructionSet::AVX512:
+                case InstructionSet::AVX2:
+                    if constexpr (std::is_same_v<Type, float>) {
+                        det = detail::inverseSSE4(m, out);
+                    } else {
+                        det = detail::inverseAVX2(m, out);
+                    }
+                    return true;
+                case InstructionSet::SSE4:
+                    if constexpr (std::is_same_v<Type, float>) {
+                        det = detail::inverseSSE4(m, out);
+                        return true;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+#endif
+        return false;
+    }
+
+    // ENDREGION
+}
+
+#endif //RUSH_MAT_SIMD_H
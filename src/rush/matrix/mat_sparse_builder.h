@@ -0,0 +1,231 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_MAT_SPARSE_BUILDER_H
+#define RUSH_MAT_SPARSE_BUILDER_H
+
+#include <vector>
+#include <stdexcept>
+#include <rush/parallel.h>
+#include <rush/matrix/mat_sparse_rep.h>
+
+namespace rush {
+    /**
+     * Collects the values of a sparse matrix as (column, row, value) triplets
+     * and compresses them into a MatSparseRep in one go.
+     * <p>
+     * Mat::pushValue() keeps the compressed representation sorted after
+     * every call, so building a matrix value by value costs O(nnz²).
+     * This builder only appends while collecting.
+     * build() sorts the triplets using two counting sorts,
+     * costing O(nnz + Columns + Rows).
+     * <p>
+     * Triplets pointing to the same position are summed,
+     * as done when assembling finite element matrices.
+     * Positions whose sum is zero are not stored.
+     * <p>
+     * Builders are not thread-safe.
+     * Use assemble() to collect triplets in several threads, each one
+     * of them using its own builder.
+     *
+     * @tparam Columns the amount of columns of the matrix.
+     * @tparam Rows the amount of rows of the matrix.
+     * @tparam Type the type of the values.
+     */
+    template<size_t Columns, size_t Rows, typename Type>
+    class SparseBuilder {
+        std::vector<size_t> _columns;
+        std::vector<size_t> _rows;
+        std::vector<Type> _values;
+
+    public:
+        SparseBuilder() = default;
+
+        /**
+         * Reserves memory for the given amount of triplets.
+         * @param amount the amount of triplets.
+         */
+        void reserve(size_t amount) {
+            _columns.reserve(amount);
+            _rows.reserve(amount);
+            _values.reserve(amount);
+        }
+
+        /**
+         * @return the amount of collected triplets.
+         * Duplicated positions are counted once per triplet.
+         */
+        [[nodiscard]] size_t size() const {
+            return _values.size();
+        }
+
+        /**
+         * @return whether this builder has no triplets.
+         */
+        [[nodiscard]] bool empty() const {
+            return _values.empty();
+        }
+
+        /**
+         * Removes all collected triplets.
+         * The reserved memory is kept.
+         */
+        void clear() {
+            _columns.clear();
+            _rows.clear();
+            _values.clear();
+        }
+
+        /**
+         * Adds the given value to the given position.
+         * @param column the column of the value.
+         * @param row the row of the value.
+         * @param value the value.
+         */
+        void add(size_t column, size_t row, const Type& value) {
+#ifndef NDEBUG
+            if (column >= Columns || row >= Rows) {
+                throw std::runtime_error("Position out of bounds.");
+            }
+#endif
+            _columns.push_back(column);
+            _rows.push_back(row);
+            _values.push_back(value);
+        }
+
+        /**
+         * Appends the triplets of the given builder to this one.
+         * @param other the other builder.
+         */
+        void merge(const SparseBuilder& other) {
+            _columns.insert(_columns.end(), other._columns.begin(), other._columns.end());
+            _rows.insert(_rows.end(), other._rows.begin(), other._rows.end());
+            _values.insert(_values.end(), other._values.begin(), other._values.end());
+        }
+
+        /**
+         * Compresses the collected triplets into the given representation.
+         * The previous contents of the representation are discarded.
+         * <p>
+         * Duplicated positions are summed in the order they were added.
+         *
+         * @param rep the representation to fill.
+         */
+        template<typename Allocator>
+        void buildInto(MatSparseRep::Representation<Columns, Rows, Type, Allocator>& rep) const {
+            constexpr Type ZERO = static_cast<Type>(0);
+            size_t amount = _values.size();
+
+            // First pass: sort the triplets by row.
+            std::vector<size_t> rowStart(Rows + 1, 0);
+            for (size_t row: _rows) {
+                ++rowStart[row + 1];
+            }
+            for (size_t r = 0; r < Rows; ++r) {
+                rowStart[r + 1] += rowStart[r];
+            }
+
+            std::vector<size_t> byRow(amount);
+            for (size_t i = 0; i < amount; ++i) {
+                byRow[rowStart[_rows[i]]++] = i;
+            }
+
+            // Second pass: stable sort by column.
+            // Rows end sorted inside each column.
+            for (size_t c = 0; c <= Columns; ++c) {
+                rep.cols[c] = 0;
+            }
+            for (size_t column: _columns) {
+                ++rep.cols[column + 1];
+            }
+            for (size_t c = 0; c < Columns; ++c) {
+                rep.cols[c + 1] += rep.cols[c];
+            }
+
+            std::vector<size_t> position(Columns);
+            for (size_t c = 0; c < Columns; ++c) {
+                position[c] = rep.cols[c];
+            }
+            std::vector<size_t> sorted(amount);
+            for (size_t i: byRow) {
+                sorted[position[_columns[i]]++] = i;
+            }
+
+            // Duplicates are now contiguous. Sum them and remove the zeros.
+            rep.rows.clear();
+            rep.vals.clear();
+            rep.rows.reserve(amount);
+            rep.vals.reserve(amount);
+
+            size_t start = 0;
+            for (size_t c = 0; c < Columns; ++c) {
+                size_t end = rep.cols[c + 1];
+                rep.cols[c] = rep.vals.size();
+
+                size_t pos = start;
+                while (pos < end) {
+                    size_t row = _rows[sorted[pos]];
+                    Type sum = _values[sorted[pos]];
+                    for (++pos; pos < end && _rows[sorted[pos]] == row; ++pos) {
+                        sum += _values[sorted[pos]];
+                    }
+                    if (sum != ZERO) {
+                        rep.rows.push_back(row);
+                        rep.vals.push_back(sum);
+                    }
+                }
+
+                start = end;
+            }
+            rep.cols[Columns] = rep.vals.size();
+        }
+
+        /**
+         * Compresses the collected triplets into a new sparse matrix.
+         * See buildInto() for more information.
+         *
+         * @tparam Allocator the allocator of the matrix.
+         * @return the new matrix.
+         */
+        template<typename Allocator = StaticAllocator>
+        Mat<Columns, Rows, Type, MatSparseRep, Allocator> build() const {
+            Mat<Columns, Rows, Type, MatSparseRep, Allocator> result;
+            buildInto(result.rep);
+            return result;
+        }
+
+        /**
+         * Calls function(builder, i) for every i in [0, count),
+         * splitting the range across several threads.
+         * <p>
+         * Each thread collects its triplets in its own builder.
+         * The builders are merged in the order of their ranges,
+         * so the result matches a sequential loop.
+         * See parallelFor() for more information.
+         *
+         * @param count the amount of elements to assemble.
+         * @param threads the maximum amount of threads.
+         * @param function the function adding the triplets of an element.
+         * @param minChunk the minimum amount of elements per thread.
+         * @return the builder containing all triplets.
+         */
+        template<typename Function>
+        static SparseBuilder assemble(size_t count, size_t threads, Function&& function,
+                                      size_t minChunk = PARALLEL_MIN_CHUNK) {
+            return parallelReduce(count, threads, [&function](size_t from, size_t to) {
+                SparseBuilder builder;
+                for (size_t i = from; i < to; ++i) {
+                    function(builder, i);
+                }
+                return builder;
+            }, [](SparseBuilder& left, const SparseBuilder& right) {
+                SparseBuilder result = std::move(left);
+                result.merge(right);
+                return result;
+            }, minChunk);
+        }
+    };
+}
+
+#endif //RUSH_MAT_SPARSE_BUILDER_H
@@ -0,0 +1,308 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_MAT_SPARSE_CHOLESKY_H
+#define RUSH_MAT_SPARSE_CHOLESKY_H
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <rush/matrix/mat_sparse_rep.h>
+#include <rush/matrix/mat_sparse_ordering.h>
+
+namespace rush {
+    /**
+     * The sparse LDLᵀ factorization PAPᵀ = LDLᵀ of a symmetric matrix,
+     * being P a fill-reducing permutation, L unit lower triangular and D diagonal.
+     * <p>
+     * Only L and D are stored, so the factorization takes about half the memory
+     * and work of SparseLU on the same matrix.
+     * Like SparseLU, it is split in two phases.
+     * The constructor computes the permutation, the elimination tree and
+     * the pattern of L.
+     * factorize() computes L and D one row at a time, following the elimination
+     * tree to find the pattern of each row. It may be called again with new values
+     * while the structure of the matrix does not change.
+     * <p>
+     * Symmetric positive definite matrices always factorize.
+     * Other symmetric matrices factorize while no pivot becomes zero.
+     * The Cholesky factor is L * sqrt(D).
+     *
+     * @tparam Size the size of the system.
+     * @tparam Type the type of the values.
+     */
+    template<size_t Size, typename Type>
+    class SparseLDLT {
+        std::vector<size_t> _permutation;
+        std::vector<size_t> _inverse;
+        std::vector<size_t> _parent;
+        Mat<Size, Size, Type, MatSparseRep> _factor;
+        std::vector<Type> _diagonal;
+        std::vector<Type> _work;
+        std::vector<size_t> _mark;
+        std::vector<size_t> _filled;
+        std::vector<size_t> _pattern;
+        bool _valid;
+
+    public:
+        /**
+         * The parent of the roots of the elimination tree.
+         */
+        static constexpr size_t NO_PARENT = Size;
+
+        /**
+         * Runs the symbolic analysis of the given matrix.
+         * Only the structure of the matrix is read.
+         * <p>
+         * The matrix must be symmetric and store both of its triangles.
+         * Only the values falling in the upper triangle of PAPᵀ are used.
+         *
+         * @param a the matrix of the system.
+         * @param ordering the ordering applied to the matrix.
+         */
+        template<typename Allocator>
+        explicit SparseLDLT(const Mat<Size, Size, Type, MatSparseRep, Allocator>& a,
+                            SparseOrdering ordering = SparseOrdering::ApproximateMinimumDegree)
+            : _inverse(Size),
+              _parent(Size, NO_PARENT),
+              _diagonal(Size, static_cast<Type>(0)),
+              _work(Size, static_cast<Type>(0)),
+              _mark(Size),
+              _filled(Size),
+              _pattern(Size),
+              _valid(false) {
+            if (ordering == SparseOrdering::ApproximateMinimumDegree) {
+                _permutation = approximateMinimumDegree(a);
+            } else {
+                _permutation.resize(Size);
+                std::iota(_permutation.begin(), _permutation.end(), 0);
+            }
+            for (size_t k = 0; k < Size; ++k) {
+                _inverse[_permutation[k]] = k;
+            }
+
+            // Row k of L is the union of the paths from each i < k of
+            // column k of PAPᵀ up to k in the elimination tree.
+            auto& cols = _factor.rep.cols;
+            std::vector<size_t> counts(Size, 0);
+            for (size_t k = 0; k < Size; ++k) {
+                _mark[k] = k;
+                size_t source = _permutation[k];
+                for (size_t p = a.rep.cols[source]; p < a.rep.cols[source + 1]; ++p) {
+                    size_t i = _inverse[a.rep.rows[p]];
+                    if (i >= k) continue;
+                    for (; _mark[i] != k; i = _parent[i]) {
+                        if (_parent[i] == NO_PARENT) _parent[i] = k;
+                        ++counts[i];
+                        _mark[i] = k;
+                    }
+                }
+            }
+
+            cols[0] = 0;
+            for (size_t k = 0; k < Size; ++k) {
+                cols[k + 1] = cols[k] + counts[k];
+            }
+            _factor.rep.rows.resize(cols[Size]);
+            _factor.rep.vals.assign(cols[Size], static_cast<Type>(0));
+
+            // Second pass: the rows of each column are found in increasing order.
+            std::fill(counts.begin(), counts.end(), 0);
+            for (size_t k = 0; k < Size; ++k) {
+                _mark[k] = k;
+                size_t source = _permutation[k];
+                for (size_t p = a.rep.cols[source]; p < a.rep.cols[source + 1]; ++p) {
+                    size_t i = _inverse[a.rep.rows[p]];
+                    if (i >= k) continue;
+                    for (; _mark[i] != k; i = _parent[i]) {
+                        _factor.rep.rows[cols[i] + counts[i]++] = k;
+                        _mark[i] = k;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Computes the values of L and D.
+         * <p>
+         * The matrix must have the structure of the analyzed one,
+         * or a subset of it. Only its values may have changed.
+         * The factorization fails if the matrix has a value outside
+         * the analyzed pattern or a pivot becomes zero.
+         *
+         * @param a the matrix of the system.
+         * @return whether the factorization succeeded.
+         */
+        template<typename Allocator>
+        bool factorize(const Mat<Size, Size, Type, MatSparseRep, Allocator>& a) {
+            constexpr Type ZERO = static_cast<Type>(0);
+            const auto& cols = _factor.rep.cols;
+            const auto& rows = _factor.rep.rows;
+            auto& vals = _factor.rep.vals;
+            _valid = false;
+
+            for (size_t k = 0; k < Size; ++k) {
+                _mark[k] = k;
+                _filled[k] = cols[k];
+                size_t top = Size;
+
+                size_t source = _permutation[k];
+                for (size_t p = a.rep.cols[source]; p < a.rep.cols[source + 1]; ++p) {
+                    size_t i = _inverse[a.rep.rows[p]];
+                    if (i > k) continue;
+                    _work[i] += a.rep.vals[p];
+
+                    // Push the path from i up to the marked part of the tree,
+                    // keeping the pattern in topological order.
+                    size_t length = 0;
+                    for (; i != NO_PARENT && _mark[i] != k; i = _parent[i]) {
+                        _pattern[length++] = i;
+                        _mark[i] = k;
+                    }
+                    if (i == NO_PARENT) return fail();
+                    while (length > 0) {
+                        _pattern[--top] = _pattern[--length];
+                    }
+                }
+
+                Type dk = _work[k];
+                _work[k] = ZERO;
+                for (; top < Size; ++top) {
+                    size_t i = _pattern[top];
+                    Type yi = _work[i];
+                    _work[i] = ZERO;
+
+                    // Positions skipped by a matrix with less values than the analyzed one stay zero.
+                    size_t position = _filled[i];
+                    while (position < cols[i + 1] && rows[position] < k) {
+                        vals[position++] = ZERO;
+                    }
+                    if (position == cols[i + 1] || rows[position] != k) return fail();
+
+                    for (size_t p = cols[i]; p < position; ++p) {
+                        _work[rows[p]] -= vals[p] * yi;
+                    }
+
+                    Type lki = yi / _diagonal[i];
+                    dk -= lki * yi;
+                    vals[position] = lki;
+                    _filled[i] = position + 1;
+                }
+
+                if (dk == ZERO) return fail();
+                _diagonal[k] = dk;
+            }
+
+            for (size_t k = 0; k < Size; ++k) {
+                std::fill(vals.begin() + _filled[k], vals.begin() + cols[k + 1], ZERO);
+            }
+
+            _valid = true;
+            return true;
+        }
+
+        /**
+         * @return whether the last call to factorize() succeeded.
+         * Solving with an invalid factorization produces undefined values.
+         */
+        [[nodiscard]] bool valid() const {
+            return _valid;
+        }
+
+        /**
+         * @return the permutation. The position k holds the row and column of A
+         * moved to the position k.
+         */
+        [[nodiscard]] const std::vector<size_t>& permutation() const {
+            return _permutation;
+        }
+
+        /**
+         * @return the elimination tree of PAPᵀ: the parent of each column,
+         * or NO_PARENT for the roots.
+         */
+        [[nodiscard]] const std::vector<size_t>& parents() const {
+            return _parent;
+        }
+
+        /**
+         * @return L of PAPᵀ, without its unit diagonal.
+         * Positions that cancel out are kept as zeros.
+         */
+        [[nodiscard]] const Mat<Size, Size, Type, MatSparseRep>& factor() const {
+            return _factor;
+        }
+
+        /**
+         * @return D of PAPᵀ.
+         */
+        [[nodiscard]] const std::vector<Type>& diagonal() const {
+            return _diagonal;
+        }
+
+        /**
+         * @return the amount of values stored in L and D.
+         */
+        [[nodiscard]] size_t nonZeros() const {
+            return _factor.rep.rows.size() + Size;
+        }
+
+        /**
+         * Solves Ax = b.
+         * @param b the right-hand side.
+         * @param x the array where the solution is stored. It may be b.
+         */
+        void solve(const Type* b, Type* x) const {
+            const auto& cols = _factor.rep.cols;
+            const auto& rows = _factor.rep.rows;
+            const auto& vals = _factor.rep.vals;
+
+            std::vector<Type> y(Size);
+            for (size_t k = 0; k < Size; ++k) {
+                y[k] = b[_permutation[k]];
+            }
+
+            // L z = Pb, by columns.
+            for (size_t j = 0; j < Size; ++j) {
+                Type yj = y[j];
+                for (size_t p = cols[j]; p < cols[j + 1]; ++p) {
+                    y[rows[p]] -= vals[p] * yj;
+                }
+            }
+
+            for (size_t j = 0; j < Size; ++j) {
+                y[j] /= _diagonal[j];
+            }
+
+            // Lᵀ Px = D⁻¹z. Row j of Lᵀ is column j of L.
+            for (size_t j = Size; j > 0; --j) {
+                size_t c = j - 1;
+                Type sum = y[c];
+                for (size_t p = cols[c]; p < cols[c + 1]; ++p) {
+                    sum -= vals[p] * y[rows[p]];
+                }
+                y[c] = sum;
+            }
+
+            for (size_t k = 0; k < Size; ++k) {
+                x[_permutation[k]] = y[k];
+            }
+        }
+
+        template<typename BAlloc>
+        Vec<Size, Type, BAlloc> solve(const Vec<Size, Type, BAlloc>& b) const {
+            Vec<Size, Type, BAlloc> x;
+            solve(b.toPointer(), x.toPointer());
+            return x;
+        }
+
+    private:
+        bool fail() {
+            std::fill(_work.begin(), _work.end(), static_cast<Type>(0));
+            return false;
+        }
+    };
+}
+
+#endif //RUSH_MAT_SPARSE_CHOLESKY_H
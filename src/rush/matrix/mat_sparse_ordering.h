@@ -0,0 +1,172 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_MAT_SPARSE_ORDERING_H
+#define RUSH_MAT_SPARSE_ORDERING_H
+
+#include <queue>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+#include <rush/matrix/mat_sparse_rep.h>
+
+namespace rush {
+    /**
+     * The orderings a sparse factorization may apply to the rows
+     * and columns of a matrix before factorizing it.
+     */
+    enum class SparseOrdering {
+        /**
+         * Factorizes the matrix as it is.
+         */
+        Natural,
+
+        /**
+         * Applies approximateMinimumDegree().
+         */
+        ApproximateMinimumDegree
+    };
+
+    /**
+     * Computes a fill-reducing ordering of the given matrix.
+     * <p>
+     * The ordering is computed on the pattern of A + Aᵀ, so it is meant
+     * to be applied symmetrically: PAPᵀ keeps the diagonal of A in its diagonal.
+     * <p>
+     * The method eliminates the variable with the smallest degree first.
+     * Eliminated variables are represented by elements in a quotient graph,
+     * so memory stays bounded by the pattern of the factor.
+     * Degrees are not computed exactly: like in Amestoy, Davis and Duff's AMD,
+     * an upper bound is computed from the sizes of the adjacent elements.
+     * Elements contained in the newest one are absorbed.
+     *
+     * @param a the matrix.
+     * @return the permutation: the position k holds the index of the k-th pivot.
+     */
+    template<size_t Size, typename Type, typename Allocator>
+    std::vector<size_t> approximateMinimumDegree(const Mat<Size, Size, Type, MatSparseRep, Allocator>& a) {
+        // Variables adjacent to each variable and elements adjacent to each variable.
+        std::vector<std::vector<size_t>> variables(Size), elements(Size);
+        // The variables of each element. Element e is created when variable e is eliminated.
+        std::vector<std::vector<size_t>> members(Size);
+        std::vector<bool> eliminated(Size, false), absorbed(Size, false);
+
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t p = a.rep.cols[c]; p < a.rep.cols[c + 1]; ++p) {
+                size_t r = a.rep.rows[p];
+                if (r == c) continue;
+                variables[c].push_back(r);
+                variables[r].push_back(c);
+            }
+        }
+
+        using Entry = std::pair<size_t, size_t>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+        std::vector<size_t> degree(Size);
+        for (size_t i = 0; i < Size; ++i) {
+            auto& list = variables[i];
+            std::sort(list.begin(), list.end());
+            list.erase(std::unique(list.begin(), list.end()), list.end());
+            degree[i] = list.size();
+            queue.emplace(degree[i], i);
+        }
+
+        std::vector<size_t> order;
+        order.reserve(Size);
+        std::vector<size_t> mark(Size, 0);
+        size_t stamp = 0;
+        // |Le \ Lp| for the elements adjacent to the new element p. Size means unset.
+        std::vector<size_t> external(Size, Size);
+        std::vector<size_t> touched;
+
+        while (order.size() < Size) {
+            auto [d, p] = queue.top();
+            queue.pop();
+            if (eliminated[p] || d != degree[p]) continue;
+
+            order.push_back(p);
+            eliminated[p] = true;
+            ++stamp;
+
+            // Lp: the variables adjacent to p, directly or through its elements.
+            std::vector<size_t> pivot;
+            for (size_t e: elements[p]) {
+                if (absorbed[e]) continue;
+                for (size_t v: members[e]) {
+                    if (!eliminated[v] && mark[v] != stamp) {
+                        mark[v] = stamp;
+                        pivot.push_back(v);
+                    }
+                }
+                absorbed[e] = true;
+                std::vector<size_t>().swap(members[e]);
+            }
+            for (size_t v: variables[p]) {
+                if (!eliminated[v] && mark[v] != stamp) {
+                    mark[v] = stamp;
+                    pivot.push_back(v);
+                }
+            }
+            std::vector<size_t>().swap(variables[p]);
+            std::vector<size_t>().swap(elements[p]);
+
+            // Lp becomes the element p. The variables inside it are connected
+            // through p, so their direct edges are pruned.
+            for (size_t i: pivot) {
+                auto& adjacentElements = elements[i];
+                adjacentElements.erase(std::remove_if(adjacentElements.begin(), adjacentElements.end(),
+                                                      [&](size_t e) { return absorbed[e]; }),
+                                       adjacentElements.end());
+                adjacentElements.push_back(p);
+
+                auto& adjacentVariables = variables[i];
+                adjacentVariables.erase(std::remove_if(adjacentVariables.begin(), adjacentVariables.end(),
+                                                       [&](size_t v) {
+                                                           return eliminated[v] || mark[v] == stamp;
+                                                       }),
+                                        adjacentVariables.end());
+            }
+
+            for (size_t i: pivot) {
+                for (size_t e: elements[i]) {
+                    if (e == p) continue;
+                    if (external[e] == Size) {
+                        external[e] = members[e].size();
+                        touched.push_back(e);
+                    }
+                    --external[e];
+                }
+            }
+
+            // Aggressive absorption: elements inside Lp add nothing to any degree.
+            for (size_t e: touched) {
+                if (external[e] == 0) {
+                    absorbed[e] = true;
+                    std::vector<size_t>().swap(members[e]);
+                }
+            }
+
+            size_t remaining = Size - order.size();
+            for (size_t i: pivot) {
+                size_t bound = variables[i].size() + pivot.size() - 1;
+                for (size_t e: elements[i]) {
+                    if (e != p && !absorbed[e]) bound += external[e];
+                }
+                degree[i] = std::min(bound, remaining - 1);
+                queue.emplace(degree[i], i);
+            }
+
+            for (size_t e: touched) {
+                external[e] = Size;
+            }
+            touched.clear();
+            members[p] = std::move(pivot);
+        }
+
+        return order;
+    }
+}
+
+#endif //RUSH_MAT_SPARSE_ORDERING_H
@@ -0,0 +1,286 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_MAT_SPARSE_PRODUCT_H
+#define RUSH_MAT_SPARSE_PRODUCT_H
+
+#include <algorithm>
+#include <bit>
+#include <vector>
+#include <rush/parallel.h>
+#include <rush/matrix/mat_sparse_rep.h>
+
+namespace rush {
+    namespace detail {
+        /**
+         * Computes y += A[:, from..to) * x[from..to), being A a CSC matrix.
+         * Each value of A is read once, in storage order.
+         */
+        template<typename Type>
+        constexpr void sparseMultiplyColumns(const size_t* cols, const size_t* rows, const Type* vals,
+                                             const Type* x, Type* y, size_t from, size_t to) {
+            for (size_t c = from; c < to; ++c) {
+                Type factor = x[c];
+                for (size_t p = cols[c]; p < cols[c + 1]; ++p) {
+                    y[rows[p]] += vals[p] * factor;
+                }
+            }
+        }
+
+        /**
+         * Computes y[c] = A[:, c] · x for every c in [from, to), being A a CSC matrix.
+         */
+        template<typename Type>
+        constexpr void sparseMultiplyTransposedColumns(const size_t* cols, const size_t* rows, const Type* vals,
+                                                       const Type* x, Type* y, size_t from, size_t to) {
+            for (size_t c = from; c < to; ++c) {
+                Type sum = static_cast<Type>(0);
+                for (size_t p = cols[c]; p < cols[c + 1]; ++p) {
+                    sum += vals[p] * x[rows[p]];
+                }
+                y[c] = sum;
+            }
+        }
+
+        /**
+         * The minimum amount of columns a thread must process
+         * to receive around PARALLEL_MIN_CHUNK values.
+         */
+        inline size_t sparseMinChunk(size_t columns, size_t values) {
+            return std::max<size_t>(PARALLEL_MIN_CHUNK * columns / std::max<size_t>(values, 1), 1);
+        }
+
+        /**
+         * Computes y = A * x, being A a sparse matrix and x and y arrays.
+         * See sparseMultiply().
+         */
+        template<size_t Columns, size_t Rows, typename Type, typename Allocator>
+        void sparseMultiplyInto(const Mat<Columns, Rows, Type, MatSparseRep, Allocator>& a,
+                                const Type* x, Type* y, size_t threads) {
+            const size_t* cols = a.rep.cols.toPointer();
+            const size_t* rows = a.rep.rows.data();
+            const Type* vals = a.rep.vals.data();
+            size_t minChunk = sparseMinChunk(Columns, a.rep.vals.size());
+
+            if (parallelChunks(Columns, threads, minChunk) <= 1) {
+                std::fill(y, y + Rows, static_cast<Type>(0));
+                sparseMultiplyColumns(cols, rows, vals, x, y, 0, Columns);
+                return;
+            }
+
+            auto result = parallelReduce(Columns, threads, [&](size_t from, size_t to) {
+                std::vector<Type> partial(Rows, static_cast<Type>(0));
+                sparseMultiplyColumns(cols, rows, vals, x, partial.data(), from, to);
+                return partial;
+            }, [](std::vector<Type>& left, const std::vector<Type>& right) {
+                for (size_t r = 0; r < Rows; ++r) {
+                    left[r] += right[r];
+                }
+                return std::move(left);
+            }, minChunk);
+
+            std::copy(result.begin(), result.end(), y);
+        }
+    }
+
+    /**
+     * Computes y = A * x, being A a sparse matrix.
+     * <p>
+     * The product walks the compressed columns of A once.
+     * When several threads are used, each one of them multiplies
+     * a range of columns into its own partial result,
+     * and the partial results are summed in order.
+     * The sums may be rounded differently than in the single-threaded product.
+     * See parallelFor() for more information.
+     *
+     * @param a the sparse matrix.
+     * @param x the vector to multiply.
+     * @param y the vector where the result is stored. It must not be x.
+     * @param threads the maximum amount of threads. 0 uses all the hardware threads.
+     */
+    template<size_t Columns, size_t Rows, typename Type, typename Allocator,
+        typename XAlloc, typename YAlloc>
+    void sparseMultiply(const Mat<Columns, Rows, Type, MatSparseRep, Allocator>& a,
+                        const Vec<Columns, Type, XAlloc>& x,
+                        Vec<Rows, Type, YAlloc>& y,
+                        size_t threads = 1) {
+        detail::sparseMultiplyInto(a, x.toPointer(), y.toPointer(), threads);
+    }
+
+    /**
+     * Computes y = Aᵀ * x, being A a sparse matrix, without transposing A.
+     * <p>
+     * Each component of y is the dot product of a compressed column of A and x,
+     * so threads compute disjoint ranges of y and the result does not depend
+     * on the amount of threads.
+     * See parallelFor() for more information.
+     *
+     * @param a the sparse matrix.
+     * @param x the vector to multiply.
+     * @param y the vector where the result is stored. It must not be x.
+     * @param threads the maximum amount of threads. 0 uses all the hardware threads.
+     */
+    template<size_t Columns, size_t Rows, typename Type, typename Allocator,
+        typename XAlloc, typename YAlloc>
+    void sparseMultiplyTransposed(const Mat<Columns, Rows, Type, MatSparseRep, Allocator>& a,
+                                  const Vec<Rows, Type, XAlloc>& x,
+                                  Vec<Columns, Type, YAlloc>& y,
+                                  size_t threads = 1) {
+        const size_t* cols = a.rep.cols.toPointer();
+        const size_t* rows = a.rep.rows.data();
+        const Type* vals = a.rep.vals.data();
+        parallelFor(Columns, threads, [&](size_t from, size_t to) {
+            detail::sparseMultiplyTransposedColumns(cols, rows, vals, x.toPointer(), y.toPointer(), from, to);
+        }, detail::sparseMinChunk(Columns, a.rep.vals.size()));
+    }
+
+    /**
+     * The positions of the values of a sparse matrix, stored as CSC arrays.
+     * <p>
+     * sparseMultiplySymbolic() computes the pattern of a sparse product,
+     * which sparseMultiplyNumeric() reuses while the structures of the
+     * factors do not change.
+     *
+     * @tparam Columns the amount of columns of the matrix.
+     * @tparam Rows the amount of rows of the matrix.
+     */
+    template<size_t Columns, size_t Rows>
+    struct SparsePattern {
+        std::vector<size_t> cols = std::vector<size_t>(Columns + 1, 0);
+        std::vector<size_t> rows;
+
+        /**
+         * @return the amount of positions of this pattern.
+         */
+        [[nodiscard]] size_t size() const {
+            return rows.size();
+        }
+    };
+
+    /**
+     * Computes the positions that the product A * B may fill,
+     * being A and B sparse matrices.
+     * <p>
+     * This is the symbolic phase of Gustavson's algorithm:
+     * column c of the product is the union of the columns of A
+     * selected by the rows of the column c of B.
+     * Its cost is proportional to the multiplications of the product.
+     * The rows of every column of the pattern are sorted.
+     *
+     * @param a the left matrix.
+     * @param b the right matrix.
+     * @return the pattern of the product.
+     */
+    template<size_t Columns, size_t Rows, size_t OC, typename Type,
+        typename Allocator, typename OAlloc>
+    SparsePattern<OC, Rows> sparseMultiplySymbolic(const Mat<Columns, Rows, Type, MatSparseRep, Allocator>& a,
+                                                   const Mat<OC, Columns, Type, MatSparseRep, OAlloc>& b) {
+        SparsePattern<OC, Rows> pattern;
+        // The last column that added each row. OC marks rows not added yet.
+        std::vector<size_t> mark(Rows, OC);
+
+        for (size_t c = 0; c < OC; ++c) {
+            size_t start = pattern.rows.size();
+            for (size_t p = b.rep.cols[c]; p < b.rep.cols[c + 1]; ++p) {
+                size_t k = b.rep.rows[p];
+                for (size_t q = a.rep.cols[k]; q < a.rep.cols[k + 1]; ++q) {
+                    size_t r = a.rep.rows[q];
+                    if (mark[r] != c) {
+                        mark[r] = c;
+                        pattern.rows.push_back(r);
+                    }
+                }
+            }
+
+            size_t amount = pattern.rows.size() - start;
+            if (amount * std::bit_width(amount) > Rows) {
+                // Crowded column: scanning the marks is cheaper than sorting.
+                pattern.rows.resize(start);
+                for (size_t r = 0; r < Rows; ++r) {
+                    if (mark[r] == c) pattern.rows.push_back(r);
+                }
+            } else {
+                std::sort(pattern.rows.begin() + start, pattern.rows.end());
+            }
+            pattern.cols[c + 1] = pattern.rows.size();
+        }
+
+        return pattern;
+    }
+
+    /**
+     * Computes the values of the product A * B, being A and B sparse matrices,
+     * using the pattern given by sparseMultiplySymbolic().
+     * <p>
+     * The pattern must have been computed from matrices with the same
+     * structure as A and B, or a subset of it. Only their values may have changed.
+     * Values are accumulated in a dense column and gathered
+     * in the order of the pattern. Positions whose value is zero are not stored.
+     * <p>
+     * Sparse matrices do not store zeros, so a value of A or B becoming
+     * non-zero changes their structure. If a product falls outside the pattern,
+     * the computation fails and the output becomes a zero matrix.
+     *
+     * @param a the left matrix.
+     * @param b the right matrix.
+     * @param pattern the pattern of the product.
+     * @param out the matrix where the product is stored. It must not be a or b.
+     * @return whether the product fits in the pattern.
+     */
+    template<size_t Columns, size_t Rows, size_t OC, typename Type,
+        typename Allocator, typename OAlloc, typename RAlloc>
+    bool sparseMultiplyNumeric(const Mat<Columns, Rows, Type, MatSparseRep, Allocator>& a,
+                               const Mat<OC, Columns, Type, MatSparseRep, OAlloc>& b,
+                               const SparsePattern<OC, Rows>& pattern,
+                               Mat<OC, Rows, Type, MatSparseRep, RAlloc>& out) {
+        constexpr Type ZERO = static_cast<Type>(0);
+        std::vector<Type> accumulator(Rows, ZERO);
+        // The last column whose pattern contains each row. OC marks rows not found yet.
+        std::vector<size_t> mark(Rows, OC);
+
+        out.rep.rows.clear();
+        out.rep.vals.clear();
+        out.rep.rows.reserve(pattern.size());
+        out.rep.vals.reserve(pattern.size());
+        out.rep.cols[0] = 0;
+
+        for (size_t c = 0; c < OC; ++c) {
+            for (size_t p = pattern.cols[c]; p < pattern.cols[c + 1]; ++p) {
+                mark[pattern.rows[p]] = c;
+            }
+
+            for (size_t p = b.rep.cols[c]; p < b.rep.cols[c + 1]; ++p) {
+                size_t k = b.rep.rows[p];
+                Type factor = b.rep.vals[p];
+                for (size_t q = a.rep.cols[k]; q < a.rep.cols[k + 1]; ++q) {
+                    size_t r = a.rep.rows[q];
+                    if (mark[r] != c) {
+                        out.rep.rows.clear();
+                        out.rep.vals.clear();
+                        for (size_t i = 0; i <= OC; ++i) {
+                            out.rep.cols[i] = 0;
+                        }
+                        return false;
+                    }
+                    accumulator[r] += a.rep.vals[q] * factor;
+                }
+            }
+
+            for (size_t p = pattern.cols[c]; p < pattern.cols[c + 1]; ++p) {
+                size_t r = pattern.rows[p];
+                Type value = accumulator[r];
+                accumulator[r] = ZERO;
+                if (value != ZERO) {
+                    out.rep.rows.push_back(r);
+                    out.rep.vals.push_back(value);
+                }
+            }
+            out.rep.cols[c + 1] = out.rep.vals.size();
+        }
+
+        return true;
+    }
+}
+
+#endif //RUSH_MAT_SPARSE_PRODUCT_H
@@ -0,0 +1,275 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_MAT_SPARSE_TRIANGULAR_H
+#define RUSH_MAT_SPARSE_TRIANGULAR_H
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <rush/parallel.h>
+#include <rush/matrix/mat_sparse_rep.h>
+#include <rush/matrix/mat_sparse_product.h>
+
+namespace rush {
+    /**
+     * The triangle of a sparse matrix used by a triangular solve.
+     * Values outside the triangle are ignored, so L and U may share
+     * a matrix, as done by sparseLUDecompose().
+     */
+    enum class SparseTriangle {
+        /**
+         * The values below the diagonal and the diagonal.
+         */
+        Lower,
+
+        /**
+         * The values below the diagonal. The diagonal is one.
+         */
+        UnitLower,
+
+        /**
+         * The values above the diagonal and the diagonal.
+         */
+        Upper,
+
+        /**
+         * The values above the diagonal. The diagonal is one.
+         */
+        UnitUpper
+    };
+
+    /**
+     * Solves Tx = b in place, being T a triangle of the given sparse matrix.
+     * <p>
+     * The compressed columns of the matrix are walked once,
+     * so the solve costs O(nnz).
+     * The rows of every column must be sorted, as done by Mat and SparseBuilder.
+     * The diagonal of non-unit triangles must be stored.
+     * Missing diagonal values throw in debug builds and are zero otherwise,
+     * producing infinities like a dense solve.
+     *
+     * @param t the sparse matrix.
+     * @param triangle the triangle to use.
+     * @param x the right-hand side, where the solution is stored.
+     */
+    template<size_t Size, typename Type, typename Allocator>
+    void sparseTriangularSolve(const Mat<Size, Size, Type, MatSparseRep, Allocator>& t,
+                               SparseTriangle triangle, Type* x) {
+        const auto& cols = t.rep.cols;
+        const auto& rows = t.rep.rows;
+        const auto& vals = t.rep.vals;
+        bool unit = triangle == SparseTriangle::UnitLower || triangle == SparseTriangle::UnitUpper;
+
+        if (triangle == SparseTriangle::Lower || triangle == SparseTriangle::UnitLower) {
+            for (size_t j = 0; j < Size; ++j) {
+                size_t p = std::lower_bound(rows.begin() + cols[j], rows.begin() + cols[j + 1], j) - rows.begin();
+                bool diagonal = p < cols[j + 1] && rows[p] == j;
+                if (!unit) {
+#ifndef NDEBUG
+                    if (!diagonal) {
+                        throw std::runtime_error("Missing diagonal value.");
+                    }
+#endif
+                    // A missing diagonal is a zero, as when reading it with operator().
+                    x[j] /= diagonal ? vals[p] : static_cast<Type>(0);
+                }
+                if (diagonal) ++p;
+                Type xj = x[j];
+                for (; p < cols[j + 1]; ++p) {
+                    x[rows[p]] -= vals[p] * xj;
+                }
+            }
+        } else {
+            for (size_t c = Size; c > 0; --c) {
+                size_t j = c - 1;
+                size_t end = std::lower_bound(rows.begin() + cols[j], rows.begin() + cols[j + 1], j) - rows.begin();
+                if (!unit) {
+                    bool diagonal = end < cols[j + 1] && rows[end] == j;
+#ifndef NDEBUG
+                    if (!diagonal) {
+                        throw std::runtime_error("Missing diagonal value.");
+                    }
+#endif
+                    x[j] /= diagonal ? vals[end] : static_cast<Type>(0);
+                }
+                Type xj = x[j];
+                for (size_t p = cols[j]; p < end; ++p) {
+                    x[rows[p]] -= vals[p] * xj;
+                }
+            }
+        }
+    }
+
+    /**
+     * A triangle of a sparse matrix prepared to be solved by several threads.
+     * <p>
+     * The analysis groups the rows in levels: a row only depends on rows
+     * of previous levels, so the rows of a level can be solved at once.
+     * The triangle is copied by rows, so each row is solved gathering
+     * the values it depends on and no two threads write the same value.
+     * <p>
+     * The values of the matrix are copied. Build a new schedule
+     * when they change.
+     *
+     * @tparam Size the size of the system.
+     * @tparam Type the type of the values.
+     */
+    template<size_t Size, typename Type>
+    class SparseTriangularSchedule {
+        SparseTriangle _triangle;
+        std::vector<size_t> _rowStart;
+        std::vector<size_t> _columns;
+        std::vector<Type> _values;
+        std::vector<Type> _diagonal;
+        std::vector<size_t> _levelStart;
+        std::vector<size_t> _order;
+
+    public:
+        /**
+         * Analyzes the given triangle.
+         * The diagonal of non-unit triangles must be stored.
+         * Missing diagonal values throw in debug builds and are zero otherwise.
+         *
+         * @param t the sparse matrix.
+         * @param triangle the triangle to use.
+         */
+        template<typename Allocator>
+        SparseTriangularSchedule(const Mat<Size, Size, Type, MatSparseRep, Allocator>& t,
+                                 SparseTriangle triangle)
+            : _triangle(triangle),
+              _rowStart(Size + 1, 0),
+              _diagonal(Size, static_cast<Type>(0)) {
+            bool lower = triangle == SparseTriangle::Lower || triangle == SparseTriangle::UnitLower;
+            bool unit = triangle == SparseTriangle::UnitLower || triangle == SparseTriangle::UnitUpper;
+            if (unit) {
+                std::fill(_diagonal.begin(), _diagonal.end(), static_cast<Type>(1));
+            }
+            auto inside = [lower](size_t row, size_t column) {
+                return lower ? row > column : row < column;
+            };
+
+            // Transpose the triangle into rows.
+            for (size_t c = 0; c < Size; ++c) {
+#ifndef NDEBUG
+                bool diagonal = unit;
+#endif
+                for (size_t p = t.rep.cols[c]; p < t.rep.cols[c + 1]; ++p) {
+                    size_t r = t.rep.rows[p];
+                    if (inside(r, c)) {
+                        ++_rowStart[r + 1];
+                    } else if (r == c && !unit) {
+                        _diagonal[r] = t.rep.vals[p];
+#ifndef NDEBUG
+                        diagonal = true;
+#endif
+                    }
+                }
+#ifndef NDEBUG
+                if (!diagonal) {
+                    throw std::runtime_error("Missing diagonal value.");
+                }
+#endif
+            }
+            for (size_t r = 0; r < Size; ++r) {
+                _rowStart[r + 1] += _rowStart[r];
+            }
+
+            std::vector<size_t> position(_rowStart.begin(), _rowStart.end() - 1);
+            _columns.resize(_rowStart[Size]);
+            _values.resize(_rowStart[Size]);
+            for (size_t c = 0; c < Size; ++c) {
+                for (size_t p = t.rep.cols[c]; p < t.rep.cols[c + 1]; ++p) {
+                    size_t r = t.rep.rows[p];
+                    if (inside(r, c)) {
+                        _columns[position[r]] = c;
+                        _values[position[r]++] = t.rep.vals[p];
+                    }
+                }
+            }
+
+            // The level of a row is one more than the deepest row it depends on.
+            std::vector<size_t> level(Size, 0);
+            size_t levels = 0;
+            for (size_t k = 0; k < Size; ++k) {
+                size_t r = lower ? k : Size - 1 - k;
+                size_t value = 0;
+                for (size_t p = _rowStart[r]; p < _rowStart[r + 1]; ++p) {
+                    value = std::max(value, level[_columns[p]] + 1);
+                }
+                level[r] = value;
+                levels = std::max(levels, value + 1);
+            }
+
+            _levelStart.assign(levels + 1, 0);
+            for (size_t r = 0; r < Size; ++r) {
+                ++_levelStart[level[r] + 1];
+            }
+            for (size_t l = 0; l < levels; ++l) {
+                _levelStart[l + 1] += _levelStart[l];
+            }
+            _order.resize(Size);
+            position.assign(_levelStart.begin(), _levelStart.end() - 1);
+            for (size_t r = 0; r < Size; ++r) {
+                _order[position[level[r]]++] = r;
+            }
+        }
+
+        /**
+         * @return the triangle this schedule solves.
+         */
+        [[nodiscard]] SparseTriangle triangle() const {
+            return _triangle;
+        }
+
+        /**
+         * @return the amount of levels.
+         * Levels are solved one after another,
+         * so this is the length of the critical path of the solve.
+         */
+        [[nodiscard]] size_t levels() const {
+            return _levelStart.size() - 1;
+        }
+
+        /**
+         * Solves Tx = b in place.
+         * <p>
+         * The rows of each level are split across the given threads.
+         * Levels with few values are solved by the calling thread.
+         * Each row is computed the same way regardless of the amount of threads,
+         * so the result does not depend on it.
+         * See parallelFor() for more information.
+         *
+         * @param x the right-hand side, where the solution is stored.
+         * @param threads the maximum amount of threads. 0 uses all the hardware threads.
+         */
+        void solve(Type* x, size_t threads = 1) const {
+            auto solveRows = [this, x](size_t from, size_t to) {
+                for (size_t o = from; o < to; ++o) {
+                    size_t r = _order[o];
+                    Type sum = x[r];
+                    for (size_t p = _rowStart[r]; p < _rowStart[r + 1]; ++p) {
+                        sum -= _values[p] * x[_columns[p]];
+                    }
+                    x[r] = sum / _diagonal[r];
+                }
+            };
+
+            size_t minChunk = detail::sparseMinChunk(Size, _rowStart[Size] + Size);
+            for (size_t l = 0; l + 1 < _levelStart.size(); ++l) {
+                size_t from = _levelStart[l];
+                parallelFor(_levelStart[l + 1] - from, threads, [&](size_t begin, size_t end) {
+                    solveRows(from + begin, from + end);
+                }, minChunk);
+            }
+        }
+
+        template<typename XAlloc>
+        void solve(Vec<Size, Type, XAlloc>& x, size_t threads = 1) const {
+            solve(x.toPointer(), threads);
+        }
+    };
+}
+
+#endif //RUSH_MAT_SPARSE_TRIANGULAR_H
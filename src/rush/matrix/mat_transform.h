@@ -0,0 +1,310 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_MAT_TRANSFORM_H
+#define RUSH_MAT_TRANSFORM_H
+
+#include <array>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <rush/cpu.h>
+#include <rush/parallel.h>
+#include <rush/matrix/mat_base.h>
+#include <rush/vector/vec_simd.h>
+
+namespace rush {
+    /**
+     * How a three-component vector is extended
+     * before being multiplied by a 4x4 matrix.
+     */
+    enum class TransformMode {
+        /**
+         * The vector is a point (w = 1). The translation is applied.
+         */
+        Point,
+        /**
+         * The vector is a direction (w = 0). The translation is ignored.
+         */
+        Direction,
+        /**
+         * The vector is a point (w = 1). The result is divided by
+         * its resulting w component (perspective divide).
+         */
+        Projection
+    };
+
+    namespace detail {
+        template<TransformMode Mode, typename Type>
+        inline void transformGeneric(const Type* m,
+                                     const Vec<3, Type>* in,
+                                     Vec<3, Type>* out,
+                                     size_t from, size_t to) {
+            for (size_t i = from; i < to; ++i) {
+                Type x = in[i][0];
+                Type y = in[i][1];
+                Type z = in[i][2];
+
+                Type rx = m[0] * x + m[4] * y + m[8] * z;
+                Type ry = m[1] * x + m[5] * y + m[9] * z;
+                Type rz = m[2] * x + m[6] * y + m[10] * z;
+
+                if constexpr (Mode != TransformMode::Direction) {
+                    rx += m[12];
+                    ry += m[13];
+                    rz += m[14];
+                }
+
+                if constexpr (Mode == TransformMode::Projection) {
+                    Type w = m[3] * x + m[7] * y + m[11] * z + m[15];
+                    rx /= w;
+                    ry /= w;
+                    rz /= w;
+                }
+
+                out[i][0] = rx;
+                out[i][1] = ry;
+                out[i][2] = rz;
+            }
+        }
+
+#ifdef RUSH_DISPATCH
+
+        template<TransformMode Mode>
+        RUSH_TARGET_SSE4 inline void transformSSE4(const float* m,
+                                                   const Vec<3, float>* in,
+                                                   Vec<3, float>* out,
+                                                   size_t from, size_t to) {
+            __m128 c0 = _mm_loadu_ps(m);
+            __m128 c1 = _mm_loadu_ps(m + 4);
+            __m128 c2 = _mm_loadu_ps(m + 8);
+            __m128 c3 = Mode == TransformMode::Direction
+                            ? _mm_setzero_ps()
+                            : _mm_loadu_ps(m + 12);
+
+            for (size_t i = from; i < to; ++i) {
+                const float* p = in[i].toPointer();
+                __m128 xy = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(p[0])),
+                                       _mm_mul_ps(c1, _mm_set1_ps(p[1])));
+                __m128 zw = _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(p[2])), c3);
+                __m128 r = _mm_add_ps(xy, zw);
+                if constexpr (Mode == TransformMode::Projection) {
+                    r = _mm_div_ps(r, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
+                }
+                simd::detail::store<3>(out[i].toPointer(), r);
+            }
+        }
+
+        /**
+         * Transforms two vectors per iteration, one on each
+         * 128-bit half of the AVX registers.
+         */
+        template<TransformMode Mode>
+        RUSH_TARGET_AVX2 inline void transformAVX2(const float* m,
+                                                   const Vec<3, float>* in,
+                                                   Vec<3, float>* out,
+                                                   size_t from, size_t to) {
+            __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m));
+            __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 4));
+            __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 8));
+            __m256 c3 = Mode == TransformMode::Direction
+                            ? _mm256_setzero_ps()
+                            : _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m + 12));
+
+            size_t i = from;
+            for (; i + 2 <= to; i += 2) {
+                const float* a = in[i].toPointer();
+                const float* b = in[i + 1].toPointer();
+                __m256 x = _mm256_set_m128(_mm_set1_ps(b[0]), _mm_set1_ps(a[0]));
+                __m256 y = _mm256_set_m128(_mm_set1_ps(b[1]), _mm_set1_ps(a[1]));
+                __m256 z = _mm256_set_m128(_mm_set1_ps(b[2]), _mm_set1_ps(a[2]));
+
+                __m256 r = _mm256_fmadd_ps(c0, x, c3);
+                r = _mm256_fmadd_ps(c1, y, r);
+                r = _mm256_fmadd_ps(c2, z, r);
+                if constexpr (Mode == TransformMode::Projection) {
+                    r = _mm256_div_ps(r, _mm256_permute_ps(r, _MM_SHUFFLE(3, 3, 3, 3)));
+                }
+
+                simd::detail::store<3>(out[i].toPointer(), _mm256_castps256_ps128(r));
+                simd::detail::store<3>(out[i + 1].toPointer(), _mm256_extractf128_ps(r, 1));
+            }
+
+            if (i < to) {
+                transformSSE4<Mode>(m, in, out, i, to);
+            }
+        }
+
+#endif
+
+        template<TransformMode Mode, typename Type>
+        void transformChunk(const Type* m,
+                            const Vec<3, Type>* in,
+                            Vec<3, Type>* out,
+                            size_t from, size_t to) {
+#ifdef RUSH_DISPATCH
+            if constexpr (std::is_same_v<Type, float>) {
+                switch (cpu::instructionSet()) {
+                    case InstructionSet::AVX512:
+                    case InstructionSet::AVX2:
+                        transformAVX2<Mode>(m, in, out, from, to);
+                        return;
+                    case InstructionSet::SSE4:
+                        transformSSE4<Mode>(m, in, out, from, to);
+                        return;
+                    default:
+                        break;
+                }
+            }
+#endif
+            transformGeneric<Mode>(m, in, out, from, to);
+        }
+    }
+
+    /**
+     * Multiplies all the given vectors by the given matrix.
+     * <p>
+     * The vectors are extended to four components as specified by Mode.
+     * The matrix is read once, and the vectors are transformed using the
+     * kernel of the instruction set returned by cpu::instructionSet().
+     * <p>
+     * The transformation may be split across several threads.
+     * See parallelFor() for more information.
+     * <p>
+     * The input and the output may be the same span.
+     * Partially overlapping spans are not allowed.
+     *
+     * @tparam Mode how the vectors are extended.
+     * @param matrix the transformation matrix.
+     * @param vectors the vectors to transform.
+     * @param result the span where the results are written.
+     * It must have the same size as vectors.
+     * @param threads the maximum amount of threads to use.
+     * 0 uses all the hardware threads.
+     */
+    template<TransformMode Mode, typename Type, typename Rep, typename Alloc>
+    void transform(const Mat<4, 4, Type, Rep, Alloc>& matrix,
+                   std::type_identity_t<std::span<const Vec<3, Type>>> vectors,
+                   std::type_identity_t<std::span<Vec<3, Type>>> result,
+                   size_t threads = 1) {
+#ifndef NDEBUG
+        if (vectors.size() != result.size()) {
+            throw std::runtime_error("The input and output spans have different sizes.");
+        }
+#endif
+        std::array<Type, 16> m;
+        for (size_t c = 0; c < 4; ++c) {
+            for (size_t r = 0; r < 4; ++r) {
+                m[c * 4 + r] = matrix(c, r);
+            }
+        }
+
+        parallelFor(vectors.size(), threads, [&](size_t from, size_t to) {
+            detail::transformChunk<Mode>(m.data(), vectors.data(), result.data(), from, to);
+        });
+    }
+
+    /**
+     * Transforms all the given points (w = 1) using the given matrix,
+     * discarding the resulting w component.
+     * <p>
+     * Use projectPoints() when the matrix contains a projection.
+     *
+     * @param matrix the transformation matrix.
+     * @param points the points to transform.
+     * @param result the span where the transformed points are written.
+     * It must have the same size as points.
+     * @param threads the maximum amount of threads to use.
+     */
+    template<typename Type, typename Rep, typename Alloc>
+    void transformPoints(const Mat<4, 4, Type, Rep, Alloc>& matrix,
+                         std::type_identity_t<std::span<const Vec<3, Type>>> points,
+                         std::type_identity_t<std::span<Vec<3, Type>>> result,
+                         size_t threads = 1) {
+        transform<TransformMode::Point>(matrix, points, result, threads);
+    }
+
+    /**
+     * Transforms all the given points (w = 1) in place.
+     *
+     * @param matrix the transformation matrix.
+     * @param points the points to transform.
+     * @param threads the maximum amount of threads to use.
+     */
+    template<typename Type, typename Rep, typename Alloc>
+    void transformPoints(const Mat<4, 4, Type, Rep, Alloc>& matrix,
+                         std::type_identity_t<std::span<Vec<3, Type>>> points,
+                         size_t threads = 1) {
+        transform<TransformMode::Point>(matrix, points, points, threads);
+    }
+
+    /**
+     * Transforms all the given directions (w = 0) using the given matrix.
+     * The translation of the matrix is ignored.
+     *
+     * @param matrix the transformation matrix.
+     * @param directions the directions to transform.
+     * @param result the span where the transformed directions are written.
+     * It must have the same size as directions.
+     * @param threads the maximum amount of threads to use.
+     */
+    template<typename Type, typename Rep, typename Alloc>
+    void transformDirections(const Mat<4, 4, Type, Rep, Alloc>& matrix,
+                             std::type_identity_t<std::span<const Vec<3, Type>>> directions,
+                             std::type_identity_t<std::span<Vec<3, Type>>> result,
+                             size_t threads = 1) {
+        transform<TransformMode::Direction>(matrix, directions, result, threads);
+    }
+
+    /**
+     * Transforms all the given directions (w = 0) in place.
+     *
+     * @param matrix the transformation matrix.
+     * @param directions the directions to transform.
+     * @param threads the maximum amount of threads to use.
+     */
+    template<typename Type, typename Rep, typename Alloc>
+    void transformDirections(const Mat<4, 4, Type, Rep, Alloc>& matrix,
+                             std::type_identity_t<std::span<Vec<3, Type>>> directions,
+                             size_t threads = 1) {
+        transform<TransformMode::Direction>(matrix, directions, directions, threads);
+    }
+
+    /**
+     * Transforms all the given points (w = 1) using the given matrix
+     * and divides the results by their w component.
+     * <p>
+     * Points with a resulting w of zero produce infinite or NaN components.
+     *
+     * @param matrix the projection matrix.
+     * @param points the points to project.
+     * @param result the span where the projected points are written.
+     * It must have the same size as points.
+     * @param threads the maximum amount of threads to use.
+     */
+    template<typename Type, typename Rep, typename Alloc>
+    void projectPoints(const Mat<4, 4, Type, Rep, Alloc>& matrix,
+                       std::type_identity_t<std::span<const Vec<3, Type>>> points,
+                       std::type_identity_t<std::span<Vec<3, Type>>> result,
+                       size_t threads = 1) {
+        transform<TransformMode::Projection>(matrix, points, result, threads);
+    }
+
+    /**
+     * Projects all the given points (w = 1) in place.
+     *
+     * @param matrix the projection matrix.
+     * @param points the points to project.
+     * @param threads the maximum amount of threads to use.
+     */
+    template<typename Type, typename Rep, typename Alloc>
+    void projectPoints(const Mat<4, 4, Type, Rep, Alloc>& matrix,
+                       std::type_identity_t<std::span<Vec<3, Type>>> points,
+                       size_t threads = 1) {
+        transform<TransformMode::Projection>(matrix, points, points, threads);
+    }
+}
+
+#endif //RUSH_MAT_TRANSFORM_H
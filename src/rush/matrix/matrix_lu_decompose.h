@@ -5,56 +5,324 @@
 #ifndef MATRIX_LU_DECOMPOSE_H
 #define MATRIX_LU_DECOMPOSE_H
 
+#include <bit>
+#include <vector>
+#include <numeric>
+#include <algorithm>
 #include <rush/matrix/mat_sparse_rep.h>
+#include <rush/matrix/mat_sparse_ordering.h>
 
 namespace rush {
-    template<size_t Columns, size_t Rows, typename Type, typename Allocator, typename OAlloc>
-    bool sparseLUDecompose(const Mat<Columns, Rows, Type, MatSparseRep, Allocator>& matrix,
-                           Mat<Columns, Rows, Type, MatSparseRep, OAlloc>& out) {
-        constexpr Type ZERO = static_cast<Type>(0);
+    /**
+     * The sparse LU factorization PAPᵀ = LU, being P a fill-reducing permutation,
+     * L unit lower triangular and U upper triangular.
+     * <p>
+     * The factorization is split in two phases.
+     * The constructor runs the symbolic analysis: it computes the permutation
+     * and the pattern of L and U, assuming no value cancels out.
+     * factorize() computes the values. While the structure of the matrix
+     * does not change, factorize() may be called again with new values
+     * without repeating the analysis or allocating memory.
+     * <p>
+     * Pivots are taken from the diagonal: the permutation is applied
+     * to both rows and columns, and rows are not exchanged for stability.
+     * The factorization fails if a value of L must be divided by a zero pivot.
+     * This suits diagonally dominant and symmetric positive definite matrices.
+     *
+     * @tparam Size the size of the system.
+     * @tparam Type the type of the values.
+     */
+    template<size_t Size, typename Type>
+    class SparseLU {
+        std::vector<size_t> _permutation;
+        std::vector<size_t> _inverse;
+        Mat<Size, Size, Type, MatSparseRep> _factors;
+        std::vector<size_t> _diagonal;
+        std::vector<Type> _work;
+        std::vector<size_t> _mark;
+        bool _valid;
 
-        Vec<Columns, std::vector<std::pair<size_t, Type>>> tempLU;
-        for (auto& entry: tempLU) entry.reserve(Columns);
-        size_t amount = 0;
-
-        for (size_t col = 0; col < Columns; ++col) {
-            Vec<Columns, Type> columnValues;
-            for (int idx = matrix.rep.cols[col]; idx < matrix.rep.cols[col + 1]; ++idx) {
-                columnValues[matrix.rep.rows[idx]] = matrix.rep.vals[idx];
+    public:
+        /**
+         * Runs the symbolic analysis of the given matrix.
+         * Only the structure of the matrix is read.
+         * The rows of every column must be sorted, as done by Mat and SparseBuilder.
+         *
+         * @param a the matrix of the system.
+         * @param ordering the ordering applied to the matrix.
+         */
+        template<typename Allocator>
+        explicit SparseLU(const Mat<Size, Size, Type, MatSparseRep, Allocator>& a,
+                          SparseOrdering ordering = SparseOrdering::ApproximateMinimumDegree)
+            : _inverse(Size),
+              _diagonal(Size),
+              _work(Size, static_cast<Type>(0)),
+              _mark(Size),
+              _valid(false) {
+            if (ordering == SparseOrdering::ApproximateMinimumDegree) {
+                _permutation = approximateMinimumDegree(a);
+            } else {
+                _permutation.resize(Size);
+                std::iota(_permutation.begin(), _permutation.end(), 0);
             }
+            for (size_t k = 0; k < Size; ++k) {
+                _inverse[_permutation[k]] = k;
+            }
+
+            auto& cols = _factors.rep.cols;
+            auto& rows = _factors.rep.rows;
+            std::vector<size_t> mark(Size, Size), stack;
+            // The end of the part of each column of L searched by the analysis.
+            std::vector<size_t> pruned(Size);
 
-            for (size_t i = 0; i < col; ++i) {
-                Type factor = columnValues[i];
-                if (factor != ZERO) {
-                    for (const auto& [row, val]: tempLU[i]) {
-                        if (row > i) {
-                            columnValues[row] -= factor * val;
+            // Column j of LU is the pattern of column j of PAPᵀ plus
+            // the patterns of the columns of L selected by it.
+            cols[0] = 0;
+            for (size_t j = 0; j < Size; ++j) {
+                size_t start = rows.size();
+                // The diagonal is always stored, even if it is structurally zero.
+                mark[j] = j;
+                rows.push_back(j);
+
+                size_t source = _permutation[j];
+                for (size_t p = a.rep.cols[source]; p < a.rep.cols[source + 1]; ++p) {
+                    size_t i = _inverse[a.rep.rows[p]];
+                    if (mark[i] != j) {
+                        mark[i] = j;
+                        rows.push_back(i);
+                        if (i < j) stack.push_back(i);
+                    }
+                }
+
+                while (!stack.empty()) {
+                    size_t k = stack.back();
+                    stack.pop_back();
+                    for (size_t q = _diagonal[k] + 1; q < pruned[k]; ++q) {
+                        size_t i = rows[q];
+                        if (mark[i] != j) {
+                            mark[i] = j;
+                            rows.push_back(i);
+                            if (i < j) stack.push_back(i);
                         }
                     }
                 }
+
+                size_t amount = rows.size() - start;
+                if (amount * std::bit_width(amount) > Size) {
+                    // Crowded column: scanning the marks is cheaper than sorting.
+                    rows.resize(start);
+                    for (size_t i = 0; i < Size; ++i) {
+                        if (mark[i] == j) rows.push_back(i);
+                    }
+                } else {
+                    std::sort(rows.begin() + start, rows.end());
+                }
+                _diagonal[j] = std::lower_bound(rows.begin() + start, rows.end(), j) - rows.begin();
+                cols[j + 1] = rows.size();
+                pruned[j] = rows.size();
+
+                // Symmetric pruning (Eisenstat and Liu): if U(k, j) and L(j, k) are both
+                // stored, the rows of L(:, k) below j are also reached through j.
+                for (size_t q = start; q < _diagonal[j]; ++q) {
+                    size_t k = rows[q];
+                    if (pruned[k] != cols[k + 1]) continue;
+                    auto begin = rows.begin() + _diagonal[k] + 1;
+                    auto end = rows.begin() + cols[k + 1];
+                    auto found = std::lower_bound(begin, end, j);
+                    if (found != end && *found == j) {
+                        pruned[k] = found - rows.begin() + 1;
+                    }
+                }
             }
 
-            for (size_t i = 0; i < Columns; ++i) {
-                if (columnValues[i] != ZERO) {
-                    if (i <= col) {
-                        tempLU[col].emplace_back(i, columnValues[i]); // U
-                    } else {
-                        if (columnValues[col] == ZERO) return false;
-                        tempLU[col].emplace_back(i, columnValues[i] / columnValues[col]); // L
+            _factors.rep.vals.assign(rows.size(), static_cast<Type>(0));
+        }
+
+        /**
+         * Computes the values of L and U.
+         * <p>
+         * The matrix must have the structure of the analyzed one,
+         * or a subset of it. Only its values may have changed.
+         * The factorization fails if the matrix has a value outside
+         * the analyzed pattern or a pivot becomes zero while
+         * the values of L below it are not.
+         * A zero pivot without values below it, such as the last one,
+         * is kept in U, as done by luDecomposed(): solving produces infinities.
+         *
+         * @param a the matrix of the system.
+         * @return whether the factorization succeeded.
+         */
+        template<typename Allocator>
+        bool factorize(const Mat<Size, Size, Type, MatSparseRep, Allocator>& a) {
+            constexpr Type ZERO = static_cast<Type>(0);
+            const auto& cols = _factors.rep.cols;
+            const auto& rows = _factors.rep.rows;
+            auto& vals = _factors.rep.vals;
+            std::fill(_mark.begin(), _mark.end(), Size);
+            _valid = false;
+
+            for (size_t j = 0; j < Size; ++j) {
+                for (size_t q = cols[j]; q < cols[j + 1]; ++q) {
+                    _mark[rows[q]] = j;
+                }
+
+                size_t source = _permutation[j];
+                for (size_t p = a.rep.cols[source]; p < a.rep.cols[source + 1]; ++p) {
+                    size_t i = _inverse[a.rep.rows[p]];
+                    if (_mark[i] != j) {
+                        std::fill(_work.begin(), _work.end(), ZERO);
+                        return false;
+                    }
+                    _work[i] = a.rep.vals[p];
+                }
+
+                // Left-looking update: U(k, j) is final once every k' < k is applied.
+                for (size_t q = cols[j]; q < _diagonal[j]; ++q) {
+                    size_t k = rows[q];
+                    Type ukj = _work[k];
+                    if (ukj == ZERO) continue;
+                    for (size_t s = _diagonal[k] + 1; s < cols[k + 1]; ++s) {
+                        _work[rows[s]] -= vals[s] * ukj;
+                    }
+                }
+
+                // A zero pivot only fails when a value of L must be divided by it.
+                // Otherwise, U is singular and the factorization is still exact.
+                Type pivot = _work[j];
+                if (pivot == ZERO) {
+                    for (size_t q = _diagonal[j] + 1; q < cols[j + 1]; ++q) {
+                        if (_work[rows[q]] != ZERO) {
+                            std::fill(_work.begin(), _work.end(), ZERO);
+                            return false;
+                        }
                     }
-                    ++amount;
+                }
+
+                Type inverse = pivot == ZERO ? ZERO : static_cast<Type>(1) / pivot;
+                for (size_t q = cols[j]; q < cols[j + 1]; ++q) {
+                    size_t i = rows[q];
+                    vals[q] = i > j ? _work[i] * inverse : _work[i];
+                    _work[i] = ZERO;
                 }
             }
+
+            _valid = true;
+            return true;
+        }
+
+        /**
+         * @return whether the last call to factorize() succeeded.
+         * Solving with an invalid factorization produces undefined values.
+         */
+        [[nodiscard]] bool valid() const {
+            return _valid;
+        }
+
+        /**
+         * @return the permutation. The position k holds the row and column of A
+         * moved to the position k.
+         */
+        [[nodiscard]] const std::vector<size_t>& permutation() const {
+            return _permutation;
+        }
+
+        /**
+         * @return L and U of PAPᵀ, stored like the result of sparseLUDecompose().
+         * Positions that cancel out are kept as zeros.
+         */
+        [[nodiscard]] const Mat<Size, Size, Type, MatSparseRep>& factors() const {
+            return _factors;
+        }
+
+        /**
+         * @return the amount of values stored in L and U, including the diagonal.
+         * This is the memory the fill-reducing ordering tries to reduce.
+         */
+        [[nodiscard]] size_t nonZeros() const {
+            return _factors.rep.rows.size();
         }
 
-        out.rep.rows.reserve(amount);
-        out.rep.vals.reserve(amount);
-        for (int col = 0; col < Columns; ++col) {
-            out.rep.cols[col + 1] = out.rep.cols[col] + tempLU[col].size();
-            for (const auto& [row, val]: tempLU[col]) {
-                out.rep.rows.push_back(row);
-                out.rep.vals.push_back(val);
+        /**
+         * Solves Ax = b.
+         * @param b the right-hand side.
+         * @param x the array where the solution is stored. It may be b.
+         */
+        void solve(const Type* b, Type* x) const {
+            const auto& cols = _factors.rep.cols;
+            const auto& rows = _factors.rep.rows;
+            const auto& vals = _factors.rep.vals;
+
+            std::vector<Type> y(Size);
+            for (size_t k = 0; k < Size; ++k) {
+                y[k] = b[_permutation[k]];
+            }
+
+            // L z = Pb, by columns.
+            for (size_t j = 0; j < Size; ++j) {
+                Type yj = y[j];
+                for (size_t p = _diagonal[j] + 1; p < cols[j + 1]; ++p) {
+                    y[rows[p]] -= vals[p] * yj;
+                }
+            }
+
+            // U Px = z, by columns.
+            for (size_t j = Size; j > 0; --j) {
+                size_t c = j - 1;
+                Type yc = y[c] / vals[_diagonal[c]];
+                y[c] = yc;
+                for (size_t p = cols[c]; p < _diagonal[c]; ++p) {
+                    y[rows[p]] -= vals[p] * yc;
+                }
+            }
+
+            for (size_t k = 0; k < Size; ++k) {
+                x[_permutation[k]] = y[k];
+            }
+        }
+
+        template<typename BAlloc>
+        Vec<Size, Type, BAlloc> solve(const Vec<Size, Type, BAlloc>& b) const {
+            Vec<Size, Type, BAlloc> x;
+            solve(b.toPointer(), x.toPointer());
+            return x;
+        }
+    };
+
+    /**
+     * Decomposes the given sparse matrix into L and U, in natural order.
+     * U is stored in the rows up to the diagonal and L, without its unit diagonal,
+     * below it. Positions whose value is zero are not stored.
+     * <p>
+     * This runs both phases of SparseLU.
+     * Use SparseLU directly to apply a fill-reducing ordering or
+     * to factorize several matrices sharing the same structure.
+     *
+     * @param matrix the matrix to decompose.
+     * @param out the matrix where L and U are stored.
+     * @return whether the decomposition succeeded.
+     */
+    template<size_t Columns, size_t Rows, typename Type, typename Allocator, typename OAlloc>
+    bool sparseLUDecompose(const Mat<Columns, Rows, Type, MatSparseRep, Allocator>& matrix,
+                           Mat<Columns, Rows, Type, MatSparseRep, OAlloc>& out) {
+        constexpr Type ZERO = static_cast<Type>(0);
+
+        SparseLU<Columns, Type> lu(matrix, SparseOrdering::Natural);
+        if (!lu.factorize(matrix)) return false;
+
+        const auto& factors = lu.factors().rep;
+        out.rep.rows.clear();
+        out.rep.vals.clear();
+        out.rep.rows.reserve(factors.vals.size());
+        out.rep.vals.reserve(factors.vals.size());
+        out.rep.cols[0] = 0;
+        for (size_t col = 0; col < Columns; ++col) {
+            for (size_t p = factors.cols[col]; p < factors.cols[col + 1]; ++p) {
+                if (factors.vals[p] != ZERO) {
+                    out.rep.rows.push_back(factors.rows[p]);
+                    out.rep.vals.push_back(factors.vals[p]);
+                }
             }
+            out.rep.cols[col + 1] = out.rep.vals.size();
         }
 
         return true;
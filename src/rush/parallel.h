@@ -0,0 +1,129 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_PARALLEL_H
+#define RUSH_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace rush {
+    /**
+     * The minimum amount of elements a thread must process
+     * when a bulk operation is split across several threads.
+     * <p>
+     * Smaller chunks cost more to schedule than to compute.
+     */
+    constexpr size_t PARALLEL_MIN_CHUNK = 4096;
+
+    namespace detail {
+        inline size_t parallelChunks(size_t count, size_t threads, size_t minChunk) {
+            if (threads == 0) {
+                threads = std::max(std::thread::hardware_concurrency(), 1u);
+            }
+            return std::min(threads, std::max<size_t>(count / std::max<size_t>(minChunk, 1), 1));
+        }
+    }
+
+    /**
+     * Splits the range [0, count) into contiguous chunks and calls
+     * function(from, to) for each one of them.
+     * <p>
+     * The chunks are processed by up to the given amount of threads.
+     * The calling thread processes the last chunk.
+     * If threads is 0, std::thread::hardware_concurrency() is used.
+     * Chunks have at least minChunk elements, so small ranges
+     * are processed by the calling thread only.
+     *
+     * @param count the amount of elements.
+     * @param threads the maximum amount of threads.
+     * @param function the function to call for each chunk.
+     * @param minChunk the minimum amount of elements of a chunk.
+     * Operations with expensive elements may use a smaller value
+     * than the default one.
+     */
+    template<typename Function>
+    void parallelFor(size_t count, size_t threads, Function&& function,
+                     size_t minChunk = PARALLEL_MIN_CHUNK) {
+        size_t chunks = detail::parallelChunks(count, threads, minChunk);
+
+        if (chunks <= 1) {
+            function(size_t(0), count);
+            return;
+        }
+
+        size_t chunkSize = (count + chunks - 1) / chunks;
+        std::vector<std::jthread> workers;
+        workers.reserve(chunks - 1);
+
+        size_t from = 0;
+        for (size_t i = 0; i < chunks - 1; ++i) {
+            size_t to = std::min(from + chunkSize, count);
+            workers.emplace_back([&function, from, to] { function(from, to); });
+            from = to;
+        }
+
+        function(from, count);
+    }
+
+    /**
+     * Splits the range [0, count) into contiguous chunks, calls
+     * function(from, to) for each one of them and combines the results
+     * using combine(left, right).
+     * <p>
+     * The chunks are created and processed like in parallelFor().
+     * The results are combined in the order of their chunks,
+     * so the result does not depend on the scheduling of the threads.
+     * If only one chunk is created, its result is returned directly.
+     *
+     * @param count the amount of elements.
+     * @param threads the maximum amount of threads.
+     * @param function the function to call for each chunk.
+     * It must return a default-constructible value.
+     * @param combine the function combining two results.
+     * @param minChunk the minimum amount of elements of a chunk.
+     * @return the combined result.
+     */
+    template<typename Function, typename Combine>
+    std::invoke_result_t<Function&, size_t, size_t>
+    parallelReduce(size_t count, size_t threads, Function&& function, Combine&& combine,
+                   size_t minChunk = PARALLEL_MIN_CHUNK) {
+        using Result = std::invoke_result_t<Function&, size_t, size_t>;
+        size_t chunks = detail::parallelChunks(count, threads, minChunk);
+
+        if (chunks <= 1) {
+            return function(size_t(0), count);
+        }
+
+        size_t chunkSize = (count + chunks - 1) / chunks;
+        std::vector<Result> results(chunks);
+
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(chunks - 1);
+
+            size_t from = 0;
+            for (size_t i = 0; i < chunks - 1; ++i) {
+                size_t to = std::min(from + chunkSize, count);
+                workers.emplace_back([&function, &results, i, from, to] {
+                    results[i] = function(from, to);
+                });
+                from = to;
+            }
+
+            results.back() = function(from, count);
+        }
+
+        Result result = std::move(results.front());
+        for (size_t i = 1; i < chunks; ++i) {
+            result = combine(result, results[i]);
+        }
+        return result;
+    }
+}
+
+#endif //RUSH_PARALLEL_H
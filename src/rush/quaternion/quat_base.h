@@ -22,7 +22,7 @@ namespace rush {
         /**
          * Creates a quaternion with an identity rotation: (0, {1, 0, 0}).
          */
-        Quat();
+        constexpr Quat();
 
         /**
          * Creates a quaternion with the given raw parameters.
@@ -31,7 +31,7 @@ namespace rush {
          * @param y the y-axis value.
          * @param z the z-axis value.
          */
-        Quat(Type s, Type x, Type y, Type z);
+        constexpr Quat(Type s, Type x, Type y, Type z);
 
         // REGION ACCESSORS
 
@@ -44,7 +44,7 @@ namespace rush {
          * @param index the index.
          * @return the element.
          */
-        inline Type& operator[](size_t index);
+        constexpr Type& operator[](size_t index);
 
         /**
          * Returns a reference to the elemento located at
@@ -55,7 +55,7 @@ namespace rush {
          * @param index the index.
          * @return the element.
          */
-        inline const Type& operator[](size_t index) const;
+        constexpr const Type& operator[](size_t index) const;
 
         // ENDREGION
 
@@ -63,11 +63,11 @@ namespace rush {
 
         // UNARY
 
-        inline Quat& operator+();
+        constexpr Quat& operator+();
 
-        inline const Quat& operator+() const;
+        constexpr const Quat& operator+() const;
 
-        inline Quat operator-() const;
+        constexpr Quat operator-() const;
 
         /**
          * Returns the squared length (or squared modulus) of this quaternion.
@@ -77,7 +77,7 @@ namespace rush {
          *
          * @return the squared length.
          */
-        inline Type squaredLength() const requires HasAdd<Type> && HasMul<Type>;
+        constexpr Type squaredLength() const requires HasAdd<Type> && HasMul<Type>;
 
         /**
          * Returns the length (or modulus) of this quaternion.
@@ -88,7 +88,7 @@ namespace rush {
          * @return the length.
          */
         template<typename Return = Type>
-        inline Return length() const requires
+        constexpr Return length() const requires
             std::is_convertible_v<Type, Return> && HasSquaredRoot<Type>;
 
         /**
@@ -109,7 +109,7 @@ namespace rush {
          *
          */
         template<typename Return = Type, Algorithm Algorithm = Algorithm()>
-        Return inverseLength() const requires (
+        constexpr Return inverseLength() const requires (
             std::is_convertible_v<Type, Return> && HasSquaredRoot<Type>);
 
         /**
@@ -134,7 +134,7 @@ namespace rush {
          *
          */
         template<typename Return = Type, Algorithm Algorithm = Algorithm()>
-        inline Quat<Return> normalized() const requires HasDiv<Type>;
+        constexpr Quat<Return> normalized() const requires HasDiv<Type>;
 
         /**
          * Returns the conjugate of this quaternion.
@@ -146,7 +146,7 @@ namespace rush {
          *
          * @return the conjugate.
          */
-        inline Quat conjugate() const;
+        constexpr Quat conjugate() const;
 
         /**
          * Returns the inverse of this quaternion.
@@ -154,7 +154,7 @@ namespace rush {
          * This is not the inverse rotation! Use the conjugate instead.
          * @return the inverse.
          */
-        inline Quat inverse() const;
+        constexpr Quat inverse() const;
 
         /**
          * Returns the pitch of the rotation represented by this
@@ -193,7 +193,7 @@ namespace rush {
          * @return the directional part.
          */
         template<typename Alloc = StaticAllocator>
-        inline Vec<3, Type, Alloc> directionalPart() const;
+        constexpr Vec<3, Type, Alloc> directionalPart() const;
 
         /**
          * Returns the rotation matrix that applies the
@@ -202,7 +202,7 @@ namespace rush {
          * @return the rotation matrix.
          */
         template<typename ARep = MatDenseRep, typename Alloc = StaticAllocator>
-        Mat<3, 3, Type, ARep, Alloc> rotationMatrix3() const;
+        constexpr Mat<3, 3, Type, ARep, Alloc> rotationMatrix3() const;
 
         /**
          * Returns the rotation matrix that applies the
@@ -211,7 +211,7 @@ namespace rush {
          * @return the rotation matrix.
          */
         template<typename ARep = MatDenseRep, typename Alloc = StaticAllocator>
-        Mat<4, 4, Type, ARep, Alloc> rotationMatrix4() const;
+        constexpr Mat<4, 4, Type, ARep, Alloc> rotationMatrix4() const;
 
         /**
          * Returns a vector containing all the data of this quaternion.
@@ -219,43 +219,43 @@ namespace rush {
          * @return the vector.
          */
         template<typename Alloc = StaticAllocator>
-        Vec<4, Type, Alloc> toVec() const;
+        constexpr Vec<4, Type, Alloc> toVec() const;
 
         template<typename To>
-        Quat<To> cast() const;
+        constexpr Quat<To> cast() const;
 
         // QUAT - SCALAR
 
-        inline Quat operator+(const Type& o) const requires HasAdd<Type>;
+        constexpr Quat operator+(const Type& o) const requires HasAdd<Type>;
 
-        inline Quat operator-(const Type& o) const requires HasSub<Type>;
+        constexpr Quat operator-(const Type& o) const requires HasSub<Type>;
 
-        inline Quat operator*(const Type& o) const requires HasMul<Type>;
+        constexpr Quat operator*(const Type& o) const requires HasMul<Type>;
 
-        inline Quat operator/(const Type& o) const requires HasDiv<Type>;
+        constexpr Quat operator/(const Type& o) const requires HasDiv<Type>;
 
         // QUAT - QUAT
 
-        inline Type dot(const Quat& o) const;
+        constexpr Type dot(const Quat& o) const;
 
-        inline Quat operator+(const Quat& o) const requires HasAdd<Type>;
+        constexpr Quat operator+(const Quat& o) const requires HasAdd<Type>;
 
-        inline Quat operator-(const Quat& o) const requires HasSub<Type>;
+        constexpr Quat operator-(const Quat& o) const requires HasSub<Type>;
 
-        inline Quat operator*(const Quat& o) const requires
+        constexpr Quat operator*(const Quat& o) const requires
             HasAdd<Type> && HasSub<Type> && HasMul<Type>;
 
-        inline bool operator==(const Quat& o) const;
+        constexpr bool operator==(const Quat& o) const;
 
-        inline bool operator!=(const Quat& o) const;
+        constexpr bool operator!=(const Quat& o) const;
 
         // QUAT - VEC
 
-        inline Vec<3, Type> operator*(const Vec<3, Type>& o) const;
+        constexpr Vec<3, Type> operator*(const Vec<3, Type>& o) const;
 
         // LERP
 
-        Quat lerp(const Quat<Type>& o, Type a) const;
+        constexpr Quat lerp(const Quat<Type>& o, Type a) const;
 
         Quat slerp(const Quat<Type>& o, Type a) const;
 
@@ -291,7 +291,7 @@ namespace rush {
          * @param axis the axis.
          * @return the quaternion.
          */
-        inline static Quat angleAxis(Type angle, const Vec<3, Type>& axis);
+        static constexpr Quat angleAxis(Type angle, const Vec<3, Type>& axis);
 
         /**
          * Creates a quaternion that reproduces the rotation
@@ -301,7 +301,7 @@ namespace rush {
          */
         inline static Quat euler(const Vec<3, Type>& angles);
 
-        inline static Quat
+        static constexpr Quat
         fromTo(const Vec<3, Type>& from, const Vec<3, Type>& to);
 
         /**
@@ -324,7 +324,7 @@ namespace rush {
         * @param rot the rotation matrix.
         * @return the quaternion.
         */
-        static Quat fromRotationMatrix(const Mat<3, 3, Type>& rot);
+        static constexpr Quat fromRotationMatrix(const Mat<3, 3, Type>& rot);
 
         // ENDREGION
 
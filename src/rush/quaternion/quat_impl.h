@@ -11,56 +11,76 @@
 
 namespace rush {
     template<typename Type>
-    Quat<Type>::Quat() : s(Type(1)), x(Type(0)), y(Type(0)), z(Type(0)) {}
+    constexpr Quat<Type>::Quat() : s(Type(1)), x(Type(0)), y(Type(0)), z(Type(0)) {}
 
     template<typename Type>
-    Quat<Type>::Quat(Type d_, Type a_, Type b_, Type c_) : s(d_), x(a_), y(b_),
-                                                           z(c_) {}
+    constexpr Quat<Type>::Quat(Type d_, Type a_, Type b_, Type c_) : s(d_), x(a_), y(b_),
+                                                                     z(c_) {}
 
     template<typename Type>
-    Type& Quat<Type>::operator[](size_t index) {
+    constexpr Type& Quat<Type>::operator[](size_t index) {
+        if (std::is_constant_evaluated()) {
+            // Pointer arithmetic between members
+            // is not allowed in constant expressions.
+            switch (index) {
+                case 0: return s;
+                case 1: return x;
+                case 2: return y;
+                default: return z;
+            }
+        }
         return *(&s + index);
     }
 
     template<typename Type>
-    const Type& Quat<Type>::operator[](size_t index) const {
+    constexpr const Type& Quat<Type>::operator[](size_t index) const {
+        if (std::is_constant_evaluated()) {
+            // Pointer arithmetic between members
+            // is not allowed in constant expressions.
+            switch (index) {
+                case 0: return s;
+                case 1: return x;
+                case 2: return y;
+                default: return z;
+            }
+        }
         return *(&s + index);
     }
 
     template<typename Type>
-    Quat<Type>& Quat<Type>::operator+() {
+    constexpr Quat<Type>& Quat<Type>::operator+() {
         return *this;
     }
 
     template<typename Type>
-    const Quat<Type>& Quat<Type>::operator+() const {
+    constexpr const Quat<Type>& Quat<Type>::operator+() const {
         return *this;
     }
 
     template<typename Type>
-    Quat<Type> Quat<Type>::operator-() const {
+    constexpr Quat<Type> Quat<Type>::operator-() const {
         return {-s, -x, -y, -z};
     }
 
     template<typename Type>
-    Type
+    constexpr Type
     Quat<Type>::squaredLength() const requires HasAdd<Type> && HasMul<Type> {
         return s * s + x * x + y * y + z * z;
     }
 
     template<typename Type>
     template<typename Return>
-    Return Quat<Type>::length() const requires
+    constexpr Return Quat<Type>::length() const requires
         std::is_convertible_v<Type, Return> && HasSquaredRoot<Type> {
-        return static_cast<Return>(std::sqrt(squaredLength()));
+        return static_cast<Return>(rush::sqrt(squaredLength()));
     }
 
     template<typename Type>
     template<typename Return, Algorithm A>
-    Return Quat<Type>::inverseLength() const requires (
+    constexpr Return Quat<Type>::inverseLength() const requires (
         std::is_convertible_v<Type, Return> && HasSquaredRoot<Type>) {
         if constexpr (A.precision == Precision::High) {
-            return 1.0f / std::sqrt(squaredLength());
+            return 1.0f / rush::sqrt(squaredLength());
         }
 
         if constexpr (std::is_same_v<Return, float>) {
@@ -68,7 +88,9 @@ namespace rush {
 
 #ifdef RUSH_INTRINSICS
             if constexpr (A.useIntrinsics()) {
-                return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(v)));
+                if (!std::is_constant_evaluated()) {
+                    return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(v)));
+                }
             }
 #endif
 
@@ -86,7 +108,7 @@ namespace rush {
             return v * (1.5f - x2 * v * v);
         }
 
-        return 1.0f / std::sqrt(squaredLength());
+        return 1.0f / rush::sqrt(squaredLength());
     }
 
     template<typename Type>
@@ -96,18 +118,18 @@ namespace rush {
 
     template<typename Type>
     template<typename Return, Algorithm A>
-    Quat<Return> Quat<Type>::normalized() const requires HasDiv<Type> {
+    constexpr Quat<Return> Quat<Type>::normalized() const requires HasDiv<Type> {
         Return l = inverseLength<Return, A>();
         return {s * l, x * l, y * l, z * l};
     }
 
     template<typename Type>
-    Quat<Type> Quat<Type>::conjugate() const {
+    constexpr Quat<Type> Quat<Type>::conjugate() const {
         return {s, -x, -y, -z};
     }
 
     template<typename Type>
-    Quat<Type> Quat<Type>::inverse() const {
+    constexpr Quat<Type> Quat<Type>::inverse() const {
         return conjugate() / squaredLength();
     }
 
@@ -141,13 +163,13 @@ namespace rush {
 
     template<typename Type>
     template<typename Alloc>
-    Vec<3, Type, Alloc> Quat<Type>::directionalPart() const {
+    constexpr Vec<3, Type, Alloc> Quat<Type>::directionalPart() const {
         return {x, y, z};
     }
 
     template<typename Type>
     template<typename ARep, typename Alloc>
-    Mat<3, 3, Type, ARep, Alloc> Quat<Type>::rotationMatrix3() const {
+    constexpr Mat<3, 3, Type, ARep, Alloc> Quat<Type>::rotationMatrix3() const {
         Mat<3, 3, Type, ARep, Alloc> r;
 
         Type o = Type(1);
@@ -168,7 +190,7 @@ namespace rush {
 
     template<typename Type>
     template<typename ARep, typename Alloc>
-    Mat<4, 4, Type, ARep, Alloc> Quat<Type>::rotationMatrix4() const {
+    constexpr Mat<4, 4, Type, ARep, Alloc> Quat<Type>::rotationMatrix4() const {
         Mat<4, 4, Type, ARep, Alloc> r(Type(1.0));
 
         Type o = Type(1);
@@ -189,13 +211,13 @@ namespace rush {
 
     template<typename Type>
     template<typename Alloc>
-    Vec<4, Type, Alloc> Quat<Type>::toVec() const {
+    constexpr Vec<4, Type, Alloc> Quat<Type>::toVec() const {
         return Vec<4, Type, Alloc>(s, x, y, z);
     }
 
     template<typename Type>
     template<typename To>
-    Quat<To> Quat<Type>::cast() const {
+    constexpr Quat<To> Quat<Type>::cast() const {
         return Quat<To>(
             static_cast<To>(s),
             static_cast<To>(x),
@@ -205,48 +227,48 @@ namespace rush {
     }
 
     template<typename Type>
-    Quat<Type>
+    constexpr Quat<Type>
     Quat<Type>::operator+(const Type& o) const requires HasAdd<Type> {
         return {s + o, x + o, y + o, z + o};
     }
 
     template<typename Type>
-    Quat<Type>
+    constexpr Quat<Type>
     Quat<Type>::operator-(const Type& o) const requires HasSub<Type> {
         return {s - o, x - o, y - o, z - o};
     }
 
     template<typename Type>
-    Quat<Type>
+    constexpr Quat<Type>
     Quat<Type>::operator*(const Type& o) const requires HasMul<Type> {
         return {s * o, x * o, y * o, z * o};
     }
 
     template<typename Type>
-    Quat<Type>
+    constexpr Quat<Type>
     Quat<Type>::operator/(const Type& o) const requires HasDiv<Type> {
         return {s / o, x / o, y / o, z / o};
     }
 
     template<typename Type>
-    Type Quat<Type>::dot(const Quat& o) const {
+    constexpr Type Quat<Type>::dot(const Quat& o) const {
         return s * o.s + x * o.x + y * o.y + z * o.z;
     }
 
     template<typename Type>
-    Quat<Type>
+    constexpr Quat<Type>
     Quat<Type>::operator+(const Quat& o) const requires HasAdd<Type> {
         return {s + o.s, x + o.x, y + o.y, z + o.z};
     }
 
     template<typename Type>
-    Quat<Type>
+    constexpr Quat<Type>
     Quat<Type>::operator-(const Quat& o) const requires HasSub<Type> {
         return {s - o.s, x - o.x, y - o.y, z - o.z};
     }
 
     template<typename Type>
-    Quat<Type> Quat<Type>::operator*(const Quat& o) const requires
+    constexpr Quat<Type> Quat<Type>::operator*(const Quat& o) const requires
         HasAdd<Type> && HasSub<Type> && HasMul<Type> {
         Quat<Type> result;
         result.s = s * o.s - x * o.x - y * o.y - z * o.z;
@@ -257,17 +279,17 @@ namespace rush {
     }
 
     template<typename Type>
-    bool Quat<Type>::operator==(const Quat& o) const {
+    constexpr bool Quat<Type>::operator==(const Quat& o) const {
         return s == o.s && x == o.x && y == o.y && z == o.z;
     }
 
     template<typename Type>
-    bool Quat<Type>::operator!=(const Quat& o) const {
+    constexpr bool Quat<Type>::operator!=(const Quat& o) const {
         return s != o.s || x != o.x || y != o.y || z != o.z;
     }
 
     template<typename Type>
-    Vec<3, Type> Quat<Type>::operator*(const Vec<3, Type>& o) const {
+    constexpr Vec<3, Type> Quat<Type>::operator*(const Vec<3, Type>& o) const {
         Vec<3, Type> u = directionalPart();
         return Type(2) * u.dot(o) * u
                + (s * s - u.squaredLength()) * o
@@ -275,7 +297,7 @@ namespace rush {
     }
 
     template<typename Type>
-    Quat<Type> Quat<Type>::lerp(const Quat<Type>& o, Type a) const {
+    constexpr Quat<Type> Quat<Type>::lerp(const Quat<Type>& o, Type a) const {
         return *this * (Type(1) - a) + (o * a);
     }
 
@@ -305,10 +327,10 @@ namespace rush {
     }
 
     template<typename Type>
-    Quat<Type>
+    constexpr Quat<Type>
     Quat<Type>::angleAxis(Type angle, const Vec<3, Type>& axis) {
-        Type sin = std::sin(angle / Type(2));
-        Type d = std::cos(angle / Type(2));
+        Type sin = rush::sin(angle / Type(2));
+        Type d = rush::cos(angle / Type(2));
         Type a = axis.x() * sin;
         Type b = axis.y() * sin;
         Type c = axis.z() * sin;
@@ -329,15 +351,15 @@ namespace rush {
     }
 
     template<typename Type>
-    Quat<Type>
+    constexpr Quat<Type>
     Quat<Type>::fromTo(const Vec<3, Type>& from, const Vec<3, Type>& to) {
-        Type uv = std::sqrt(from.squaredLength() * to.squaredLength());
+        Type uv = rush::sqrt(from.squaredLength() * to.squaredLength());
         Type real = uv + from.dot(to);
 
         Vec<3, Type> u;
         if (real < Type(1.e-6f) * uv) {
             real = Type(0);
-            if (std::abs(from.x()) > std::abs(from.z())) {
+            if (rush::abs(from.x()) > rush::abs(from.z())) {
                 u = {-from.y(), from.x(), Type(0)};
             } else {
                 u = {Type(0), -from.z(), from.y()};
@@ -368,29 +390,29 @@ namespace rush {
     }
 
     template<typename Type>
-    Quat<Type> Quat<Type>::fromRotationMatrix(const Mat<3, 3, Type>& rot) {
+    constexpr Quat<Type> Quat<Type>::fromRotationMatrix(const Mat<3, 3, Type>& rot) {
         Quat q;
         auto trace = rot(0, 0) + rot(1, 1) + rot(2, 2);
         if (trace > 0.0f) {
-            auto s = 2.0f * std::sqrt(trace + 1.0f);
+            auto s = 2.0f * rush::sqrt(trace + 1.0f);
             q.s = s / 4.0f;
             q.x = (rot(1, 2) - rot(2, 1)) / s;
             q.y = (rot(2, 0) - rot(0, 2)) / s;
             q.z = (rot(0, 1) - rot(1, 0)) / s;
         } else if (rot(0, 0) > rot(1, 1) && rot(0, 0) > rot(2, 2)) {
-            auto s = 2.0f * std::sqrt(1.0f + rot(0, 0) - rot(1, 1) - rot(2, 2));
+            auto s = 2.0f * rush::sqrt(1.0f + rot(0, 0) - rot(1, 1) - rot(2, 2));
             q.s = (rot(1, 2) - rot(2, 1)) / s;
             q.x = s / 4.0f;
             q.y = (rot(0, 1) + rot(1, 0)) / s;
             q.z = (rot(0, 2) + rot(2, 0)) / s;
         } else if (rot(1, 1) > rot(2, 2)) {
-            auto s = 2.0f * std::sqrt(1.0f + rot(1, 1) - rot(0, 0) - rot(2, 2));
+            auto s = 2.0f * rush::sqrt(1.0f + rot(1, 1) - rot(0, 0) - rot(2, 2));
             q.s = (rot(2, 0) - rot(0, 2)) / s;
             q.x = (rot(0, 1) + rot(1, 0)) / s;
             q.y = s / 4.0f;
             q.z = (rot(1, 2) + rot(2, 1)) / s;
         } else {
-            auto s = 2.0f * std::sqrt(1.0f + rot(2, 2) - rot(0, 0) - rot(1, 1));
+            auto s = 2.0f * rush::sqrt(1.0f + rot(2, 2) - rot(0, 0) - rot(1, 1));
             q.s = (rot(1, 0) - rot(0, 1)) / s;
             q.x = (rot(0, 2) + rot(2, 0)) / s;
             q.y = (rot(1, 2) + rot(2, 1)) / s;
@@ -7,6 +7,10 @@
 
 #include <rush/concepts.h>
 #include <rush/algorithm.h>
+#include <rush/cpu.h>
+#include <rush/simd.h>
+#include <rush/fast_math.h>
+#include <rush/parallel.h>
 
 #include <rush/allocator/allocator.h>
 #include <rush/matrix/mat.h>
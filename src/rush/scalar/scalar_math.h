@@ -5,7 +5,12 @@
 #ifndef NEON_SCALAR_ALGORITHMS_BASE_H
 #define NEON_SCALAR_ALGORITHMS_BASE_H
 
+#include <cmath>
+#include <limits>
 #include <numbers>
+#include <type_traits>
+
+#include <rush/concepts.h>
 
 namespace rush {
 
@@ -53,6 +58,151 @@ namespace rush {
         return c;
     }
 
+    // REGION CONSTANT EVALUATION
+
+    // The standard math functions are not constexpr in C++20.
+    // The following functions behave like their std counterparts at runtime,
+    // but use series expansions when evaluated in constant expressions,
+    // allowing vectors, matrices and quaternions to be built at compile time.
+
+    namespace detail {
+        template<typename T>
+        constexpr T constantSqrt(T v) {
+            if (!(v >= T(0))) return std::numeric_limits<T>::quiet_NaN();
+            if (v == T(0) || v == std::numeric_limits<T>::infinity()) return v;
+
+            // Newton-Raphson starting above the root:
+            // the sequence decreases until it converges.
+            T x = v > T(1) ? v : T(1);
+            while (true) {
+                T next = (x + v / x) / T(2);
+                if (!(next < x)) return x;
+                x = next;
+            }
+        }
+
+        template<typename T>
+        constexpr long double reduceAngle(T v) {
+            constexpr long double PI = std::numbers::pi_v<long double>;
+            long double x = v;
+            long double turns = x / (2.0L * PI);
+            x -= 2.0L * PI * static_cast<long double>(static_cast<long long>(turns));
+            if (x > PI) x -= 2.0L * PI;
+            if (x < -PI) x += 2.0L * PI;
+            return x;
+        }
+
+        template<typename T>
+        constexpr T constantSin(T v) {
+            long double x = reduceAngle(v);
+            long double term = x;
+            long double sum = 0.0L;
+            for (int n = 1; n < 40 && term != 0.0L; ++n) {
+                sum += term;
+                term *= -x * x / ((2.0L * n) * (2.0L * n + 1.0L));
+            }
+            return static_cast<T>(sum);
+        }
+
+        template<typename T>
+        constexpr T constantCos(T v) {
+            long double x = reduceAngle(v);
+            long double term = 1.0L;
+            long double sum = 0.0L;
+            for (int n = 1; n < 40 && term != 0.0L; ++n) {
+                sum += term;
+                term *= -x * x / ((2.0L * n - 1.0L) * (2.0L * n));
+            }
+            return static_cast<T>(sum);
+        }
+    }
+
+    /**
+     * Returns the absolute value of the given value.
+     * <p>
+     * Unlike std::abs, this function can be used in constant expressions.
+     */
+    template<typename T>
+        requires requires(T v) { std::abs(v); }
+    constexpr auto abs(const T& v) {
+        if constexpr (std::is_arithmetic_v<T>) {
+            if (std::is_constant_evaluated()) {
+                using R = decltype(std::abs(v));
+                return v < T(0) ? static_cast<R>(-v) : static_cast<R>(v + T(0));
+            }
+        }
+        return std::abs(v);
+    }
+
+    /**
+     * Returns the square root of the given value.
+     * <p>
+     * Unlike std::sqrt, this function can be used in constant expressions.
+     */
+    template<typename T> requires HasSquaredRoot<T>
+    constexpr auto sqrt(const T& v) {
+        if constexpr (std::is_arithmetic_v<T>) {
+            if (std::is_constant_evaluated()) {
+                using R = decltype(std::sqrt(v));
+                return detail::constantSqrt(static_cast<R>(v));
+            }
+        }
+        return std::sqrt(v);
+    }
+
+    /**
+     * Returns the sine of the given angle, in radians.
+     * <p>
+     * Unlike std::sin, this function can be used in constant expressions.
+     */
+    template<typename T>
+        requires requires(T v) { std::sin(v); }
+    constexpr auto sin(const T& v) {
+        if constexpr (std::is_arithmetic_v<T>) {
+            if (std::is_constant_evaluated()) {
+                using R = decltype(std::sin(v));
+                return detail::constantSin(static_cast<R>(v));
+            }
+        }
+        return std::sin(v);
+    }
+
+    /**
+     * Returns the cosine of the given angle, in radians.
+     * <p>
+     * Unlike std::cos, this function can be used in constant expressions.
+     */
+    template<typename T>
+        requires requires(T v) { std::cos(v); }
+    constexpr auto cos(const T& v) {
+        if constexpr (std::is_arithmetic_v<T>) {
+            if (std::is_constant_evaluated()) {
+                using R = decltype(std::cos(v));
+                return detail::constantCos(static_cast<R>(v));
+            }
+        }
+        return std::cos(v);
+    }
+
+    /**
+     * Returns the tangent of the given angle, in radians.
+     * <p>
+     * Unlike std::tan, this function can be used in constant expressions.
+     */
+    template<typename T>
+        requires requires(T v) { std::tan(v); }
+    constexpr auto tan(const T& v) {
+        if constexpr (std::is_arithmetic_v<T>) {
+            if (std::is_constant_evaluated()) {
+                using R = decltype(std::tan(v));
+                return static_cast<R>(detail::constantSin(static_cast<R>(v)) /
+                                      detail::constantCos(static_cast<R>(v)));
+            }
+        }
+        return std::tan(v);
+    }
+
+    // ENDREGION
 }
 
 #endif //NEON_SCALAR_ALGORITHMS_BASE_H
@@ -0,0 +1,591 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_SIMD_H
+#define RUSH_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <rush/cpu.h>
+
+namespace rush::simd {
+    /**
+     * Whether the bulk kernels of this file have
+     * SIMD implementations for the given type.
+     */
+    template<typename Type>
+    constexpr bool HasBulkKernel = IntrinsicsAvailable &&
+                                   (std::is_same_v<Type, float> ||
+                                    std::is_same_v<Type, double>);
+
+    enum class BinaryOp {
+        Add,
+        Sub,
+        Mul,
+        Div
+    };
+
+    /**
+     * Which operand of a binary kernel is a single
+     * value instead of an array.
+     */
+    enum class Broadcast {
+        None,
+        Left,
+        Right
+    };
+
+    namespace detail {
+        template<BinaryOp Op, typename Type>
+        inline Type apply(Type a, Type b) {
+            if constexpr (Op == BinaryOp::Add) return a + b;
+            if constexpr (Op == BinaryOp::Sub) return a - b;
+            if constexpr (Op == BinaryOp::Mul) return a * b;
+            if constexpr (Op == BinaryOp::Div) return a / b;
+        }
+
+        template<BinaryOp Op, Broadcast B, typename Type>
+        inline void binaryGeneric(const Type* a, const Type* b, Type* out,
+                                  size_t from, size_t n) {
+            for (size_t i = from; i < n; ++i) {
+                Type l = B == Broadcast::Left ? a[0] : a[i];
+                Type r = B == Broadcast::Right ? b[0] : b[i];
+                out[i] = apply<Op>(l, r);
+            }
+        }
+
+        template<typename Type>
+        inline Type dotGeneric(const Type* a, const Type* b,
+                               size_t from, size_t n) {
+            Type result = Type(0);
+            for (size_t i = from; i < n; ++i) {
+                result += a[i] * b[i];
+            }
+            return result;
+        }
+
+        template<typename Type>
+        inline void axpyGeneric(Type a, const Type* x, Type* y,
+                                size_t from, size_t n) {
+            for (size_t i = from; i < n; ++i) {
+                y[i] += a * x[i];
+            }
+        }
+    }
+
+#ifdef RUSH_DISPATCH
+
+    // REGION REGISTER OPERATIONS
+
+    /**
+     * Register operations for each instruction set.
+     * <p>
+     * Every function carries the target of its instruction set,
+     * so they can only be inlined into functions with the same target.
+     * Kernels must be declared with RUSH_TARGET_SSE4, RUSH_TARGET_AVX2
+     * or RUSH_TARGET_AVX512 accordingly.
+     */
+    template<typename Type>
+    struct SSE4;
+
+    template<>
+    struct SSE4<float> {
+        using Reg = __m128;
+        static constexpr size_t Lanes = 4;
+
+        RUSH_TARGET_SSE4 static Reg zero() { return _mm_setzero_ps(); }
+        RUSH_TARGET_SSE4 static Reg set1(float v) { return _mm_set1_ps(v); }
+        RUSH_TARGET_SSE4 static Reg load(const float* p) { return _mm_loadu_ps(p); }
+        RUSH_TARGET_SSE4 static void store(float* p, Reg v) { _mm_storeu_ps(p, v); }
+        RUSH_TARGET_SSE4 static Reg add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+        RUSH_TARGET_SSE4 static Reg sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+        RUSH_TARGET_SSE4 static Reg mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+        RUSH_TARGET_SSE4 static Reg div(Reg a, Reg b) { return _mm_div_ps(a, b); }
+        RUSH_TARGET_SSE4 static Reg min(Reg a, Reg b) { return _mm_min_ps(a, b); }
+        RUSH_TARGET_SSE4 static Reg max(Reg a, Reg b) { return _mm_max_ps(a, b); }
+
+        RUSH_TARGET_SSE4 static Reg fmadd(Reg a, Reg b, Reg c) {
+            return _mm_add_ps(_mm_mul_ps(a, b), c);
+        }
+
+        RUSH_TARGET_SSE4 static float sum(Reg v) {
+            __m128 shuffled = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+            __m128 sums = _mm_add_ps(v, shuffled);
+            shuffled = _mm_movehl_ps(shuffled, sums);
+            return _mm_cvtss_f32(_mm_add_ss(sums, shuffled));
+        }
+
+        // Masks, bitwise and integer operations.
+        // Used by the approximations of rush/fast_math.h.
+
+        using IntReg = __m128i;
+
+        RUSH_TARGET_SSE4 static Reg bitAnd(Reg a, Reg b) { return _mm_and_ps(a, b); }
+        RUSH_TARGET_SSE4 static Reg bitOr(Reg a, Reg b) { return _mm_or_ps(a, b); }
+        RUSH_TARGET_SSE4 static Reg bitXor(Reg a, Reg b) { return _mm_xor_ps(a, b); }
+        RUSH_TARGET_SSE4 static Reg less(Reg a, Reg b) { return _mm_cmplt_ps(a, b); }
+        RUSH_TARGET_SSE4 static Reg equal(Reg a, Reg b) { return _mm_cmpeq_ps(a, b); }
+        RUSH_TARGET_SSE4 static Reg unordered(Reg a, Reg b) { return _mm_cmpunord_ps(a, b); }
+        RUSH_TARGET_SSE4 static int signMask(Reg v) { return _mm_movemask_ps(v); }
+
+        RUSH_TARGET_SSE4 static Reg select(Reg mask, Reg ifTrue, Reg ifFalse) {
+            return _mm_blendv_ps(ifFalse, ifTrue, mask);
+        }
+
+        RUSH_TARGET_SSE4 static IntReg set1Int(int32_t v) { return _mm_set1_epi32(v); }
+        RUSH_TARGET_SSE4 static IntReg roundToInt(Reg v) { return _mm_cvtps_epi32(v); }
+        RUSH_TARGET_SSE4 static Reg toFloat(IntReg v) { return _mm_cvtepi32_ps(v); }
+        RUSH_TARGET_SSE4 static IntReg asInt(Reg v) { return _mm_castps_si128(v); }
+        RUSH_TARGET_SSE4 static Reg asFloat(IntReg v) { return _mm_castsi128_ps(v); }
+        RUSH_TARGET_SSE4 static IntReg addInt(IntReg a, IntReg b) { return _mm_add_epi32(a, b); }
+        RUSH_TARGET_SSE4 static IntReg subInt(IntReg a, IntReg b) { return _mm_sub_epi32(a, b); }
+        RUSH_TARGET_SSE4 static IntReg andInt(IntReg a, IntReg b) { return _mm_and_si128(a, b); }
+
+        template<int Bits>
+        RUSH_TARGET_SSE4 static IntReg shiftLeftInt(IntReg v) { return _mm_slli_epi32(v, Bits); }
+
+        template<int Bits>
+        RUSH_TARGET_SSE4 static IntReg shiftRightInt(IntReg v) { return _mm_srli_epi32(v, Bits); }
+    };
+
+    template<>
+    struct SSE4<double> {
+        using Reg = __m128d;
+        static constexpr size_t Lanes = 2;
+
+        RUSH_TARGET_SSE4 static Reg zero() { return _mm_setzero_pd(); }
+        RUSH_TARGET_SSE4 static Reg set1(double v) { return _mm_set1_pd(v); }
+        RUSH_TARGET_SSE4 static Reg load(const double* p) { return _mm_loadu_pd(p); }
+        RUSH_TARGET_SSE4 static void store(double* p, Reg v) { _mm_storeu_pd(p, v); }
+        RUSH_TARGET_SSE4 static Reg add(Reg a, Reg b) { return _mm_add_pd(a, b); }
+        RUSH_TARGET_SSE4 static Reg sub(Reg a, Reg b) { return _mm_sub_pd(a, b); }
+        RUSH_TARGET_SSE4 static Reg mul(Reg a, Reg b) { return _mm_mul_pd(a, b); }
+        RUSH_TARGET_SSE4 static Reg div(Reg a, Reg b) { return _mm_div_pd(a, b); }
+        RUSH_TARGET_SSE4 static Reg min(Reg a, Reg b) { return _mm_min_pd(a, b); }
+        RUSH_TARGET_SSE4 static Reg max(Reg a, Reg b) { return _mm_max_pd(a, b); }
+
+        RUSH_TARGET_SSE4 static Reg fmadd(Reg a, Reg b, Reg c) {
+            return _mm_add_pd(_mm_mul_pd(a, b), c);
+        }
+
+        RUSH_TARGET_SSE4 static double sum(Reg v) {
+            return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+        }
+    };
+
+    template<typename Type>
+    struct AVX2;
+
+    template<>
+    struct AVX2<float> {
+        using Reg = __m256;
+        static constexpr size_t Lanes = 8;
+
+        RUSH_TARGET_AVX2 static Reg zero() { return _mm256_setzero_ps(); }
+        RUSH_TARGET_AVX2 static Reg set1(float v) { return _mm256_set1_ps(v); }
+        RUSH_TARGET_AVX2 static Reg load(const float* p) { return _mm256_loadu_ps(p); }
+        RUSH_TARGET_AVX2 static void store(float* p, Reg v) { _mm256_storeu_ps(p, v); }
+        RUSH_TARGET_AVX2 static Reg add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+        RUSH_TARGET_AVX2 static Reg sub(Reg a, Reg b) { return _mm256_sub_ps(a, b); }
+        RUSH_TARGET_AVX2 static Reg mul(Reg a, Reg b) { return _mm256_mul_ps(a, b); }
+        RUSH_TARGET_AVX2 static Reg div(Reg a, Reg b) { return _mm256_div_ps(a, b); }
+        RUSH_TARGET_AVX2 static Reg min(Reg a, Reg b) { return _mm256_min_ps(a, b); }
+        RUSH_TARGET_AVX2 static Reg max(Reg a, Reg b) { return _mm256_max_ps(a, b); }
+
+        RUSH_TARGET_AVX2 static Reg fmadd(Reg a, Reg b, Reg c) {
+            return _mm256_fmadd_ps(a, b, c);
+        }
+
+        RUSH_TARGET_AVX2 static float sum(Reg v) {
+            __m128 low = _mm256_castps256_ps128(v);
+            __m128 high = _mm256_extractf128_ps(v, 1);
+            __m128 v4 = _mm_add_ps(low, high);
+            __m128 shuffled = _mm_movehdup_ps(v4);
+            __m128 sums = _mm_add_ps(v4, shuffled);
+            shuffled = _mm_movehl_ps(shuffled, sums);
+            return _mm_cvtss_f32(_mm_add_ss(sums, shuffled));
+        }
+
+        // Masks, bitwise and integer operations.
+        // Used by the approximations of rush/fast_math.h.
+
+        using IntReg = __m256i;
+
+        RUSH_TARGET_AVX2 static Reg bitAnd(Reg a, Reg b) { return _mm256_and_ps(a, b); }
+        RUSH_TARGET_AVX2 static Reg bitOr(Reg a, Reg b) { return _mm256_or_ps(a, b); }
+        RUSH_TARGET_AVX2 static Reg bitXor(Reg a, Reg b) { return _mm256_xor_ps(a, b); }
+        RUSH_TARGET_AVX2 static Reg less(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        RUSH_TARGET_AVX2 static Reg equal(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+        RUSH_TARGET_AVX2 static Reg unordered(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_UNORD_Q); }
+        RUSH_TARGET_AVX2 static int signMask(Reg v) { return _mm256_movemask_ps(v); }
+
+        RUSH_TARGET_AVX2 static Reg select(Reg mask, Reg ifTrue, Reg ifFalse) {
+            return _mm256_blendv_ps(ifFalse, ifTrue, mask);
+        }
+
+        RUSH_TARGET_AVX2 static IntReg set1Int(int32_t v) { return _mm256_set1_epi32(v); }
+        RUSH_TARGET_AVX2 static IntReg roundToInt(Reg v) { return _mm256_cvtps_epi32(v); }
+        RUSH_TARGET_AVX2 static Reg toFloat(IntReg v) { return _mm256_cvtepi32_ps(v); }
+        RUSH_TARGET_AVX2 static IntReg asInt(Reg v) { return _mm256_castps_si256(v); }
+        RUSH_TARGET_AVX2 static Reg asFloat(IntReg v) { return _mm256_castsi256_ps(v); }
+        RUSH_TARGET_AVX2 static IntReg addInt(IntReg a, IntReg b) { return _mm256_add_epi32(a, b); }
+        RUSH_TARGET_AVX2 static IntReg subInt(IntReg a, IntReg b) { return _mm256_sub_epi32(a, b); }
+        RUSH_TARGET_AVX2 static IntReg andInt(IntReg a, IntReg b) { return _mm256_and_si256(a, b); }
+
+        template<int Bits>
+        RUSH_TARGET_AVX2 static IntReg shiftLeftInt(IntReg v) { return _mm256_slli_epi32(v, Bits); }
+
+        template<int Bits>
+        RUSH_TARGET_AVX2 static IntReg shiftRightInt(IntReg v) { return _mm256_srli_epi32(v, Bits); }
+    };
+
+    template<>
+    struct AVX2<double> {
+        using Reg = __m256d;
+        static constexpr size_t Lanes = 4;
+
+        RUSH_TARGET_AVX2 static Reg zero() { return _mm256_setzero_pd(); }
+        RUSH_TARGET_AVX2 static Reg set1(double v) { return _mm256_set1_pd(v); }
+        RUSH_TARGET_AVX2 static Reg load(const double* p) { return _mm256_loadu_pd(p); }
+        RUSH_TARGET_AVX2 static void store(double* p, Reg v) { _mm256_storeu_pd(p, v); }
+        RUSH_TARGET_AVX2 static Reg add(Reg a, Reg b) { return _mm256_add_pd(a, b); }
+        RUSH_TARGET_AVX2 static Reg sub(Reg a, Reg b) { return _mm256_sub_pd(a, b); }
+        RUSH_TARGET_AVX2 static Reg mul(Reg a, Reg b) { return _mm256_mul_pd(a, b); }
+        RUSH_TARGET_AVX2 static Reg div(Reg a, Reg b) { return _mm256_div_pd(a, b); }
+        RUSH_TARGET_AVX2 static Reg min(Reg a, Reg b) { return _mm256_min_pd(a, b); }
+        RUSH_TARGET_AVX2 static Reg max(Reg a, Reg b) { return _mm256_max_pd(a, b); }
+
+        RUSH_TARGET_AVX2 static Reg fmadd(Reg a, Reg b, Reg c) {
+            return _mm256_fmadd_pd(a, b, c);
+        }
+
+        RUSH_TARGET_AVX2 static double sum(Reg v) {
+            __m128d low = _mm256_castpd256_pd128(v);
+            __m128d high = _mm256_extractf128_pd(v, 1);
+            __m128d v2 = _mm_add_pd(low, high);
+            return _mm_cvtsd_f64(_mm_add_sd(v2, _mm_unpackhi_pd(v2, v2)));
+        }
+    };
+
+    template<typename Type>
+    struct AVX512;
+
+    template<>
+    struct AVX512<float> {
+        using Reg = __m512;
+        static constexpr size_t Lanes = 16;
+
+        RUSH_TARGET_AVX512 static Reg zero() { return _mm512_setzero_ps(); }
+        RUSH_TARGET_AVX512 static Reg set1(float v) { return _mm512_set1_ps(v); }
+        RUSH_TARGET_AVX512 static Reg load(const float* p) { return _mm512_loadu_ps(p); }
+        RUSH_TARGET_AVX512 static void store(float* p, Reg v) { _mm512_storeu_ps(p, v); }
+        RUSH_TARGET_AVX512 static Reg add(Reg a, Reg b) { return _mm512_add_ps(a, b); }
+        RUSH_TARGET_AVX512 static Reg sub(Reg a, Reg b) { return _mm512_sub_ps(a, b); }
+        RUSH_TARGET_AVX512 static Reg mul(Reg a, Reg b) { return _mm512_mul_ps(a, b); }
+        RUSH_TARGET_AVX512 static Reg div(Reg a, Reg b) { return _mm512_div_ps(a, b); }
+        RUSH_TARGET_AVX512 static Reg min(Reg a, Reg b) { return _mm512_min_ps(a, b); }
+        RUSH_TARGET_AVX512 static Reg max(Reg a, Reg b) { return _mm512_max_ps(a, b); }
+
+        RUSH_TARGET_AVX512 static Reg fmadd(Reg a, Reg b, Reg c) {
+            return _mm512_fmadd_ps(a, b, c);
+        }
+
+        RUSH_TARGET_AVX512 static float sum(Reg v) {
+            // _mm512_reduce_add_ps and the unmasked extracts pass an undefined
+            // register that GCC reports as uninitialized. The zero-masked extracts don't.
+            __m512d halves = _mm512_castps_pd(v);
+            __m256 low = _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, halves, 0));
+            __m256 high = _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, halves, 1));
+            return AVX2<float>::sum(_mm256_add_ps(low, high));
+        }
+    };
+
+    template<>
+    struct AVX512<double> {
+        using Reg = __m512d;
+        static constexpr size_t Lanes = 8;
+
+        RUSH_TARGET_AVX512 static Reg zero() { return _mm512_setzero_pd(); }
+        RUSH_TARGET_AVX512 static Reg set1(double v) { return _mm512_set1_pd(v); }
+        RUSH_TARGET_AVX512 static Reg load(const double* p) { return _mm512_loadu_pd(p); }
+        RUSH_TARGET_AVX512 static void store(double* p, Reg v) { _mm512_storeu_pd(p, v); }
+        RUSH_TARGET_AVX512 static Reg add(Reg a, Reg b) { return _mm512_add_pd(a, b); }
+        RUSH_TARGET_AVX512 static Reg sub(Reg a, Reg b) { return _mm512_sub_pd(a, b); }
+        RUSH_TARGET_AVX512 static Reg mul(Reg a, Reg b) { return _mm512_mul_pd(a, b); }
+        RUSH_TARGET_AVX512 static Reg div(Reg a, Reg b) { return _mm512_div_pd(a, b); }
+        RUSH_TARGET_AVX512 static Reg min(Reg a, Reg b) { return _mm512_min_pd(a, b); }
+        RUSH_TARGET_AVX512 static Reg max(Reg a, Reg b) { return _mm512_max_pd(a, b); }
+
+        RUSH_TARGET_AVX512 static Reg fmadd(Reg a, Reg b, Reg c) {
+            return _mm512_fmadd_pd(a, b, c);
+        }
+
+        RUSH_TARGET_AVX512 static double sum(Reg v) {
+            __m256d low = _mm512_maskz_extractf64x4_pd(0xF, v, 0);
+            __m256d high = _mm512_maskz_extractf64x4_pd(0xF, v, 1);
+            return AVX2<double>::sum(_mm256_add_pd(low, high));
+        }
+    };
+
+    // ENDREGION
+
+    // REGION KERNELS
+
+    namespace detail {
+        template<typename Type>
+        RUSH_TARGET_SSE4 inline Type dotSSE4(const Type* a, const Type* b,
+                                             size_t n) {
+            using O = SSE4<Type>;
+            auto acc0 = O::zero();
+            auto acc1 = O::zero();
+            size_t i = 0;
+            for (; i + 2 * O::Lanes <= n; i += 2 * O::Lanes) {
+                acc0 = O::fmadd(O::load(a + i), O::load(b + i), acc0);
+                acc1 = O::fmadd(O::load(a + i + O::Lanes),
+                                O::load(b + i + O::Lanes), acc1);
+            }
+            for (; i + O::Lanes <= n; i += O::Lanes) {
+                acc0 = O::fmadd(O::load(a + i), O::load(b + i), acc0);
+            }
+            return O::sum(O::add(acc0, acc1)) + dotGeneric(a, b, i, n);
+        }
+
+        template<typename Type>
+        RUSH_TARGET_AVX2 inline Type dotAVX2(const Type* a, const Type* b,
+                                             size_t n) {
+            using O = AVX2<Type>;
+            auto acc0 = O::zero();
+            auto acc1 = O::zero();
+            size_t i = 0;
+            for (; i + 2 * O::Lanes <= n; i += 2 * O::Lanes) {
+                acc0 = O::fmadd(O::load(a + i), O::load(b + i), acc0);
+                acc1 = O::fmadd(O::load(a + i + O::Lanes),
+                                O::load(b + i + O::Lanes), acc1);
+            }
+            for (; i + O::Lanes <= n; i += O::Lanes) {
+                acc0 = O::fmadd(O::load(a + i), O::load(b + i), acc0);
+            }
+            return O::sum(O::add(acc0, acc1)) + dotGeneric(a, b, i, n);
+        }
+
+        template<typename Type>
+        RUSH_TARGET_AVX512 inline Type dotAVX512(const Type* a, const Type* b,
+                                                 size_t n) {
+            using O = AVX512<Type>;
+            auto acc0 = O::zero();
+            auto acc1 = O::zero();
+            size_t i = 0;
+            for (; i + 2 * O::Lanes <= n; i += 2 * O::Lanes) {
+                acc0 = O::fmadd(O::load(a + i), O::load(b + i), acc0);
+                acc1 = O::fmadd(O::load(a + i + O::Lanes),
+                                O::load(b + i + O::Lanes), acc1);
+            }
+            for (; i + O::Lanes <= n; i += O::Lanes) {
+                acc0 = O::fmadd(O::load(a + i), O::load(b + i), acc0);
+            }
+            return O::sum(O::add(acc0, acc1)) + dotGeneric(a, b, i, n);
+        }
+
+        template<BinaryOp Op, Broadcast B, typename Type>
+        RUSH_TARGET_SSE4 inline void binarySSE4(const Type* a, const Type* b,
+                                                Type* out, size_t n) {
+            using O = SSE4<Type>;
+            if (n == 0) return;
+            auto left = O::set1(a[0]);
+            auto right = O::set1(b[0]);
+            size_t i = 0;
+            for (; i + O::Lanes <= n; i += O::Lanes) {
+                auto l = B == Broadcast::Left ? left : O::load(a + i);
+                auto r = B == Broadcast::Right ? right : O::load(b + i);
+                if constexpr (Op == BinaryOp::Add) O::store(out + i, O::add(l, r));
+                if constexpr (Op == BinaryOp::Sub) O::store(out + i, O::sub(l, r));
+                if constexpr (Op == BinaryOp::Mul) O::store(out + i, O::mul(l, r));
+                if constexpr (Op == BinaryOp::Div) O::store(out + i, O::div(l, r));
+            }
+            binaryGeneric<Op, B>(a, b, out, i, n);
+        }
+
+        template<BinaryOp Op, Broadcast B, typename Type>
+        RUSH_TARGET_AVX2 inline void binaryAVX2(const Type* a, const Type* b,
+                                                Type* out, size_t n) {
+            using O = AVX2<Type>;
+            if (n == 0) return;
+            auto left = O::set1(a[0]);
+            auto right = O::set1(b[0]);
+            size_t i = 0;
+            for (; i + O::Lanes <= n; i += O::Lanes) {
+                auto l = B == Broadcast::Left ? left : O::load(a + i);
+                auto r = B == Broadcast::Right ? right : O::load(b + i);
+                if constexpr (Op == BinaryOp::Add) O::store(out + i, O::add(l, r));
+                if constexpr (Op == BinaryOp::Sub) O::store(out + i, O::sub(l, r));
+                if constexpr (Op == BinaryOp::Mul) O::store(out + i, O::mul(l, r));
+                if constexpr (Op == BinaryOp::Div) O::store(out + i, O::div(l, r));
+            }
+            binaryGeneric<Op, B>(a, b, out, i, n);
+        }
+
+        template<BinaryOp Op, Broadcast B, typename Type>
+        RUSH_TARGET_AVX512 inline void binaryAVX512(const Type* a, const Type* b,
+                                                    Type* out, size_t n) {
+            using O = AVX512<Type>;
+            if (n == 0) return;
+            auto left = O::set1(a[0]);
+            auto right = O::set1(b[0]);
+            size_t i = 0;
+            for (; i + O::Lanes <= n; i += O::Lanes) {
+                auto l = B == Broadcast::Left ? left : O::load(a + i);
+                auto r = B == Broadcast::Right ? right : O::load(b + i);
+                if constexpr (Op == BinaryOp::Add) O::store(out + i, O::add(l, r));
+                if constexpr (Op == BinaryOp::Sub) O::store(out + i, O::sub(l, r));
+                if constexpr (Op == BinaryOp::Mul) O::store(out + i, O::mul(l, r));
+                if constexpr (Op == BinaryOp::Div) O::store(out + i, O::div(l, r));
+            }
+            binaryGeneric<Op, B>(a, b, out, i, n);
+        }
+
+        template<typename Type>
+        RUSH_TARGET_SSE4 inline void axpySSE4(Type a, const Type* x, Type* y,
+                                              size_t n) {
+            using O = SSE4<Type>;
+            auto scale = O::set1(a);
+            size_t i = 0;
+            for (; i + O::Lanes <= n; i += O::Lanes) {
+                O::store(y + i, O::fmadd(scale, O::load(x + i), O::load(y + i)));
+            }
+            axpyGeneric(a, x, y, i, n);
+        }
+
+        template<typename Type>
+        RUSH_TARGET_AVX2 inline void axpyAVX2(Type a, const Type* x, Type* y,
+                                              size_t n) {
+            using O = AVX2<Type>;
+            auto scale = O::set1(a);
+            size_t i = 0;
+            for (; i + O::Lanes <= n; i += O::Lanes) {
+                O::store(y + i, O::fmadd(scale, O::load(x + i), O::load(y + i)));
+            }
+            axpyGeneric(a, x, y, i, n);
+        }
+
+        template<typename Type>
+        RUSH_TARGET_AVX512 inline void axpyAVX512(Type a, const Type* x, Type* y,
+                                                  size_t n) {
+            using O = AVX512<Type>;
+            auto scale = O::set1(a);
+            size_t i = 0;
+            for (; i + O::Lanes <= n; i += O::Lanes) {
+                O::store(y + i, O::fmadd(scale, O::load(x + i), O::load(y + i)));
+            }
+            axpyGeneric(a, x, y, i, n);
+        }
+    }
+
+    // ENDREGION
+
+#endif
+
+    /**
+     * Computes the dot product of the arrays a and b.
+     * <p>
+     * The kernel is selected at runtime using the
+     * instruction set returned by cpu::instructionSet().
+     *
+     * @param a the first array.
+     * @param b the second array.
+     * @param n the length of the arrays.
+     * @return the dot product.
+     */
+    template<typename Type>
+    inline Type dot(const Type* a, const Type* b, size_t n) {
+#ifdef RUSH_DISPATCH
+        if constexpr (HasBulkKernel<Type>) {
+            switch (cpu::instructionSet()) {
+                case InstructionSet::AVX512:
+                    return detail::dotAVX512(a, b, n);
+                case InstructionSet::AVX2:
+                    return detail::dotAVX2(a, b, n);
+                case InstructionSet::SSE4:
+                    return detail::dotSSE4(a, b, n);
+                default:
+                    break;
+            }
+        }
+#endif
+        return detail::dotGeneric(a, b, 0, n);
+    }
+
+    /**
+     * Computes out[i] = a[i] Op b[i].
+     * <p>
+     * If B is Broadcast::Left or Broadcast::Right, the corresponding
+     * operand points to a single value that is used for all elements.
+     * <p>
+     * out may alias a or b.
+     * The kernel is selected at runtime using the
+     * instruction set returned by cpu::instructionSet().
+     *
+     * @param a the left operand.
+     * @param b the right operand.
+     * @param out the output array.
+     * @param n the length of the arrays.
+     */
+    template<BinaryOp Op, Broadcast B = Broadcast::None, typename Type>
+    inline void binary(const Type* a, const Type* b, Type* out, size_t n) {
+#ifdef RUSH_DISPATCH
+        if constexpr (HasBulkKernel<Type>) {
+            switch (cpu::instructionSet()) {
+                case InstructionSet::AVX512:
+                    detail::binaryAVX512<Op, B>(a, b, out, n);
+                    return;
+                case InstructionSet::AVX2:
+                    detail::binaryAVX2<Op, B>(a, b, out, n);
+                    return;
+                case InstructionSet::SSE4:
+                    detail::binarySSE4<Op, B>(a, b, out, n);
+                    return;
+                default:
+                    break;
+            }
+        }
+#endif
+        detail::binaryGeneric<Op, B>(a, b, out, 0, n);
+    }
+
+    /**
+     * Computes y[i] += a * x[i].
+     * <p>
+     * The kernel is selected at runtime using the
+     * instruction set returned by cpu::instructionSet().
+     *
+     * @param a the scale applied to x.
+     * @param x the scaled array.
+     * @param y the accumulated array.
+     * @param n the length of the arrays.
+     */
+    template<typename Type>
+    inline void axpy(Type a, const Type* x, Type* y, size_t n) {
+#ifdef RUSH_DISPATCH
+        if constexpr (HasBulkKernel<Type>) {
+            switch (cpu::instructionSet()) {
+                case InstructionSet::AVX512:
+                    detail::axpyAVX512(a, x, y, n);
+                    return;
+                case InstructionSet::AVX2:
+                    detail::axpyAVX2(a, x, y, n);
+                    return;
+                case InstructionSet::SSE4:
+                    detail::axpySSE4(a, x, y, n);
+                    return;
+                default:
+                    break;
+            }
+        }
+#endif
+        detail::axpyGeneric(a, x, y, 0, n);
+    }
+}
+
+#endif //RUSH_SIMD_H
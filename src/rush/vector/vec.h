@@ -9,6 +9,11 @@
 #include <rush/vector/vec_extra.h>
 #include <rush/vector/vec_ref.h>
 #include <rush/vector/vec_math.h>
+#include <rush/vector/vec_expression.h>
+#include <rush/vector/vec_pack_base.h>
+#include <rush/vector/vec_pack_math.h>
+#include <rush/vector/vec_packed.h>
+#include <rush/vector/vec_reduce.h>
 
 namespace rush {
     using Vec1f = rush::Vec<1, float>;
@@ -40,6 +45,46 @@ namespace rush {
     using Vec2ul = rush::Vec<2, uint64_t>;
     using Vec3ul = rush::Vec<3, uint64_t>;
     using Vec4ul = rush::Vec<4, uint64_t>;
+
+    using Vec2fx4 = rush::VecPack<2, float, 4>;
+    using Vec3fx4 = rush::VecPack<3, float, 4>;
+    using Vec4fx4 = rush::VecPack<4, float, 4>;
+
+    using Vec2fx8 = rush::VecPack<2, float, 8>;
+    using Vec3fx8 = rush::VecPack<3, float, 8>;
+    using Vec4fx8 = rush::VecPack<4, float, 8>;
+
+    using Vec2fx16 = rush::VecPack<2, float, 16>;
+    using Vec3fx16 = rush::VecPack<3, float, 16>;
+    using Vec4fx16 = rush::VecPack<4, float, 16>;
+
+    using Vec2dx4 = rush::VecPack<2, double, 4>;
+    using Vec3dx4 = rush::VecPack<3, double, 4>;
+    using Vec4dx4 = rush::VecPack<4, double, 4>;
+
+    using Vec2dx8 = rush::VecPack<2, double, 8>;
+    using Vec3dx8 = rush::VecPack<3, double, 8>;
+    using Vec4dx8 = rush::VecPack<4, double, 8>;
+
+    using Vec2h = rush::PackedVec<2, rush::Float16>;
+    using Vec3h = rush::PackedVec<3, rush::Float16>;
+    using Vec4h = rush::PackedVec<4, rush::Float16>;
+
+    using Vec2sn8 = rush::PackedVec<2, rush::Snorm8>;
+    using Vec3sn8 = rush::PackedVec<3, rush::Snorm8>;
+    using Vec4sn8 = rush::PackedVec<4, rush::Snorm8>;
+
+    using Vec2sn16 = rush::PackedVec<2, rush::Snorm16>;
+    using Vec3sn16 = rush::PackedVec<3, rush::Snorm16>;
+    using Vec4sn16 = rush::PackedVec<4, rush::Snorm16>;
+
+    using Vec2un8 = rush::PackedVec<2, rush::Unorm8>;
+    using Vec3un8 = rush::PackedVec<3, rush::Unorm8>;
+    using Vec4un8 = rush::PackedVec<4, rush::Unorm8>;
+
+    using Vec2un16 = rush::PackedVec<2, rush::Unorm16>;
+    using Vec3un16 = rush::PackedVec<3, rush::Unorm16>;
+    using Vec4un16 = rush::PackedVec<4, rush::Unorm16>;
 }
 
 
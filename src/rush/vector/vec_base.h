@@ -11,6 +11,9 @@
 #include <rush/concepts.h>
 #include <rush/vector/vec_ref.h>
 #include <rush/algorithm.h>
+#include <rush/expression.h>
+#include <rush/scalar/scalar_math.h>
+#include <rush/vector/vec_simd.h>
 
 #ifdef RUSH_GLM
 
@@ -42,14 +45,14 @@ namespace rush {
          * All members of the new vector will be
          * initialized to their default values.
          */
-        Vec();
+        constexpr Vec();
 
         /**
          * Creates a new vector will all its members
          * initialized to the given value.
          * @param fill the value of all members.
          */
-        explicit Vec(Type fill);
+        constexpr explicit Vec(Type fill);
 
         /**
          * Creates a new vector will all its members
@@ -60,7 +63,7 @@ namespace rush {
         template<typename... T>
             requires std::is_convertible_v<std::common_type_t<T...>, Type> &&
                      (Size > 1 && sizeof...(T) == Size)
-        Vec(T... list);
+        constexpr Vec(T... list);
 
         /**
          * Creates a new vector with the data
@@ -73,7 +76,7 @@ namespace rush {
          */
         template<size_t OSize, typename OAlloc>
             requires(Size < OSize)
-        Vec(const Vec<OSize, Type, OAlloc>& other);
+        constexpr Vec(const Vec<OSize, Type, OAlloc>& other);
 
         /**
          * Creates a new vector with the data
@@ -88,14 +91,14 @@ namespace rush {
         template<size_t OSize, typename OAlloc, typename... T>
             requires std::is_convertible_v<std::common_type_t<T...>, Type> &&
                      (sizeof...(T) + OSize == Size)
-        Vec(const Vec<OSize, Type, OAlloc>& other, T... list);
+        constexpr Vec(const Vec<OSize, Type, OAlloc>& other, T... list);
 
         /**
          * Creates a new vector from the given vector
          * reference.
          * @param ref the given vector reference.
          */
-        explicit Vec(const VecRef<Size, Type>& ref);
+        constexpr explicit Vec(const VecRef<Size, Type>& ref);
 
         /**
          * Creates a new vector using the given population
@@ -116,6 +119,47 @@ namespace rush {
          */
         explicit Vec(std::function<Type(size_t, size_t)> populator);
 
+        /**
+         * Creates a new vector using the given population
+         * function to fill the vector.
+         * The function will be called for each element,
+         * giving each time the index of the element.
+         * <p>
+         * Unlike the std::function overload, the call to the
+         * function can be inlined by the compiler.
+         * @param populator the population function.
+         */
+        template<typename Populator>
+            requires std::is_invocable_r_v<Type, Populator&, size_t>
+        constexpr explicit Vec(Populator&& populator);
+
+        /**
+         * Creates a new vector using the given population
+         * function to fill the vector.
+         * The function will be called for each element,
+         * giving each time the index of the element.
+         * The second parameter is always the size of the vector.
+         * <p>
+         * Unlike the std::function overload, the call to the
+         * function can be inlined by the compiler.
+         * @param populator the population function.
+         */
+        template<typename Populator>
+            requires (std::is_invocable_r_v<Type, Populator&, size_t, size_t>
+                      && !std::is_invocable_v<Populator&, size_t>)
+        constexpr explicit Vec(Populator&& populator);
+
+        /**
+         * Creates a new vector evaluating the given lazy expression.
+         * <p>
+         * The whole expression is evaluated in a single loop,
+         * without creating intermediate vectors.
+         * See rush::lazy().
+         * @param expression the expression.
+         */
+        template<typename E> requires ExpressionOf<E, VecShape<Size>, Type>
+        constexpr Vec(const E& expression);
+
         /**
          * Returns a pointer to the first element of this
          * vector.
@@ -123,7 +167,7 @@ namespace rush {
          * to this pointer.
          * @return the pointer.
          */
-        [[nodiscard]] Type* toPointer();
+        [[nodiscard]] constexpr Type* toPointer();
 
         /**
          * Returns a pointer to the first element of this
@@ -132,7 +176,7 @@ namespace rush {
          * to this pointer.
          * @return the pointer.
          */
-        [[nodiscard]] const Type* toPointer() const;
+        [[nodiscard]] constexpr const Type* toPointer() const;
 
         /**
          * Returns the size of this vector.
@@ -146,49 +190,49 @@ namespace rush {
          * Returns the first value of this vector.
          * @return the first value.
          */
-        Type& x();
+        constexpr Type& x();
 
         /**
          * Returns the second value of this vector.
          * @return the second value.
          */
-        Type& y() requires (Size >= 2);
+        constexpr Type& y() requires (Size >= 2);
 
         /**
          * Returns the third value of this vector.
          * @return the third value.
          */
-        Type& z() requires (Size >= 3);
+        constexpr Type& z() requires (Size >= 3);
 
         /**
          * Returns the fourth value of this vector.
          * @return the fourth value.
          */
-        Type& w() requires (Size >= 4);
+        constexpr Type& w() requires (Size >= 4);
 
         /**
          * Returns the first value of this vector.
          * @return the first value.
          */
-        const Type& x() const;
+        constexpr const Type& x() const;
 
         /**
          * Returns the second value of this vector.
          * @return the second value.
          */
-        const Type& y() const requires (Size >= 2);
+        constexpr const Type& y() const requires (Size >= 2);
 
         /**
          * Returns the third value of this vector.
          * @return the third value.
          */
-        const Type& z() const requires (Size >= 3);
+        constexpr const Type& z() const requires (Size >= 3);
 
         /**
          * Returns the fourth value of this vector.
          * @return the fourth value.
          */
-        const Type& w() const requires (Size >= 4);
+        constexpr const Type& w() const requires (Size >= 4);
 
         /**
          * Returns the value at the given index.
@@ -196,7 +240,7 @@ namespace rush {
          * @param index the index.
          * @return the value at the given index.
          */
-        Type& operator[](size_t index);
+        constexpr Type& operator[](size_t index);
 
         /**
          * Returns the value at the given index.
@@ -204,7 +248,7 @@ namespace rush {
          * @param index the index.
          * @return the value at the given index.
          */
-        const Type& operator[](size_t index) const;
+        constexpr const Type& operator[](size_t index) const;
 
         /**
          * Returns a vector referencing the given indices
@@ -228,7 +272,7 @@ namespace rush {
          */
         template<typename... Ts>
             requires std::is_convertible_v<std::common_type_t<Ts...>, size_t>
-        VecRef<sizeof...(Ts), Type>
+        constexpr VecRef<sizeof...(Ts), Type>
         operator()(Ts&&... indices);
 
         /**
@@ -255,9 +299,29 @@ namespace rush {
          */
         template<typename... Ts, typename OAlloc = Allocator>
             requires std::is_convertible_v<std::common_type_t<Ts...>, size_t>
-        Vec<sizeof...(Ts), Type, OAlloc>
+        constexpr Vec<sizeof...(Ts), Type, OAlloc>
         operator()(Ts&&... indices) const;
 
+        /**
+         * Returns a vector with the data at the given indices
+         * of this vector.
+         * <p>
+         * This is the compile-time version of operator()(Ts&&...).
+         * The indices are checked at compile time, and three and
+         * four-component float vectors are swizzled using
+         * a single shuffle instruction.
+         *
+         * rush::Vec<4, float> a = {2, 4, 6, 8};
+         * <p>
+         * rush::Vec<3, float> b = a.swizzle<2, 1, 0>(); // b == {6, 4, 2}
+         *
+         * @tparam Indices the indices.
+         * @return the new vector.
+         */
+        template<size_t... Indices, typename OAlloc = Allocator>
+            requires (sizeof...(Indices) > 0 && ((Indices < Size) && ...))
+        constexpr Vec<sizeof...(Indices), Type, OAlloc> swizzle() const;
+
         // ENDREGION
 
         // REGION OPERATIONS
@@ -271,7 +335,7 @@ namespace rush {
          *
          * @return the squared length.
          */
-        Type squaredLength() const;
+        constexpr Type squaredLength() const;
 
         /**
          * Returns the length (or modulus) of this vector.
@@ -281,7 +345,7 @@ namespace rush {
          * @return the length.
          */
         template<typename Return = Type>
-        Return length() const requires (
+        constexpr Return length() const requires (
             std::is_convertible_v<Type, Return> && HasSquaredRoot<Type>);
 
         /**
@@ -302,7 +366,7 @@ namespace rush {
          *
          */
         template<typename Return = Type, Algorithm Algorithm = Algorithm()>
-        Return inverseLength() const requires (
+        constexpr Return inverseLength() const requires (
             std::is_convertible_v<Type, Return> && HasSquaredRoot<Type>);
 
         /**
@@ -322,7 +386,7 @@ namespace rush {
          */
         template<typename Return = Type, Algorithm Algorithm = Algorithm(),
             typename OAlloc = Allocator>
-        Vec<Size, Return, OAlloc> normalized() const requires HasMul<Return>;
+        constexpr Vec<Size, Return, OAlloc> normalized() const requires HasMul<Return>;
 
         /**
          * Returns a copy of this vector with all its elements
@@ -332,7 +396,7 @@ namespace rush {
          * @return the new vector.
          */
         template<typename To, typename OAlloc = Allocator>
-        Vec<Size, To, OAlloc> cast() const;
+        constexpr Vec<Size, To, OAlloc> cast() const;
 
         /**
          * Returns a copy of this vector with all its elements'
@@ -341,7 +405,7 @@ namespace rush {
          * @return the new vector.
          */
         template<typename OAlloc = Allocator>
-        Vec<Size, Type, OAlloc> reverse() const;
+        constexpr Vec<Size, Type, OAlloc> reverse() const;
 
         /**
          * Returns an std::array containing the elements
@@ -349,97 +413,108 @@ namespace rush {
          *
          * \return the array.
          */
-        std::array<Type, Size> toArray() const;
+        constexpr std::array<Type, Size> toArray() const;
 
-        Vec& operator+();
+        constexpr Vec& operator+();
 
-        const Vec& operator+() const;
+        constexpr const Vec& operator+() const;
 
-        Vec operator-() const requires HasSub<Type>;
+        constexpr Vec operator-() const requires HasSub<Type>;
 
         // ASSIGN VECTOR - SCALE
 
-        Vec& operator+=(const Type& s) requires HasAdd<Type>;
+        constexpr Vec& operator+=(const Type& s) requires HasAdd<Type>;
+
+        constexpr Vec& operator-=(const Type& s) requires HasSub<Type>;
+
+        constexpr Vec& operator*=(const Type& s) requires HasMul<Type>;
+
+        constexpr Vec& operator/=(const Type& s) requires HasDiv<Type>;
+
+        constexpr Vec& operator<<=(const Type& s) requires HasShl<Type>;
 
-        Vec& operator-=(const Type& s) requires HasSub<Type>;
+        constexpr Vec& operator>>=(const Type& s) requires HasShr<Type>;
 
-        Vec& operator*=(const Type& s) requires HasMul<Type>;
+        constexpr Vec& operator&=(const Type& s) requires HasBitAnd<Type>;
 
-        Vec& operator/=(const Type& s) requires HasDiv<Type>;
+        constexpr Vec& operator|=(const Type& s) requires HasBitOr<Type>;
 
-        Vec& operator<<=(const Type& s) requires HasShl<Type>;
+        constexpr Vec& operator^=(const Type& s) requires HasBitXor<Type>;
 
-        Vec& operator>>=(const Type& s) requires HasShr<Type>;
+        // ASSIGN VECTOR - EXPRESSION
 
-        Vec& operator&=(const Type& s) requires HasBitAnd<Type>;
+        template<typename E> requires ExpressionOf<E, VecShape<Size>, Type>
+        constexpr Vec& operator=(const E& expression);
 
-        Vec& operator|=(const Type& s) requires HasBitOr<Type>;
+        template<typename E> requires ExpressionOf<E, VecShape<Size>, Type>
+        constexpr Vec& operator+=(const E& expression) requires HasAdd<Type>;
 
-        Vec& operator^=(const Type& s) requires HasBitXor<Type>;
+        template<typename E> requires ExpressionOf<E, VecShape<Size>, Type>
+        constexpr Vec& operator-=(const E& expression) requires HasSub<Type>;
 
         // ASSIGN VECTOR - VECTOR
 
         template<typename OAlloc>
-        Vec&
+        constexpr Vec&
         operator+=(const Vec<Size, Type, OAlloc>& o) requires HasAdd<Type>;
 
         template<typename OAlloc>
-        Vec&
+        constexpr Vec&
         operator-=(const Vec<Size, Type, OAlloc>& o) requires HasSub<Type>;
 
         template<typename OAlloc>
-        Vec&
+        constexpr Vec&
         operator*=(const Vec<Size, Type, OAlloc>& o) requires HasMul<Type>;
 
         template<typename OAlloc>
-        Vec&
+        constexpr Vec&
         operator/=(const Vec<Size, Type, OAlloc>& o) requires HasDiv<Type>;
 
         template<typename OAlloc>
-        Vec&
+        constexpr Vec&
         operator<<=(const Vec<Size, Type, OAlloc>& o) requires HasShl<Type>;
 
         template<typename OAlloc>
-        Vec&
+        constexpr Vec&
         operator>>=(const Vec<Size, Type, OAlloc>& o) requires HasShr<Type>;
 
         template<typename OAlloc>
-        Vec&
+        constexpr Vec&
         operator&=(const Vec<Size, Type, OAlloc>& o) requires HasBitAnd<Type>;
 
         template<typename OAlloc>
-        Vec&
+        constexpr Vec&
         operator|=(const Vec<Size, Type, OAlloc>& o) requires HasBitOr<Type>;
 
         template<typename OAlloc>
-        Vec&
+        constexpr Vec&
         operator^=(const Vec<Size, Type, OAlloc>& o) requires HasBitXor<Type>;
 
         // VECTOR - SCALE
 
-        Vec operator+(const Type& s) const requires HasAdd<Type>;
+        constexpr Vec operator+(const Type& s) const requires HasAdd<Type>;
 
-        Vec operator-(const Type& s) const requires HasSub<Type>;
+        constexpr Vec operator-(const Type& s) const requires HasSub<Type>;
 
-        Vec operator*(const Type& s) const requires HasMul<Type>;
+        constexpr Vec operator*(const Type& s) const requires HasMul<Type>;
 
-        Vec operator/(const Type& s) const requires HasDiv<Type>;
+        constexpr Vec operator/(const Type& s) const requires HasDiv<Type>;
 
-        Vec operator%(const Type& s) const requires HasMod<Type>;
+        constexpr Vec operator%(const Type& s) const requires HasMod<Type>;
 
-        Vec operator<<(const Type& s) const requires HasShl<Type>;
+        constexpr Vec operator<<(const Type& s) const requires HasShl<Type>;
 
-        Vec operator>>(const Type& s) const requires HasShr<Type>;
+        constexpr Vec operator>>(const Type& s) const requires HasShr<Type>;
 
-        Vec operator&(const Type& s) const requires HasBitAnd<Type>;
+        constexpr Vec operator&(const Type& s) const requires HasBitAnd<Type>;
 
-        Vec operator|(const Type& s) const requires HasBitOr<Type>;
+        constexpr Vec operator|(const Type& s) const requires HasBitOr<Type>;
 
-        Vec operator^(const Type& s) const requires HasBitXor<Type>;
+        constexpr Vec operator^(const Type& s) const requires HasBitXor<Type>;
 
-        Vec operator&&(const Type& s) const requires HasAnd<Type>;
+        constexpr Vec operator&&(const Type& s) const requires HasAnd<Type>;
 
-        Vec operator||(const Type& s) const requires HasOr<Type>;
+        constexpr Vec operator||(const Type& s) const requires HasOr<Type>;
 
         // VECTOR - VECTOR
 
@@ -463,51 +538,51 @@ namespace rush {
         Return angle(const Vec<Size, Type, OAlloc>& other);
 
         template<typename OAlloc>
-        Vec operator+(const Vec<Size, Type, OAlloc>& other)
+        constexpr Vec operator+(const Vec<Size, Type, OAlloc>& other)
         const requires HasAdd<Type>;
 
         template<typename OAlloc>
-        Vec operator-(const Vec<Size, Type, OAlloc>& other)
+        constexpr Vec operator-(const Vec<Size, Type, OAlloc>& other)
         const requires HasSub<Type>;
 
         template<typename OAlloc>
-        Vec operator*(const Vec<Size, Type, OAlloc>& other)
+        constexpr Vec operator*(const Vec<Size, Type, OAlloc>& other)
         const requires HasMul<Type>;
 
         template<typename OAlloc>
-        Vec operator/(const Vec<Size, Type, OAlloc>& other)
+        constexpr Vec operator/(const Vec<Size, Type, OAlloc>& other)
         const requires HasDiv<Type>;
 
         template<typename OAlloc>
-        Type operator%(const Vec<Size, Type, OAlloc>& other)
+        constexpr Type operator%(const Vec<Size, Type, OAlloc>& other)
         const requires HasMod<Type>;
 
         template<typename OAlloc>
-        Vec operator<<(const Vec<Size, Type, OAlloc>& other)
+        constexpr Vec operator<<(const Vec<Size, Type, OAlloc>& other)
         const requires HasShl<Type>;
 
         template<typename OAlloc>
-        Vec operator>>(const Vec<Size, Type, OAlloc>& other)
+        constexpr Vec operator>>(const Vec<Size, Type, OAlloc>& other)
         const requires HasShr<Type>;
 
         template<typename OAlloc>
-        Vec operator&(const Vec<Size, Type, OAlloc>& other)
+        constexpr Vec operator&(const Vec<Size, Type, OAlloc>& other)
         const requires HasBitAnd<Type>;
 
         template<typename OAlloc>
-        Vec operator|(const Vec<Size, Type, OAlloc>& other)
+        constexpr Vec operator|(const Vec<Size, Type, OAlloc>& other)
         const requires HasBitOr<Type>;
 
         template<typename OAlloc>
-        Vec operator^(const Vec<Size, Type, OAlloc>& other)
+        constexpr Vec operator^(const Vec<Size, Type, OAlloc>& other)
         const requires HasBitXor<Type>;
 
         template<typename OAlloc>
-        Vec operator&&(const Vec<Size, Type, OAlloc>& other)
+        constexpr Vec operator&&(const Vec<Size, Type, OAlloc>& other)
         const requires HasAnd<Type>;
 
         template<typename OAlloc>
-        Vec operator||(const Vec<Size, Type, OAlloc>& other)
+        constexpr Vec operator||(const Vec<Size, Type, OAlloc>& other)
         const requires HasOr<Type>;
 
         /**
@@ -518,7 +593,7 @@ namespace rush {
          * @return the result.
          */
         template<typename OAlloc>
-        Type dot(const Vec<Size, Type, OAlloc>& other) const;
+        constexpr Type dot(const Vec<Size, Type, OAlloc>& other) const;
 
         /**
          * Returns the cross product of this vector and the given one.
@@ -528,42 +603,42 @@ namespace rush {
          * @return the result.
          */
         template<typename OAlloc>
-        Vec cross(const Vec<Size, Type, OAlloc>& other) const requires (
+        constexpr Vec cross(const Vec<Size, Type, OAlloc>& other) const requires (
             Size == 3 && HasAdd<Type> && HasMul<Type>);
 
         template<typename OAlloc>
-        bool operator==(const Vec<Size, Type, OAlloc>& other) const;
+        constexpr bool operator==(const Vec<Size, Type, OAlloc>& other) const;
 
         template<typename OAlloc>
-        bool operator!=(const Vec<Size, Type, OAlloc>& other) const;
+        constexpr bool operator!=(const Vec<Size, Type, OAlloc>& other) const;
 
-        bool operator==(const VecRef<Size, Type>& other) const;
+        constexpr bool operator==(const VecRef<Size, Type>& other) const;
 
-        bool operator!=(const VecRef<Size, Type>& other) const;
+        constexpr bool operator!=(const VecRef<Size, Type>& other) const;
 
         // ENDREGION
 
         // REGION ITERATOR
 
-        auto begin();
+        constexpr auto begin();
 
-        auto begin() const;
+        constexpr auto begin() const;
 
-        auto end();
+        constexpr auto end();
 
-        auto end() const;
+        constexpr auto end() const;
 
-        auto cbegin() const;
+        constexpr auto cbegin() const;
 
-        auto cend() const;
+        constexpr auto cend() const;
 
-        auto rbegin();
+        constexpr auto rbegin();
 
-        auto rend();
+        constexpr auto rend();
 
-        auto crbegin() const;
+        constexpr auto crbegin() const;
 
-        auto crend() const;
+        constexpr auto crend() const;
 
         // ENDREGION
 
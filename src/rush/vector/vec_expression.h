@@ -0,0 +1,49 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_VEC_EXPRESSION_H
+#define RUSH_VEC_EXPRESSION_H
+
+#include <rush/expression.h>
+#include <rush/vector/vec_base.h>
+
+namespace rush {
+    template<size_t Size, typename Type, typename Allocator>
+    struct ExpressionOperand<Vec<Size, Type, Allocator>> {
+        static constexpr bool IS_OPERAND = true;
+        using Shape = VecShape<Size>;
+        using ValueType = Type;
+
+        static ExpressionLeaf<Shape, Type> wrap(
+            const Vec<Size, Type, Allocator>& v) {
+            return {v.toPointer()};
+        }
+    };
+
+    /**
+     * Starts a lazy expression with the given vector.
+     * <p>
+     * Operations involving the returned expression are not
+     * evaluated until they are assigned to a vector:
+     * <pre>
+     * Vec3f r = rush::lazy(a) + rush::lazy(b) * c - d;
+     * </pre>
+     * evaluates the three operations in a single loop and
+     * creates no intermediate vectors.
+     * <p>
+     * Operators bind as usual, so subexpressions without a lazy operand
+     * are evaluated eagerly: in rush::lazy(a) + b * c,
+     * b * c creates an intermediate vector.
+     *
+     * @param v the vector.
+     * @return the expression.
+     */
+    template<size_t Size, typename Type, typename Allocator>
+    ExpressionLeaf<VecShape<Size>, Type>
+    lazy(const Vec<Size, Type, Allocator>& v) {
+        return {v.toPointer()};
+    }
+}
+
+#endif //RUSH_VEC_EXPRESSION_H
@@ -53,10 +53,18 @@ struct std::hash<rush::Vec<Size, Type, Allocator>> {
 
 template<size_t Size, typename Type, typename Allocator>
     requires rush::HasAdd<Type>
-rush::Vec<Size, Type, Allocator> operator+(
+constexpr rush::Vec<Size, Type, Allocator> operator+(
     const Type& s,
     const rush::Vec<Size, Type, Allocator>& v) {
     rush::Vec<Size, Type, Allocator> result;
+#ifdef RUSH_INTRINSICS
+    if constexpr (rush::simd::HasVecKernel<Size, Type>) {
+        if (!std::is_constant_evaluated()) {
+            rush::simd::add<Size>(v.toPointer(), s, result.toPointer());
+            return result;
+        }
+    }
+#endif
     for (size_t i = 0; i < Size; ++i) {
         result[i] = s + v[i];
     }
@@ -65,10 +73,18 @@ rush::Vec<Size, Type, Allocator> operator+(
 
 template<size_t Size, typename Type, typename Allocator>
     requires rush::HasSub<Type>
-rush::Vec<Size, Type, Allocator> operator-(
+constexpr rush::Vec<Size, Type, Allocator> operator-(
     const Type& s,
     const rush::Vec<Size, Type, Allocator>& v) {
     rush::Vec<Size, Type, Allocator> result;
+#ifdef RUSH_INTRINSICS
+    if constexpr (rush::simd::HasVecKernel<Size, Type>) {
+        if (!std::is_constant_evaluated()) {
+            rush::simd::sub<Size>(s, v.toPointer(), result.toPointer());
+            return result;
+        }
+    }
+#endif
     for (size_t i = 0; i < Size; ++i) {
         result[i] = s - v[i];
     }
@@ -77,10 +93,18 @@ rush::Vec<Size, Type, Allocator> operator-(
 
 template<size_t Size, typename Type, typename Allocator>
     requires rush::HasMul<Type>
-rush::Vec<Size, Type, Allocator> operator*(
+constexpr rush::Vec<Size, Type, Allocator> operator*(
     const Type& s,
     const rush::Vec<Size, Type, Allocator>& v) {
     rush::Vec<Size, Type, Allocator> result;
+#ifdef RUSH_INTRINSICS
+    if constexpr (rush::simd::HasVecKernel<Size, Type>) {
+        if (!std::is_constant_evaluated()) {
+            rush::simd::mul<Size>(v.toPointer(), s, result.toPointer());
+            return result;
+        }
+    }
+#endif
     for (size_t i = 0; i < Size; ++i) {
         result[i] = s * v[i];
     }
@@ -89,10 +113,18 @@ rush::Vec<Size, Type, Allocator> operator*(
 
 template<size_t Size, typename Type, typename Allocator>
     requires rush::HasDiv<Type>
-rush::Vec<Size, Type, Allocator> operator/(
+constexpr rush::Vec<Size, Type, Allocator> operator/(
     const Type& s,
     const rush::Vec<Size, Type, Allocator>& v) {
     rush::Vec<Size, Type, Allocator> result;
+#ifdef RUSH_INTRINSICS
+    if constexpr (rush::simd::HasVecKernel<Size, Type>) {
+        if (!std::is_constant_evaluated()) {
+            rush::simd::div<Size>(s, v.toPointer(), result.toPointer());
+            return result;
+        }
+    }
+#endif
     for (size_t i = 0; i < Size; ++i) {
         result[i] = s / v[i];
     }
@@ -101,7 +133,7 @@ rush::Vec<Size, Type, Allocator> operator/(
 
 template<size_t Size, typename Type, typename Allocator>
     requires rush::HasShl<Type>
-rush::Vec<Size, Type, Allocator> operator<<(
+constexpr rush::Vec<Size, Type, Allocator> operator<<(
     const Type& s,
     const rush::Vec<Size, Type, Allocator>& v) {
     rush::Vec<Size, Type, Allocator> result;
@@ -113,7 +145,7 @@ rush::Vec<Size, Type, Allocator> operator<<(
 
 template<size_t Size, typename Type, typename Allocator>
     requires rush::HasShr<Type>
-rush::Vec<Size, Type, Allocator> operator>>(
+constexpr rush::Vec<Size, Type, Allocator> operator>>(
     const Type& s,
     const rush::Vec<Size, Type, Allocator>& v) {
     rush::Vec<Size, Type, Allocator> result;
@@ -125,7 +157,7 @@ rush::Vec<Size, Type, Allocator> operator>>(
 
 template<size_t Size, typename Type, typename Allocator>
     requires rush::HasBitAnd<Type>
-rush::Vec<Size, Type, Allocator> operator&(
+constexpr rush::Vec<Size, Type, Allocator> operator&(
     const Type& s,
     const rush::Vec<Size, Type, Allocator>& v) {
     rush::Vec<Size, Type, Allocator> result;
@@ -137,7 +169,7 @@ rush::Vec<Size, Type, Allocator> operator&(
 
 template<size_t Size, typename Type, typename Allocator>
     requires rush::HasBitOr<Type>
-rush::Vec<Size, Type, Allocator> operator|(
+constexpr rush::Vec<Size, Type, Allocator> operator|(
     const Type& s,
     const rush::Vec<Size, Type, Allocator>& v) {
     rush::Vec<Size, Type, Allocator> result;
@@ -149,7 +181,7 @@ rush::Vec<Size, Type, Allocator> operator|(
 
 template<size_t Size, typename Type, typename Allocator>
     requires rush::HasBitXor<Type>
-rush::Vec<Size, Type, Allocator> operator^(
+constexpr rush::Vec<Size, Type, Allocator> operator^(
     const Type& s,
     const rush::Vec<Size, Type, Allocator>& v) {
     rush::Vec<Size, Type, Allocator> result;
@@ -161,7 +193,7 @@ rush::Vec<Size, Type, Allocator> operator^(
 
 template<size_t Size, typename Type, typename Allocator>
     requires rush::HasAnd<Type>
-rush::Vec<Size, Type, Allocator> operator&&(
+constexpr rush::Vec<Size, Type, Allocator> operator&&(
     const Type& s,
     const rush::Vec<Size, Type, Allocator>& v) {
     rush::Vec<Size, Type, Allocator> result;
@@ -173,7 +205,7 @@ rush::Vec<Size, Type, Allocator> operator&&(
 
 template<size_t Size, typename Type, typename Allocator>
     requires rush::HasOr<Type>
-rush::Vec<Size, Type, Allocator> operator||(
+constexpr rush::Vec<Size, Type, Allocator> operator||(
     const Type& s,
     const rush::Vec<Size, Type, Allocator>& v) {
     rush::Vec<Size, Type, Allocator> result;
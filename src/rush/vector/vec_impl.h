@@ -11,13 +11,13 @@
 namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>::Vec() : data() {
+    constexpr Vec<Size, Type, Allocator>::Vec() : data() {
     }
 
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>::Vec(Type fill) {
+    constexpr Vec<Size, Type, Allocator>::Vec(Type fill) {
         std::fill_n(begin(), Size, fill);
     }
 
@@ -26,7 +26,7 @@ namespace rush {
     template<typename... T>
         requires std::is_convertible_v<std::common_type_t<T...>, Type> &&
                  (Size > 1 && sizeof...(T) == Size)
-    Vec<Size, Type, Allocator>::Vec(T... list) {
+    constexpr Vec<Size, Type, Allocator>::Vec(T... list) {
         auto it = begin();
         ((*it++ = static_cast<Type>(list)), ...);
     }
@@ -35,7 +35,7 @@ namespace rush {
         requires (Size > 0)
     template<size_t OSize, typename OAlloc>
         requires(Size < OSize)
-    Vec<Size, Type, Allocator>::Vec(const Vec<OSize, Type, OAlloc>& other) {
+    constexpr Vec<Size, Type, Allocator>::Vec(const Vec<OSize, Type, OAlloc>& other) {
         std::copy_n(other.cbegin(), Size, begin());
     }
 
@@ -44,8 +44,8 @@ namespace rush {
     template<size_t OSize, typename OAlloc, typename... T>
         requires std::is_convertible_v<std::common_type_t<T...>, Type> &&
                  (sizeof...(T) + OSize == Size)
-    Vec<Size, Type, Allocator>::Vec(const Vec<OSize, Type, OAlloc>& other,
-                                    T... list) {
+    constexpr Vec<Size, Type, Allocator>::Vec(const Vec<OSize, Type, OAlloc>& other,
+                                              T... list) {
         auto it = begin();
         auto oIt = other.cbegin();
         for (size_t i = 0; i < OSize; ++i) {
@@ -56,7 +56,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>::Vec(const VecRef<Size, Type>& ref) {
+    constexpr Vec<Size, Type, Allocator>::Vec(const VecRef<Size, Type>& ref) {
         for (size_t i = 0; i < Size; ++i) {
             data[i] = *ref.references[i];
         }
@@ -81,49 +81,79 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    const Type& Vec<Size, Type, Allocator>::x() const {
+    template<typename Populator>
+        requires std::is_invocable_r_v<Type, Populator&, size_t>
+    constexpr Vec<Size, Type, Allocator>::Vec(Populator&& populator) {
+        for (size_t i = 0; i < Size; ++i) {
+            data[i] = populator(i);
+        }
+    }
+
+    template<size_t Size, typename Type, typename Allocator>
+        requires (Size > 0)
+    template<typename Populator>
+        requires (std::is_invocable_r_v<Type, Populator&, size_t, size_t>
+                  && !std::is_invocable_v<Populator&, size_t>)
+    constexpr Vec<Size, Type, Allocator>::Vec(Populator&& populator) {
+        for (size_t i = 0; i < Size; ++i) {
+            data[i] = populator(i, Size);
+        }
+    }
+
+    template<size_t Size, typename Type, typename Allocator>
+        requires (Size > 0)
+    template<typename E> requires ExpressionOf<E, VecShape<Size>, Type>
+    constexpr Vec<Size, Type, Allocator>::Vec(const E& expression) {
+        for (size_t i = 0; i < Size; ++i) {
+            data[i] = expression.value(i);
+        }
+    }
+
+    template<size_t Size, typename Type, typename Allocator>
+        requires (Size > 0)
+    constexpr const Type& Vec<Size, Type, Allocator>::x() const {
         return data[0];
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Type& Vec<Size, Type, Allocator>::x() {
+    constexpr Type& Vec<Size, Type, Allocator>::x() {
         return data[0];
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    const Type& Vec<Size, Type, Allocator>::y() const requires (Size >= 2) {
+    constexpr const Type& Vec<Size, Type, Allocator>::y() const requires (Size >= 2) {
         return data[1];
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Type& Vec<Size, Type, Allocator>::y() requires (Size >= 2) {
+    constexpr Type& Vec<Size, Type, Allocator>::y() requires (Size >= 2) {
         return data[1];
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    const Type& Vec<Size, Type, Allocator>::z() const requires (Size >= 3) {
+    constexpr const Type& Vec<Size, Type, Allocator>::z() const requires (Size >= 3) {
         return data[2];
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Type& Vec<Size, Type, Allocator>::z() requires (Size >= 3) {
+    constexpr Type& Vec<Size, Type, Allocator>::z() requires (Size >= 3) {
         return data[2];
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    const Type& Vec<Size, Type, Allocator>::w() const requires (Size >= 4) {
+    constexpr const Type& Vec<Size, Type, Allocator>::w() const requires (Size >= 4) {
         return data[3];
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Type& Vec<Size, Type, Allocator>::w() requires (Size >= 4) {
+    constexpr Type& Vec<Size, Type, Allocator>::w() requires (Size >= 4) {
         return data[3];
     }
 
@@ -131,7 +161,7 @@ namespace rush {
         requires (Size > 0)
     template<typename... Ts, typename OAlloc>
         requires std::is_convertible_v<std::common_type_t<Ts...>, size_t>
-    Vec<sizeof...(Ts), Type, OAlloc>
+    constexpr Vec<sizeof...(Ts), Type, OAlloc>
     Vec<Size, Type, Allocator>::operator()(Ts&&... indices) const {
         Vec<sizeof...(Ts), Type, OAlloc> vec;
         size_t i = 0;
@@ -139,11 +169,32 @@ namespace rush {
         return vec;
     }
 
+    template<size_t Size, typename Type, typename Allocator>
+        requires (Size > 0)
+    template<size_t... Indices, typename OAlloc>
+        requires (sizeof...(Indices) > 0 && ((Indices < Size) && ...))
+    constexpr Vec<sizeof...(Indices), Type, OAlloc>
+    Vec<Size, Type, Allocator>::swizzle() const {
+        Vec<sizeof...(Indices), Type, OAlloc> vec;
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type> && Size <= 4 &&
+                      sizeof...(Indices) >= 2 && sizeof...(Indices) <= 4) {
+            if (!std::is_constant_evaluated()) {
+                simd::swizzle<Size, Indices...>(toPointer(), vec.toPointer());
+                return vec;
+            }
+        }
+#endif
+        size_t i = 0;
+        ((vec.data[i++] = data[Indices]), ...);
+        return vec;
+    }
+
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename... Ts>
         requires std::is_convertible_v<std::common_type_t<Ts...>, size_t>
-    VecRef<sizeof...(Ts), Type>
+    constexpr VecRef<sizeof...(Ts), Type>
     Vec<Size, Type, Allocator>::operator()(Ts&&... indices) {
         VecRef<sizeof...(Ts), Type> vec;
         size_t i = 0;
@@ -153,26 +204,26 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Type& Vec<Size, Type, Allocator>::operator[](size_t index) {
+    constexpr Type& Vec<Size, Type, Allocator>::operator[](size_t index) {
         return data[index];
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    const Type&
+    constexpr const Type&
     Vec<Size, Type, Allocator>::operator[](size_t index) const {
         return data[index];
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    const Type* Vec<Size, Type, Allocator>::toPointer() const {
+    constexpr const Type* Vec<Size, Type, Allocator>::toPointer() const {
         return data.toPointer();
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Type* Vec<Size, Type, Allocator>::toPointer() {
+    constexpr Type* Vec<Size, Type, Allocator>::toPointer() {
         return data.toPointer();
     }
 
@@ -184,25 +235,25 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Type Vec<Size, Type, Allocator>::squaredLength() const {
+    constexpr Type Vec<Size, Type, Allocator>::squaredLength() const {
         return this->dot(*this);
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename Return>
-    Return Vec<Size, Type, Allocator>::length() const requires (
+    constexpr Return Vec<Size, Type, Allocator>::length() const requires (
         std::is_convertible_v<Type, Return> && HasSquaredRoot<Type>) {
-        return static_cast<Return>(std::sqrt(squaredLength()));
+        return static_cast<Return>(rush::sqrt(squaredLength()));
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename Return, Algorithm A>
-    Return Vec<Size, Type, Allocator>::inverseLength() const requires (
+    constexpr Return Vec<Size, Type, Allocator>::inverseLength() const requires (
         std::is_convertible_v<Type, Return> && HasSquaredRoot<Type>) {
         if constexpr (A.precision == Precision::High) {
-            return 1.0f / std::sqrt(squaredLength());
+            return 1.0f / rush::sqrt(squaredLength());
         }
 
         if constexpr (std::is_same_v<Return, float>) {
@@ -210,7 +261,9 @@ namespace rush {
 
 #ifdef RUSH_INTRINSICS
             if constexpr (A.useIntrinsics()) {
-                return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(y)));
+                if (!std::is_constant_evaluated()) {
+                    return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(y)));
+                }
             }
 #endif
 
@@ -229,14 +282,26 @@ namespace rush {
             return y * (1.5f - x2 * y * y);
         }
 
-        return 1.0f / std::sqrt(squaredLength());
+        return 1.0f / rush::sqrt(squaredLength());
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename Return, Algorithm A, typename OAlloc>
-    Vec<Size, Return, OAlloc>
+    constexpr Vec<Size, Return, OAlloc>
     Vec<Size, Type, Allocator>::normalized() const requires HasMul<Return> {
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type> &&
+                      std::is_same_v<Return, Type> && A.useIntrinsics()) {
+            if (!std::is_constant_evaluated()) {
+                Vec<Size, Return, OAlloc> result;
+                simd::normalize<Size, A.precision>(toPointer(),
+                                                   result.toPointer());
+                return result;
+            }
+        }
+#endif
+
         Return invLen = inverseLength<Return, A>();
         Vec<Size, Return, OAlloc> result;
         for (size_t i = 0; i < Size; ++i) {
@@ -248,7 +313,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename To, typename OAlloc>
-    Vec<Size, To, OAlloc> Vec<Size, Type, Allocator>::cast() const {
+    constexpr Vec<Size, To, OAlloc> Vec<Size, Type, Allocator>::cast() const {
         return Vec<Size, To, OAlloc>([this](size_t i) {
             return static_cast<To>(data[i]);
         });
@@ -256,15 +321,15 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator> requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, OAlloc> Vec<Size, Type, Allocator>::reverse() const {
+    constexpr Vec<Size, Type, OAlloc> Vec<Size, Type, Allocator>::reverse() const {
         return Vec<Size, Type, OAlloc>([this](size_t i) {
-            return data[Size - i];
+            return data[Size - 1 - i];
         });
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    std::array<Type, Size> Vec<Size, Type, Allocator>::toArray() const {
+    constexpr std::array<Type, Size> Vec<Size, Type, Allocator>::toArray() const {
         std::array<Type, Size> array;
         for (int i = 0; i < Size; ++i) {
             array[i] = data[i];
@@ -274,23 +339,31 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator+() {
         return *this;
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    const Vec<Size, Type, Allocator>&
+    constexpr const Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator+() const {
         return *this;
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator-() const requires HasSub<Type> {
         Vec result;
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::negate<Size>(toPointer(), result.toPointer());
+                return result;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             result[i] = -data[i];
         }
@@ -299,9 +372,17 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator+=(
         const Type& s) requires HasAdd<Type> {
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::add<Size>(toPointer(), s, toPointer());
+                return *this;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             data[i] += s;
         }
@@ -310,9 +391,17 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator-=(
         const Type& s) requires HasSub<Type> {
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::sub<Size>(toPointer(), s, toPointer());
+                return *this;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             data[i] -= s;
         }
@@ -321,9 +410,17 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator*=(
         const Type& s) requires HasMul<Type> {
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::mul<Size>(toPointer(), s, toPointer());
+                return *this;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             data[i] *= s;
         }
@@ -332,9 +429,17 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator/=(
         const Type& s) requires HasDiv<Type> {
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::div<Size>(toPointer(), s, toPointer());
+                return *this;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             data[i] /= s;
         }
@@ -343,7 +448,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator<<=(
         const Type& s) requires HasShl<Type> {
         for (size_t i = 0; i < Size; ++i) {
@@ -354,7 +459,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator>>=(
         const Type& s) requires HasShr<Type> {
         for (size_t i = 0; i < Size; ++i) {
@@ -365,7 +470,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator&=(
         const Type& s) requires HasBitAnd<Type> {
         for (size_t i = 0; i < Size; ++i) {
@@ -376,7 +481,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator|=(
         const Type& s) requires HasBitOr<Type> {
         for (size_t i = 0; i < Size; ++i) {
@@ -387,7 +492,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator^=(
         const Type& s) requires HasBitXor<Type> {
         for (size_t i = 0; i < Size; ++i) {
@@ -396,12 +501,57 @@ namespace rush {
         return *this;
     }
 
+    template<size_t Size, typename Type, typename Allocator>
+        requires (Size > 0)
+    template<typename E> requires ExpressionOf<E, VecShape<Size>, Type>
+    constexpr Vec<Size, Type, Allocator>&
+    Vec<Size, Type, Allocator>::operator=(const E& expression) {
+        // Element i of an expression only depends on the element i
+        // of its operands, so this vector can be part of the expression.
+        for (size_t i = 0; i < Size; ++i) {
+            data[i] = expression.value(i);
+        }
+        return *this;
+    }
+
+    template<size_t Size, typename Type, typename Allocator>
+        requires (Size > 0)
+    template<typename E> requires ExpressionOf<E, VecShape<Size>, Type>
+    constexpr Vec<Size, Type, Allocator>&
+    Vec<Size, Type, Allocator>::operator+=(
+        const E& expression) requires HasAdd<Type> {
+        for (size_t i = 0; i < Size; ++i) {
+            data[i] += expression.value(i);
+        }
+        return *this;
+    }
+
+    template<size_t Size, typename Type, typename Allocator>
+        requires (Size > 0)
+    template<typename E> requires ExpressionOf<E, VecShape<Size>, Type>
+    constexpr Vec<Size, Type, Allocator>&
+    Vec<Size, Type, Allocator>::operator-=(
+        const E& expression) requires HasSub<Type> {
+        for (size_t i = 0; i < Size; ++i) {
+            data[i] -= expression.value(i);
+        }
+        return *this;
+    }
+
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator+=(
         const Vec<Size, Type, OAlloc>& o) requires HasAdd<Type> {
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::add<Size>(toPointer(), o.toPointer(), toPointer());
+                return *this;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             data[i] += o[i];
         }
@@ -411,9 +561,17 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator-=(
         const Vec<Size, Type, OAlloc>& o) requires HasSub<Type> {
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::sub<Size>(toPointer(), o.toPointer(), toPointer());
+                return *this;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             data[i] -= o[i];
         }
@@ -423,9 +581,17 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator*=(
         const Vec<Size, Type, OAlloc>& o) requires HasMul<Type> {
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::mul<Size>(toPointer(), o.toPointer(), toPointer());
+                return *this;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             data[i] *= o[i];
         }
@@ -435,9 +601,17 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator/=(
         const Vec<Size, Type, OAlloc>& o) requires HasDiv<Type> {
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::div<Size>(toPointer(), o.toPointer(), toPointer());
+                return *this;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             data[i] /= o[i];
         }
@@ -447,7 +621,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator<<=(
         const Vec<Size, Type, OAlloc>& o) requires HasShl<Type> {
         for (size_t i = 0; i < Size; ++i) {
@@ -459,7 +633,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator>>=(
         const Vec<Size, Type, OAlloc>& o) requires HasShr<Type> {
         for (size_t i = 0; i < Size; ++i) {
@@ -471,7 +645,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator&=(
         const Vec<Size, Type, OAlloc>& o) requires HasBitAnd<Type> {
         for (size_t i = 0; i < Size; ++i) {
@@ -483,7 +657,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator|=(
         const Vec<Size, Type, OAlloc>& o) requires HasBitOr<Type> {
         for (size_t i = 0; i < Size; ++i) {
@@ -495,7 +669,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>&
+    constexpr Vec<Size, Type, Allocator>&
     Vec<Size, Type, Allocator>::operator^=(
         const Vec<Size, Type, OAlloc>& o) requires HasBitXor<Type> {
         for (size_t i = 0; i < Size; ++i) {
@@ -506,10 +680,18 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator+(
         const Type& s) const requires HasAdd<Type> {
         Vec result;
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::add<Size>(toPointer(), s, result.toPointer());
+                return result;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             result[i] = data[i] + s;
         }
@@ -518,10 +700,18 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator-(
         const Type& s) const requires HasSub<Type> {
         Vec result;
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::sub<Size>(toPointer(), s, result.toPointer());
+                return result;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             result[i] = data[i] - s;
         }
@@ -530,10 +720,18 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator*(
         const Type& s) const requires HasMul<Type> {
         Vec result;
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::mul<Size>(toPointer(), s, result.toPointer());
+                return result;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             result[i] = data[i] * s;
         }
@@ -542,10 +740,18 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator/(
         const Type& s) const requires HasDiv<Type> {
         Vec result;
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::div<Size>(toPointer(), s, result.toPointer());
+                return result;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             result[i] = data[i] / s;
         }
@@ -554,7 +760,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator%(
         const Type& s) const requires HasMod<Type> {
         Vec result;
@@ -566,7 +772,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator<<(
         const Type& s) const requires HasShl<Type> {
         Vec result;
@@ -578,7 +784,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator>>(
         const Type& s) const requires HasShr<Type> {
         Vec result;
@@ -590,7 +796,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator&(
         const Type& s) const requires HasBitAnd<Type> {
         Vec result;
@@ -602,7 +808,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator|(
         const Type& s) const requires HasBitOr<Type> {
         Vec result;
@@ -614,7 +820,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator^(
         const Type& s) const requires HasBitXor<Type> {
         Vec result;
@@ -626,7 +832,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator&&(
         const Type& s) const requires HasAnd<Type> {
         Vec result;
@@ -638,7 +844,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator||(
         const Type& s) const requires HasOr<Type> {
         Vec result;
@@ -655,25 +861,33 @@ namespace rush {
     Vec<Size, Type, Allocator>::angle(const Vec<Size, Type, OAlloc>& other) {
         if constexpr (A.precision == Precision::High && Size == 3) {
             // Use atan2!
-            Return m = Return(1.0) / std::sqrt(squaredLength()
+            Return m = Return(1.0) / rush::sqrt(squaredLength()
                                                * other.squaredLength());
             Return c = dot(other) * m;
             Return s = cross(other).length() * m;
             return std::atan2(s, c);
         }
 
-        Return inv = std::sqrt(squaredLength() * other.squaredLength());
+        Return inv = rush::sqrt(squaredLength() * other.squaredLength());
         return std::acos(dot(other) / inv);
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator+(
         const Vec<Size, Type, OAlloc>& other) const requires
         HasAdd<Type> {
         Vec result;
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::add<Size>(toPointer(), other.toPointer(), result.toPointer());
+                return result;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             result[i] = data[i] + other[i];
         }
@@ -683,11 +897,19 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator-(
         const Vec<Size, Type, OAlloc>& other) const requires
         HasSub<Type> {
         Vec result;
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::sub<Size>(toPointer(), other.toPointer(), result.toPointer());
+                return result;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             result[i] = data[i] - other[i];
         }
@@ -697,11 +919,19 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator*(
         const Vec<Size, Type, OAlloc>& other) const requires
         HasMul<Type> {
         Vec result;
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::mul<Size>(toPointer(), other.toPointer(), result.toPointer());
+                return result;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             result[i] = data[i] * other[i];
         }
@@ -711,11 +941,19 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator/(
         const Vec<Size, Type, OAlloc>& other) const requires
         HasDiv<Type> {
         Vec result;
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                simd::div<Size>(toPointer(), other.toPointer(), result.toPointer());
+                return result;
+            }
+        }
+#endif
         for (size_t i = 0; i < Size; ++i) {
             result[i] = data[i] / other[i];
         }
@@ -725,7 +963,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Type Vec<Size, Type, Allocator>::operator%(const Vec<Size, Type,
+    constexpr Type Vec<Size, Type, Allocator>::operator%(const Vec<Size, Type,
         OAlloc>& other) const requires HasMod<Type> {
         Vec result;
         for (size_t i = 0; i < Size; ++i) {
@@ -737,7 +975,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator<<(
         const Vec<Size, Type, OAlloc>& other) const requires
         HasShl<Type> {
@@ -751,7 +989,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator>>(
         const Vec<Size, Type, OAlloc>& other) const requires HasShr<Type> {
         Vec result;
@@ -764,7 +1002,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator&(
         const Vec<Size, Type, OAlloc>& other)
     const requires HasBitAnd<Type> {
@@ -778,7 +1016,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator|(
         const Vec<Size, Type, OAlloc>& other)
     const requires HasBitOr<Type> {
@@ -792,7 +1030,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator^(
         const Vec<Size, Type, OAlloc>& other)
     const requires HasBitXor<Type> {
@@ -806,7 +1044,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator&&(
         const Vec<Size, Type, OAlloc>& other) const requires
         HasAnd<Type> {
@@ -820,7 +1058,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::operator||(
         const Vec<Size, Type, OAlloc>& other) const requires
         HasOr<Type> {
@@ -834,8 +1072,15 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Type Vec<Size, Type, Allocator>::dot(
+    constexpr Type Vec<Size, Type, Allocator>::dot(
         const Vec<Size, Type, OAlloc>& other) const {
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                return simd::dot<Size>(toPointer(), other.toPointer());
+            }
+        }
+#endif
         Type result = data[0] * other[0];
         for (size_t i = 1; i < Size; ++i) {
             result += data[i] * other[i];
@@ -846,10 +1091,19 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    Vec<Size, Type, Allocator>
+    constexpr Vec<Size, Type, Allocator>
     Vec<Size, Type, Allocator>::cross(
         const Vec<Size, Type, OAlloc>& other) const requires (
         Size == 3 && HasAdd<Type> && HasMul<Type>) {
+#ifdef RUSH_INTRINSICS
+        if constexpr (simd::HasVecKernel<Size, Type>) {
+            if (!std::is_constant_evaluated()) {
+                Vec result;
+                simd::cross(toPointer(), other.toPointer(), result.toPointer());
+                return result;
+            }
+        }
+#endif
         return {
             y() * other.z() - other.y() * z(),
             z() * other.x() - other.z() * x(),
@@ -860,7 +1114,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    bool Vec<Size, Type, Allocator>::operator==(
+    constexpr bool Vec<Size, Type, Allocator>::operator==(
         const Vec<Size, Type, OAlloc>& other) const {
         if constexpr (std::is_same_v<Vec, Vec<Size, Type, OAlloc>>) {
             if (this == &other) return true;
@@ -871,7 +1125,7 @@ namespace rush {
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
     template<typename OAlloc>
-    bool Vec<Size, Type, Allocator>::operator!=(
+    constexpr bool Vec<Size, Type, Allocator>::operator!=(
         const Vec<Size, Type, OAlloc>& other) const {
         if constexpr (std::is_same_v<Vec, Vec<Size, Type, OAlloc>>) {
             if (this == &other) return false;
@@ -881,7 +1135,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    bool Vec<Size, Type, Allocator>::operator==(
+    constexpr bool Vec<Size, Type, Allocator>::operator==(
         const VecRef<Size, Type>& other) const {
         for (int i = 0; i < Size; ++i) {
             if (data[i] != *other.references[i]) return false;
@@ -891,7 +1145,7 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    bool Vec<Size, Type, Allocator>::operator!=(
+    constexpr bool Vec<Size, Type, Allocator>::operator!=(
         const VecRef<Size, Type>& other) const {
         for (int i = 0; i < Size; ++i) {
             if (data[i] != *other.references[i]) return true;
@@ -901,61 +1155,61 @@ namespace rush {
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    auto Vec<Size, Type, Allocator>::begin() {
+    constexpr auto Vec<Size, Type, Allocator>::begin() {
         return data.begin();
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    auto Vec<Size, Type, Allocator>::begin() const {
+    constexpr auto Vec<Size, Type, Allocator>::begin() const {
         return data.cbegin();
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    auto Vec<Size, Type, Allocator>::end() {
+    constexpr auto Vec<Size, Type, Allocator>::end() {
         return data.end();
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    auto Vec<Size, Type, Allocator>::end() const {
+    constexpr auto Vec<Size, Type, Allocator>::end() const {
         return data.cend();
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    auto Vec<Size, Type, Allocator>::cbegin() const {
+    constexpr auto Vec<Size, Type, Allocator>::cbegin() const {
         return data.cbegin();
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    auto Vec<Size, Type, Allocator>::cend() const {
+    constexpr auto Vec<Size, Type, Allocator>::cend() const {
         return data.cend();
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    auto Vec<Size, Type, Allocator>::rbegin() {
+    constexpr auto Vec<Size, Type, Allocator>::rbegin() {
         return data.rbegin();
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    auto Vec<Size, Type, Allocator>::rend() {
+    constexpr auto Vec<Size, Type, Allocator>::rend() {
         return data.rend();
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    auto Vec<Size, Type, Allocator>::crbegin() const {
+    constexpr auto Vec<Size, Type, Allocator>::crbegin() const {
         return data.crbegin();
     }
 
     template<size_t Size, typename Type, typename Allocator>
         requires (Size > 0)
-    auto Vec<Size, Type, Allocator>::crend() const {
+    constexpr auto Vec<Size, Type, Allocator>::crend() const {
         return data.crend();
     }
 }
@@ -6,10 +6,38 @@
 #define RUSH_VEC_MATH_H
 
 #include <numbers>
+#include <type_traits>
+#include <utility>
 
+#include <rush/algorithm.h>
+#include <rush/fast_math.h>
 #include <rush/vector/vec.h>
 
 namespace rush {
+    namespace detail {
+        /**
+         * Whether the given algorithm should use the approximations
+         * of rush/fast_math.h for vectors of the given type.
+         * <p>
+         * The approximations are only available for float.
+         * Other types always use the std functions.
+         */
+        template<Algorithm A, typename Type>
+        constexpr bool UseFastMath = A.precision == Precision::Low &&
+                                     std::is_same_v<Type, float>;
+
+        template<Algorithm A, fast::detail::Function F,
+            simd::Broadcast B = simd::Broadcast::None>
+        void applyFastMath(const float* a, const float* b,
+                           float* out, float* out2, size_t n) {
+            if constexpr (A.useIntrinsics()) {
+                fast::detail::bulk<F, B>(a, b, out, out2, n);
+            } else {
+                fast::detail::bulkGeneric<F, B>(a, b, out, out2, n);
+            }
+        }
+    }
+
     template<size_t Size, typename Type, typename Allocator>
     Vec<Size, Type, Allocator> abs(const Vec<Size, Type, Allocator>& v) {
         return Vec<Size, Type, Allocator>{
@@ -24,18 +52,70 @@ namespace rush {
         };
     }
 
-    template<size_t Size, typename Type, typename Allocator>
+    /**
+     * Computes the cosine of every component of the given vector.
+     * <p>
+     * If the precision of the algorithm is Precision::Low,
+     * float vectors use fast::cos().
+     */
+    template<Algorithm A = Algorithm(), size_t Size, typename Type, typename Allocator>
     Vec<Size, Type, Allocator> cos(const Vec<Size, Type, Allocator>& v) {
-        return Vec<Size, Type, Allocator>{
-            [v](size_t i) { return std::cos(v[i]); }
-        };
+        if constexpr (detail::UseFastMath<A, Type>) {
+            Vec<Size, Type, Allocator> result;
+            detail::applyFastMath<A, fast::detail::Function::Cos>(
+                v.toPointer(), v.toPointer(), result.toPointer(), result.toPointer(), Size);
+            return result;
+        } else {
+            return Vec<Size, Type, Allocator>{
+                [v](size_t i) { return std::cos(v[i]); }
+            };
+        }
     }
 
-    template<size_t Size, typename Type, typename Allocator>
+    /**
+     * Computes the sine of every component of the given vector.
+     * <p>
+     * If the precision of the algorithm is Precision::Low,
+     * float vectors use fast::sin().
+     */
+    template<Algorithm A = Algorithm(), size_t Size, typename Type, typename Allocator>
     Vec<Size, Type, Allocator> sin(const Vec<Size, Type, Allocator>& v) {
-        return Vec<Size, Type, Allocator>{
-            [v](size_t i) { return std::sin(v[i]); }
-        };
+        if constexpr (detail::UseFastMath<A, Type>) {
+            Vec<Size, Type, Allocator> result;
+            detail::applyFastMath<A, fast::detail::Function::Sin>(
+                v.toPointer(), v.toPointer(), result.toPointer(), result.toPointer(), Size);
+            return result;
+        } else {
+            return Vec<Size, Type, Allocator>{
+                [v](size_t i) { return std::sin(v[i]); }
+            };
+        }
+    }
+
+    /**
+     * Computes the sine and the cosine of every component
+     * of the given vector.
+     * <p>
+     * If the precision of the algorithm is Precision::Low,
+     * float vectors use fast::sincos().
+     *
+     * @return the sines and the cosines.
+     */
+    template<Algorithm A = Algorithm(), size_t Size, typename Type, typename Allocator>
+    std::pair<Vec<Size, Type, Allocator>, Vec<Size, Type, Allocator>>
+    sincos(const Vec<Size, Type, Allocator>& v) {
+        std::pair<Vec<Size, Type, Allocator>, Vec<Size, Type, Allocator>> result;
+        if constexpr (detail::UseFastMath<A, Type>) {
+            detail::applyFastMath<A, fast::detail::Function::SinCos>(
+                v.toPointer(), v.toPointer(),
+                result.first.toPointer(), result.second.toPointer(), Size);
+        } else {
+            for (size_t i = 0; i < Size; ++i) {
+                result.first[i] = std::sin(v[i]);
+                result.second[i] = std::cos(v[i]);
+            }
+        }
+        return result;
     }
 
     template<size_t Size, typename Type, typename Allocator>
@@ -66,6 +146,68 @@ namespace rush {
         };
     }
 
+    /**
+     * Computes atan2(y[i], x[i]) for every component of the given vectors.
+     * <p>
+     * If the precision of the algorithm is Precision::Low,
+     * float vectors use fast::atan2().
+     */
+    template<Algorithm A = Algorithm(), size_t Size, typename Type,
+        typename AAllocator, typename BAllocator>
+    Vec<Size, Type, AAllocator> atan2(const Vec<Size, Type, AAllocator>& y,
+                                      const Vec<Size, Type, BAllocator>& x) {
+        if constexpr (detail::UseFastMath<A, Type>) {
+            Vec<Size, Type, AAllocator> result;
+            detail::applyFastMath<A, fast::detail::Function::Atan2>(
+                y.toPointer(), x.toPointer(), result.toPointer(), result.toPointer(), Size);
+            return result;
+        } else {
+            return Vec<Size, Type, AAllocator>{
+                [y, x](size_t i) { return std::atan2(y[i], x[i]); }
+            };
+        }
+    }
+
+    /**
+     * Computes e^v[i] for every component of the given vector.
+     * <p>
+     * If the precision of the algorithm is Precision::Low,
+     * float vectors use fast::exp().
+     */
+    template<Algorithm A = Algorithm(), size_t Size, typename Type, typename Allocator>
+    Vec<Size, Type, Allocator> exp(const Vec<Size, Type, Allocator>& v) {
+        if constexpr (detail::UseFastMath<A, Type>) {
+            Vec<Size, Type, Allocator> result;
+            detail::applyFastMath<A, fast::detail::Function::Exp>(
+                v.toPointer(), v.toPointer(), result.toPointer(), result.toPointer(), Size);
+            return result;
+        } else {
+            return Vec<Size, Type, Allocator>{
+                [v](size_t i) { return std::exp(v[i]); }
+            };
+        }
+    }
+
+    /**
+     * Computes the natural logarithm of every component of the given vector.
+     * <p>
+     * If the precision of the algorithm is Precision::Low,
+     * float vectors use fast::log().
+     */
+    template<Algorithm A = Algorithm(), size_t Size, typename Type, typename Allocator>
+    Vec<Size, Type, Allocator> log(const Vec<Size, Type, Allocator>& v) {
+        if constexpr (detail::UseFastMath<A, Type>) {
+            Vec<Size, Type, Allocator> result;
+            detail::applyFastMath<A, fast::detail::Function::Log>(
+                v.toPointer(), v.toPointer(), result.toPointer(), result.toPointer(), Size);
+            return result;
+        } else {
+            return Vec<Size, Type, Allocator>{
+                [v](size_t i) { return std::log(v[i]); }
+            };
+        }
+    }
+
     template<size_t Size, typename Type, typename Allocator>
     Vec<Size, Type, Allocator> degrees(const Vec<Size, Type, Allocator>& v) {
         constexpr Type RELATION = Type(180) / std::numbers::pi_v<Type>;
@@ -172,21 +314,48 @@ namespace rush {
         return result / static_cast<Type>(Size);
     }
 
-    template<size_t Size, typename Type, typename Allocator>
+    /**
+     * Raises every component of the given vector to the given power.
+     * <p>
+     * If the precision of the algorithm is Precision::Low,
+     * float vectors use fast::pow(). The components must be positive.
+     */
+    template<Algorithm A = Algorithm(), size_t Size, typename Type, typename Allocator>
     Vec<Size, Type, Allocator>
     pow(const Vec<Size, Type, Allocator>& v, const Type& p) {
-        return Vec<Size, Type, Allocator>{
-            [v, p](size_t i) { return std::pow(v[i], p); }
-        };
+        if constexpr (detail::UseFastMath<A, Type>) {
+            Vec<Size, Type, Allocator> result;
+            detail::applyFastMath<A, fast::detail::Function::Pow, simd::Broadcast::Right>(
+                v.toPointer(), &p, result.toPointer(), result.toPointer(), Size);
+            return result;
+        } else {
+            return Vec<Size, Type, Allocator>{
+                [v, p](size_t i) { return std::pow(v[i], p); }
+            };
+        }
     }
 
-    template<size_t Size, typename Type,
+    /**
+     * Raises every component of the given vector to
+     * the matching component of p.
+     * <p>
+     * If the precision of the algorithm is Precision::Low,
+     * float vectors use fast::pow(). The components must be positive.
+     */
+    template<Algorithm A = Algorithm(), size_t Size, typename Type,
         typename AAllocator, typename BAllocator>
     Vec<Size, Type, AAllocator> pow(const Vec<Size, Type, AAllocator>& v,
                                     const Vec<Size, Type, BAllocator>& p) {
-        return Vec<Size, Type, AAllocator>{
-            [v, p](size_t i) { return std::pow(v[i], p[i]); }
-        };
+        if constexpr (detail::UseFastMath<A, Type>) {
+            Vec<Size, Type, AAllocator> result;
+            detail::applyFastMath<A, fast::detail::Function::Pow>(
+                v.toPointer(), p.toPointer(), result.toPointer(), result.toPointer(), Size);
+            return result;
+        } else {
+            return Vec<Size, Type, AAllocator>{
+                [v, p](size_t i) { return std::pow(v[i], p[i]); }
+            };
+        }
     }
 }
 
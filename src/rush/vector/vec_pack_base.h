@@ -0,0 +1,256 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_VEC_PACK_BASE_H
+#define RUSH_VEC_PACK_BASE_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <span>
+#include <type_traits>
+
+#include <rush/concepts.h>
+#include <rush/vector/vec_base.h>
+
+namespace rush {
+    /**
+     * Represents a pack of Lanes vectors stored as a structure of arrays.
+     * <p>
+     * Instead of storing each vector contiguously (x0, y0, z0, x1, y1, z1...),
+     * a pack stores each component contiguously (x0, x1..., y0, y1..., z0, z1...).
+     * Every operation is then performed component by component over all
+     * lanes at once, which maps directly to SIMD registers:
+     * a Vec3fx8 uses all eight lanes of an AVX register, while a Vec3f
+     * wastes one of the four lanes of an SSE register.
+     * <p>
+     * Each component array is aligned to its size (up to 64 bytes).
+     * The loops of the operations have a fixed trip count, and compilers
+     * vectorize them using the widest instruction set enabled for the
+     * translation unit.
+     * <p>
+     * Packs can be loaded from and stored to spans of vectors using
+     * gather() and scatter().
+     *
+     * @tparam Size the size of the vectors.
+     * @tparam Type the type of the vectors.
+     * @tparam Lanes the amount of vectors inside the pack.
+     */
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    struct VecPack {
+        using Lane = std::array<Type, Lanes>;
+
+        static constexpr size_t ALIGNMENT =
+                std::has_single_bit(sizeof(Lane))
+                    ? std::min(sizeof(Lane), size_t(64))
+                    : alignof(Lane);
+
+        alignas(ALIGNMENT) Lane data[Size];
+
+        /**
+         * Creates a new pack with all its values
+         * initialized to their default values.
+         */
+        VecPack();
+
+        /**
+         * Creates a new pack with all its values
+         * initialized to the given value.
+         * @param fill the value.
+         */
+        explicit VecPack(Type fill);
+
+        /**
+         * Creates a new pack with all its lanes
+         * initialized to the given vector.
+         * @param vector the vector.
+         */
+        template<typename Allocator>
+        explicit VecPack(const Vec<Size, Type, Allocator>& vector);
+
+        /**
+         * Creates a new pack loading the given vectors.
+         * <p>
+         * The vectors offset to offset + Lanes are loaded.
+         * If the span has less vectors, the remaining lanes
+         * are initialized to their default values.
+         *
+         * @param vectors the vectors to load.
+         * @param offset the index of the first vector to load.
+         * @return the pack.
+         */
+        template<typename Allocator = StaticAllocator>
+        static VecPack gather(
+            std::type_identity_t<std::span<const Vec<Size, Type, Allocator>>>
+            vectors,
+            size_t offset = 0);
+
+        /**
+         * Creates a new pack loading the vectors at the given indices.
+         * <p>
+         * Lane i is loaded from vectors[indices[i]].
+         * If less than Lanes indices are given, the remaining lanes
+         * are initialized to their default values.
+         *
+         * @param vectors the vectors to load.
+         * @param indices the indices of the vectors to load.
+         * @return the pack.
+         */
+        template<typename Allocator = StaticAllocator>
+        static VecPack gather(
+            std::type_identity_t<std::span<const Vec<Size, Type, Allocator>>>
+            vectors,
+            std::span<const size_t> indices);
+
+        /**
+         * Stores the lanes of this pack into the given vectors.
+         * <p>
+         * Lane i is stored into vectors[offset + i].
+         * Lanes that fall outside the span are discarded.
+         *
+         * @param vectors the destination.
+         * @param offset the index of the first destination vector.
+         */
+        template<typename Allocator = StaticAllocator>
+        void scatter(
+            std::type_identity_t<std::span<Vec<Size, Type, Allocator>>>
+            vectors,
+            size_t offset = 0) const;
+
+        /**
+         * Stores the lanes of this pack into the vectors
+         * at the given indices.
+         * <p>
+         * Lane i is stored into vectors[indices[i]].
+         *
+         * @param vectors the destination.
+         * @param indices the indices of the destination vectors.
+         */
+        template<typename Allocator = StaticAllocator>
+        void scatter(
+            std::type_identity_t<std::span<Vec<Size, Type, Allocator>>>
+            vectors,
+            std::span<const size_t> indices) const;
+
+        /**
+         * Returns the vector stored in the given lane.
+         * @param lane the lane.
+         * @return the vector.
+         */
+        Vec<Size, Type> lane(size_t lane) const;
+
+        /**
+         * Stores the given vector in the given lane.
+         * @param lane the lane.
+         * @param vector the vector.
+         */
+        template<typename Allocator>
+        void setLane(size_t lane, const Vec<Size, Type, Allocator>& vector);
+
+        /**
+         * Returns the values of the given component of all lanes.
+         * @param component the component.
+         * @return the values.
+         */
+        Lane& operator[](size_t component);
+
+        /**
+         * Returns the values of the given component of all lanes.
+         * @param component the component.
+         * @return the values.
+         */
+        const Lane& operator[](size_t component) const;
+
+        Lane& x();
+
+        const Lane& x() const;
+
+        Lane& y() requires (Size >= 2);
+
+        const Lane& y() const requires (Size >= 2);
+
+        Lane& z() requires (Size >= 3);
+
+        const Lane& z() const requires (Size >= 3);
+
+        Lane& w() requires (Size >= 4);
+
+        const Lane& w() const requires (Size >= 4);
+
+        VecPack<1, Type, Lanes> squaredLength() const
+            requires HasAdd<Type> && HasMul<Type>;
+
+        VecPack<1, Type, Lanes> length() const
+            requires HasAdd<Type> && HasMul<Type> && HasSquaredRoot<Type>;
+
+        VecPack normalized() const
+            requires HasAdd<Type> && HasMul<Type> && HasDiv<Type> &&
+                     HasSquaredRoot<Type>;
+
+        VecPack<1, Type, Lanes> dot(const VecPack& other) const
+            requires HasAdd<Type> && HasMul<Type>;
+
+        VecPack cross(const VecPack& other) const
+            requires (Size == 3 && HasSub<Type> && HasMul<Type>);
+
+        // REGION OPERATORS
+
+        VecPack operator-() const requires HasSub<Type>;
+
+        VecPack& operator+=(const VecPack& o) requires HasAdd<Type>;
+
+        VecPack& operator-=(const VecPack& o) requires HasSub<Type>;
+
+        VecPack& operator*=(const VecPack& o) requires HasMul<Type>;
+
+        VecPack& operator/=(const VecPack& o) requires HasDiv<Type>;
+
+        VecPack& operator+=(const Type& s) requires HasAdd<Type>;
+
+        VecPack& operator-=(const Type& s) requires HasSub<Type>;
+
+        VecPack& operator*=(const Type& s) requires HasMul<Type>;
+
+        VecPack& operator/=(const Type& s) requires HasDiv<Type>;
+
+        VecPack& operator*=(const VecPack<1, Type, Lanes>& s)
+            requires (Size > 1 && HasMul<Type>);
+
+        VecPack& operator/=(const VecPack<1, Type, Lanes>& s)
+            requires (Size > 1 && HasDiv<Type>);
+
+        VecPack operator+(const VecPack& o) const requires HasAdd<Type>;
+
+        VecPack operator-(const VecPack& o) const requires HasSub<Type>;
+
+        VecPack operator*(const VecPack& o) const requires HasMul<Type>;
+
+        VecPack operator/(const VecPack& o) const requires HasDiv<Type>;
+
+        VecPack operator+(const Type& s) const requires HasAdd<Type>;
+
+        VecPack operator-(const Type& s) const requires HasSub<Type>;
+
+        VecPack operator*(const Type& s) const requires HasMul<Type>;
+
+        VecPack operator/(const Type& s) const requires HasDiv<Type>;
+
+        VecPack operator*(const VecPack<1, Type, Lanes>& s) const
+            requires (Size > 1 && HasMul<Type>);
+
+        VecPack operator/(const VecPack<1, Type, Lanes>& s) const
+            requires (Size > 1 && HasDiv<Type>);
+
+        bool operator==(const VecPack& other) const;
+
+        bool operator!=(const VecPack& other) const;
+
+        // ENDREGION
+    };
+}
+
+#include <rush/vector/vec_pack_impl.h>
+
+#endif //RUSH_VEC_PACK_BASE_H
@@ -0,0 +1,519 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_VEC_PACK_IMPL_H
+#define RUSH_VEC_PACK_IMPL_H
+
+#include <algorithm>
+#include <cmath>
+
+namespace rush {
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes>::VecPack() : data() {
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes>::VecPack(Type fill) {
+        for (auto& lane: data) {
+            lane.fill(fill);
+        }
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    template<typename Allocator>
+    VecPack<Size, Type, Lanes>::VecPack(const Vec<Size, Type, Allocator>& vector) {
+        for (size_t c = 0; c < Size; ++c) {
+            data[c].fill(vector[c]);
+        }
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    template<typename Allocator>
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::gather(
+        std::type_identity_t<std::span<const Vec<Size, Type, Allocator>>>
+        vectors,
+        size_t offset) {
+        VecPack pack;
+        size_t amount = offset < vectors.size()
+                            ? std::min(Lanes, vectors.size() - offset)
+                            : 0;
+        for (size_t l = 0; l < amount; ++l) {
+            const auto& vector = vectors[offset + l];
+            for (size_t c = 0; c < Size; ++c) {
+                pack.data[c][l] = vector[c];
+            }
+        }
+        return pack;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    template<typename Allocator>
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::gather(
+        std::type_identity_t<std::span<const Vec<Size, Type, Allocator>>>
+        vectors,
+        std::span<const size_t> indices) {
+        VecPack pack;
+        size_t amount = std::min(Lanes, indices.size());
+        for (size_t l = 0; l < amount; ++l) {
+            const auto& vector = vectors[indices[l]];
+            for (size_t c = 0; c < Size; ++c) {
+                pack.data[c][l] = vector[c];
+            }
+        }
+        return pack;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    template<typename Allocator>
+    void VecPack<Size, Type, Lanes>::scatter(
+        std::type_identity_t<std::span<Vec<Size, Type, Allocator>>>
+        vectors,
+        size_t offset) const {
+        size_t amount = offset < vectors.size()
+                            ? std::min(Lanes, vectors.size() - offset)
+                            : 0;
+        for (size_t l = 0; l < amount; ++l) {
+            auto& vector = vectors[offset + l];
+            for (size_t c = 0; c < Size; ++c) {
+                vector[c] = data[c][l];
+            }
+        }
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    template<typename Allocator>
+    void VecPack<Size, Type, Lanes>::scatter(
+        std::type_identity_t<std::span<Vec<Size, Type, Allocator>>>
+        vectors,
+        std::span<const size_t> indices) const {
+        size_t amount = std::min(Lanes, indices.size());
+        for (size_t l = 0; l < amount; ++l) {
+            auto& vector = vectors[indices[l]];
+            for (size_t c = 0; c < Size; ++c) {
+                vector[c] = data[c][l];
+            }
+        }
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    Vec<Size, Type> VecPack<Size, Type, Lanes>::lane(size_t lane) const {
+        Vec<Size, Type> result;
+        for (size_t c = 0; c < Size; ++c) {
+            result[c] = data[c][lane];
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    template<typename Allocator>
+    void VecPack<Size, Type, Lanes>::setLane(size_t lane,
+        const Vec<Size, Type, Allocator>& vector) {
+        for (size_t c = 0; c < Size; ++c) {
+            data[c][lane] = vector[c];
+        }
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    typename VecPack<Size, Type, Lanes>::Lane& VecPack<Size, Type, Lanes>::operator[](size_t component) {
+        return data[component];
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    const typename VecPack<Size, Type, Lanes>::Lane&
+    VecPack<Size, Type, Lanes>::operator[](size_t component) const {
+        return data[component];
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    typename VecPack<Size, Type, Lanes>::Lane& VecPack<Size, Type, Lanes>::x() {
+        return data[0];
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    const typename VecPack<Size, Type, Lanes>::Lane& VecPack<Size, Type, Lanes>::x() const {
+        return data[0];
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    typename VecPack<Size, Type, Lanes>::Lane& VecPack<Size, Type, Lanes>::y() requires (Size >= 2) {
+        return data[1];
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    const typename VecPack<Size, Type, Lanes>::Lane& VecPack<Size, Type, Lanes>::y() const requires (Size >= 2) {
+        return data[1];
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    typename VecPack<Size, Type, Lanes>::Lane& VecPack<Size, Type, Lanes>::z() requires (Size >= 3) {
+        return data[2];
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    const typename VecPack<Size, Type, Lanes>::Lane& VecPack<Size, Type, Lanes>::z() const requires (Size >= 3) {
+        return data[2];
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    typename VecPack<Size, Type, Lanes>::Lane& VecPack<Size, Type, Lanes>::w() requires (Size >= 4) {
+        return data[3];
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    const typename VecPack<Size, Type, Lanes>::Lane& VecPack<Size, Type, Lanes>::w() const requires (Size >= 4) {
+        return data[3];
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<1, Type, Lanes> VecPack<Size, Type, Lanes>::squaredLength() const
+        requires HasAdd<Type> && HasMul<Type> {
+        return dot(*this);
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<1, Type, Lanes> VecPack<Size, Type, Lanes>::length() const
+        requires HasAdd<Type> && HasMul<Type> && HasSquaredRoot<Type> {
+        VecPack<1, Type, Lanes> result = squaredLength();
+        for (size_t l = 0; l < Lanes; ++l) {
+            result.data[0][l] = std::sqrt(result.data[0][l]);
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::normalized() const
+        requires HasAdd<Type> && HasMul<Type> && HasDiv<Type> &&
+                 HasSquaredRoot<Type> {
+        VecPack<1, Type, Lanes> length = this->length();
+        VecPack result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = data[c][l] / length.data[0][l];
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<1, Type, Lanes> VecPack<Size, Type, Lanes>::dot(const VecPack& other) const
+        requires HasAdd<Type> && HasMul<Type> {
+        VecPack<1, Type, Lanes> result;
+        for (size_t l = 0; l < Lanes; ++l) {
+            result.data[0][l] = data[0][l] * other.data[0][l];
+        }
+        for (size_t c = 1; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[0][l] += data[c][l] * other.data[c][l];
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::cross(const VecPack& other) const
+        requires (Size == 3 && HasSub<Type> && HasMul<Type>) {
+        VecPack result;
+        for (size_t l = 0; l < Lanes; ++l) {
+            result.data[0][l] = data[1][l] * other.data[2][l] - other.data[1][l] * data[2][l];
+            result.data[1][l] = data[2][l] * other.data[0][l] - other.data[2][l] * data[0][l];
+            result.data[2][l] = data[0][l] * other.data[1][l] - other.data[0][l] * data[1][l];
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::operator-() const requires HasSub<Type> {
+        VecPack result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = -data[c][l];
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes>& VecPack<Size, Type, Lanes>::operator+=(const VecPack& o) requires HasAdd<Type> {
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                data[c][l] += o.data[c][l];
+            }
+        }
+        return *this;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes>& VecPack<Size, Type, Lanes>::operator-=(const VecPack& o) requires HasSub<Type> {
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                data[c][l] -= o.data[c][l];
+            }
+        }
+        return *this;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes>& VecPack<Size, Type, Lanes>::operator*=(const VecPack& o) requires HasMul<Type> {
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                data[c][l] *= o.data[c][l];
+            }
+        }
+        return *this;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes>& VecPack<Size, Type, Lanes>::operator/=(const VecPack& o) requires HasDiv<Type> {
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                data[c][l] /= o.data[c][l];
+            }
+        }
+        return *this;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes>& VecPack<Size, Type, Lanes>::operator+=(const Type& s) requires HasAdd<Type> {
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                data[c][l] += s;
+            }
+        }
+        return *this;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes>& VecPack<Size, Type, Lanes>::operator-=(const Type& s) requires HasSub<Type> {
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                data[c][l] -= s;
+            }
+        }
+        return *this;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes>& VecPack<Size, Type, Lanes>::operator*=(const Type& s) requires HasMul<Type> {
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                data[c][l] *= s;
+            }
+        }
+        return *this;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes>& VecPack<Size, Type, Lanes>::operator/=(const Type& s) requires HasDiv<Type> {
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                data[c][l] /= s;
+            }
+        }
+        return *this;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes>& VecPack<Size, Type, Lanes>::operator*=(const VecPack<1, Type, Lanes>& s)
+        requires (Size > 1 && HasMul<Type>) {
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                data[c][l] *= s.data[0][l];
+            }
+        }
+        return *this;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes>& VecPack<Size, Type, Lanes>::operator/=(const VecPack<1, Type, Lanes>& s)
+        requires (Size > 1 && HasDiv<Type>) {
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                data[c][l] /= s.data[0][l];
+            }
+        }
+        return *this;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::operator+(const VecPack& o) const
+        requires HasAdd<Type> {
+        VecPack result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = data[c][l] + o.data[c][l];
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::operator-(const VecPack& o) const
+        requires HasSub<Type> {
+        VecPack result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = data[c][l] - o.data[c][l];
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::operator*(const VecPack& o) const
+        requires HasMul<Type> {
+        VecPack result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = data[c][l] * o.data[c][l];
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::operator/(const VecPack& o) const
+        requires HasDiv<Type> {
+        VecPack result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = data[c][l] / o.data[c][l];
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::operator+(const Type& s) const
+        requires HasAdd<Type> {
+        VecPack result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = data[c][l] + s;
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::operator-(const Type& s) const
+        requires HasSub<Type> {
+        VecPack result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = data[c][l] - s;
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::operator*(const Type& s) const
+        requires HasMul<Type> {
+        VecPack result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = data[c][l] * s;
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::operator/(const Type& s) const
+        requires HasDiv<Type> {
+        VecPack result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = data[c][l] / s;
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::operator*(const VecPack<1, Type, Lanes>& s) const
+        requires (Size > 1 && HasMul<Type>) {
+        VecPack result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = data[c][l] * s.data[0][l];
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    VecPack<Size, Type, Lanes> VecPack<Size, Type, Lanes>::operator/(const VecPack<1, Type, Lanes>& s) const
+        requires (Size > 1 && HasDiv<Type>) {
+        VecPack result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = data[c][l] / s.data[0][l];
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    bool VecPack<Size, Type, Lanes>::operator==(const VecPack& other) const {
+        for (size_t c = 0; c < Size; ++c) {
+            if (data[c] != other.data[c]) return false;
+        }
+        return true;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+        requires (Size > 0 && Lanes > 0)
+    bool VecPack<Size, Type, Lanes>::operator!=(const VecPack& other) const {
+        return !(*this == other);
+    }
+}
+
+#endif //RUSH_VEC_PACK_IMPL_H
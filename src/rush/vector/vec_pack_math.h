@@ -0,0 +1,242 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_VEC_PACK_MATH_H
+#define RUSH_VEC_PACK_MATH_H
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include <rush/vector/vec_pack_base.h>
+
+// REGION EXTRA OPERATIONS
+
+template<size_t Size, typename Type, size_t Lanes>
+    requires rush::HasAdd<Type>
+rush::VecPack<Size, Type, Lanes> operator+(
+    const Type& s,
+    const rush::VecPack<Size, Type, Lanes>& v) {
+    rush::VecPack<Size, Type, Lanes> result;
+    for (size_t c = 0; c < Size; ++c) {
+        for (size_t l = 0; l < Lanes; ++l) {
+            result.data[c][l] = s + v.data[c][l];
+        }
+    }
+    return result;
+}
+
+template<size_t Size, typename Type, size_t Lanes>
+    requires rush::HasSub<Type>
+rush::VecPack<Size, Type, Lanes> operator-(
+    const Type& s,
+    const rush::VecPack<Size, Type, Lanes>& v) {
+    rush::VecPack<Size, Type, Lanes> result;
+    for (size_t c = 0; c < Size; ++c) {
+        for (size_t l = 0; l < Lanes; ++l) {
+            result.data[c][l] = s - v.data[c][l];
+        }
+    }
+    return result;
+}
+
+template<size_t Size, typename Type, size_t Lanes>
+    requires rush::HasMul<Type>
+rush::VecPack<Size, Type, Lanes> operator*(
+    const Type& s,
+    const rush::VecPack<Size, Type, Lanes>& v) {
+    rush::VecPack<Size, Type, Lanes> result;
+    for (size_t c = 0; c < Size; ++c) {
+        for (size_t l = 0; l < Lanes; ++l) {
+            result.data[c][l] = s * v.data[c][l];
+        }
+    }
+    return result;
+}
+
+template<size_t Size, typename Type, size_t Lanes>
+    requires rush::HasDiv<Type>
+rush::VecPack<Size, Type, Lanes> operator/(
+    const Type& s,
+    const rush::VecPack<Size, Type, Lanes>& v) {
+    rush::VecPack<Size, Type, Lanes> result;
+    for (size_t c = 0; c < Size; ++c) {
+        for (size_t l = 0; l < Lanes; ++l) {
+            result.data[c][l] = s / v.data[c][l];
+        }
+    }
+    return result;
+}
+
+// ENDREGION
+
+namespace rush {
+    namespace detail {
+        template<size_t Size, typename Type, size_t Lanes, typename Function>
+        VecPack<Size, Type, Lanes> mapPack(const VecPack<Size, Type, Lanes>& v, Function function) {
+            VecPack<Size, Type, Lanes> result;
+            for (size_t c = 0; c < Size; ++c) {
+                for (size_t l = 0; l < Lanes; ++l) {
+                    result.data[c][l] = function(v.data[c][l]);
+                }
+            }
+            return result;
+        }
+
+        template<size_t Size, typename Type, size_t Lanes, typename Function>
+        VecPack<Size, Type, Lanes> zipPack(const VecPack<Size, Type, Lanes>& v, const VecPack<Size, Type, Lanes>& w,
+                                           Function function) {
+            VecPack<Size, Type, Lanes> result;
+            for (size_t c = 0; c < Size; ++c) {
+                for (size_t l = 0; l < Lanes; ++l) {
+                    result.data[c][l] = function(v.data[c][l], w.data[c][l]);
+                }
+            }
+            return result;
+        }
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> abs(const VecPack<Size, Type, Lanes>& v) {
+        return detail::mapPack(v, [](const Type& x) { return std::abs(x); });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> sqrt(const VecPack<Size, Type, Lanes>& v) {
+        return detail::mapPack(v, [](const Type& x) { return std::sqrt(x); });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> cos(const VecPack<Size, Type, Lanes>& v) {
+        return detail::mapPack(v, [](const Type& x) { return std::cos(x); });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> sin(const VecPack<Size, Type, Lanes>& v) {
+        return detail::mapPack(v, [](const Type& x) { return std::sin(x); });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> tan(const VecPack<Size, Type, Lanes>& v) {
+        return detail::mapPack(v, [](const Type& x) { return std::tan(x); });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> acos(const VecPack<Size, Type, Lanes>& v) {
+        return detail::mapPack(v, [](const Type& x) { return std::acos(x); });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> asin(const VecPack<Size, Type, Lanes>& v) {
+        return detail::mapPack(v, [](const Type& x) { return std::asin(x); });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> atan(const VecPack<Size, Type, Lanes>& v) {
+        return detail::mapPack(v, [](const Type& x) { return std::atan(x); });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> degrees(const VecPack<Size, Type, Lanes>& v) {
+        constexpr Type RELATION = Type(180) / std::numbers::pi_v<Type>;
+        return detail::mapPack(v, [](const Type& x) { return x * RELATION; });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> radians(const VecPack<Size, Type, Lanes>& v) {
+        constexpr Type RELATION = std::numbers::pi_v<Type> / Type(180);
+        return detail::mapPack(v, [](const Type& x) { return x * RELATION; });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<1, Type, Lanes> min(const VecPack<Size, Type, Lanes>& v) {
+        VecPack<1, Type, Lanes> result;
+        result.data[0] = v.data[0];
+        for (size_t c = 1; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                if (v.data[c][l] < result.data[0][l]) {
+                    result.data[0][l] = v.data[c][l];
+                }
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> min(const VecPack<Size, Type, Lanes>& v, const Type& s) {
+        return detail::mapPack(v, [&s](const Type& x) { return std::min(x, s); });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> min(const VecPack<Size, Type, Lanes>& v, const VecPack<Size, Type, Lanes>& w) {
+        return detail::zipPack(v, w, [](const Type& x, const Type& y) {
+            return std::min(x, y);
+        });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<1, Type, Lanes> max(const VecPack<Size, Type, Lanes>& v) {
+        VecPack<1, Type, Lanes> result;
+        result.data[0] = v.data[0];
+        for (size_t c = 1; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                if (v.data[c][l] > result.data[0][l]) {
+                    result.data[0][l] = v.data[c][l];
+                }
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> max(const VecPack<Size, Type, Lanes>& v, const Type& s) {
+        return detail::mapPack(v, [&s](const Type& x) { return std::max(x, s); });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> max(const VecPack<Size, Type, Lanes>& v, const VecPack<Size, Type, Lanes>& w) {
+        return detail::zipPack(v, w, [](const Type& x, const Type& y) {
+            return std::max(x, y);
+        });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> clamp(const VecPack<Size, Type, Lanes>& v, const Type& min, const Type& max) {
+        return detail::mapPack(v, [&min, &max](const Type& x) {
+            return std::clamp(x, min, max);
+        });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> clamp(const VecPack<Size, Type, Lanes>& v,
+                                     const VecPack<Size, Type, Lanes>& min,
+                                     const VecPack<Size, Type, Lanes>& max) {
+        VecPack<Size, Type, Lanes> result;
+        for (size_t c = 0; c < Size; ++c) {
+            for (size_t l = 0; l < Lanes; ++l) {
+                result.data[c][l] = std::clamp(v.data[c][l], min.data[c][l], max.data[c][l]);
+            }
+        }
+        return result;
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> mix(const VecPack<Size, Type, Lanes>& a, const VecPack<Size, Type, Lanes>& b, const Type& x) {
+        return b * x + a * (Type(1) - x);
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> pow(const VecPack<Size, Type, Lanes>& v, const Type& p) {
+        return detail::mapPack(v, [&p](const Type& x) { return std::pow(x, p); });
+    }
+
+    template<size_t Size, typename Type, size_t Lanes>
+    VecPack<Size, Type, Lanes> pow(const VecPack<Size, Type, Lanes>& v, const VecPack<Size, Type, Lanes>& p) {
+        return detail::zipPack(v, p, [](const Type& x, const Type& y) {
+            return std::pow(x, y);
+        });
+    }
+}
+
+#endif //RUSH_VEC_PACK_MATH_H
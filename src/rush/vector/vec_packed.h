@@ -0,0 +1,635 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_VEC_PACKED_H
+#define RUSH_VEC_PACKED_H
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <rush/cpu.h>
+#include <rush/simd.h>
+#include <rush/vector/vec_base.h>
+
+/**
+ * Compact storage formats for float vectors.
+ * <p>
+ * Packed vectors are meant to be stored and uploaded, not operated:
+ * they are built from a Vec and unpacked back into a Vec.
+ * Bulk conversions over spans are provided by pack() and unpack().
+ */
+namespace rush {
+    namespace detail {
+        /**
+         * Rounds to the nearest integer, ties to even.
+         * Valid for |v| < 2^22.
+         * This matches the conversion of the SIMD kernels.
+         */
+        constexpr int32_t roundToInt(float v) {
+            constexpr float SHIFTER = 12582912.0f; // 1.5 * 2^23
+            return static_cast<int32_t>((v + SHIFTER) - SHIFTER);
+        }
+    }
+
+    // REGION FORMATS
+
+    /**
+     * IEEE 754 half-precision float format.
+     * <p>
+     * Half floats have 11 bits of precision and a maximum value of 65504.
+     * Values are rounded to the nearest representable half (ties to even).
+     * Values over the maximum become infinite and NaN stays NaN.
+     */
+    struct Float16 {
+        using Storage = uint16_t;
+
+        static constexpr Storage encode(float value) {
+            constexpr uint32_t F32_INFINITY = 255 << 23;
+            constexpr uint32_t F16_MAX = (127 + 16) << 23;
+            constexpr uint32_t DENORMAL_MAGIC = ((127 - 15) + (23 - 10) + 1) << 23;
+
+            uint32_t f = std::bit_cast<uint32_t>(value);
+            uint32_t sign = f & 0x80000000u;
+            f ^= sign;
+
+            uint32_t result;
+            if (f >= F16_MAX) {
+                result = f > F32_INFINITY ? 0x7E00 : 0x7C00;
+            } else if (f < (113 << 23)) {
+                // The result is a half denormal or zero.
+                // Let the float adder do the rounding.
+                float shifted = std::bit_cast<float>(f) + std::bit_cast<float>(DENORMAL_MAGIC);
+                result = std::bit_cast<uint32_t>(shifted) - DENORMAL_MAGIC;
+            } else {
+                uint32_t odd = (f >> 13) & 1;
+                f += (static_cast<uint32_t>(15 - 127) << 23) + 0xFFF;
+                f += odd;
+                result = f >> 13;
+            }
+
+            return static_cast<Storage>(result | (sign >> 16));
+        }
+
+        static constexpr float decode(Storage value) {
+            constexpr uint32_t SHIFTED_EXPONENT = 0x7C00 << 13;
+            constexpr float MAGIC = std::bit_cast<float>(uint32_t(113 << 23));
+
+            uint32_t f = (value & 0x7FFFu) << 13;
+            uint32_t exponent = f & SHIFTED_EXPONENT;
+            f += (127 - 15) << 23;
+
+            if (exponent == SHIFTED_EXPONENT) {
+                // Infinite or NaN.
+                f += (128 - 16) << 23;
+            } else if (exponent == 0) {
+                // Zero or denormal.
+                f += 1 << 23;
+                f = std::bit_cast<uint32_t>(std::bit_cast<float>(f) - MAGIC);
+            }
+
+            return std::bit_cast<float>(f | ((value & 0x8000u) << 16));
+        }
+    };
+
+    /**
+     * Normalized integer format.
+     * <p>
+     * Signed storages map [-1, 1] to [-MAX, MAX] (SNORM).
+     * Unsigned storages map [0, 1] to [0, MAX] (UNORM).
+     * Values are clamped to the range and rounded to the
+     * nearest integer (ties to even). NaN is encoded as zero.
+     * <p>
+     * The maximum error of an encoded value is 0.5 / MAX.
+     *
+     * @tparam Type the integer type used to store the values.
+     */
+    template<typename Type> requires std::is_integral_v<Type>
+    struct Normalized {
+        using Storage = Type;
+
+        static constexpr float SCALE = static_cast<float>(std::numeric_limits<Type>::max());
+        static constexpr float MIN = std::is_signed_v<Type> ? -1.0f : 0.0f;
+
+        static constexpr Storage encode(float value) {
+            if (value != value) value = 0.0f;
+            value = value < MIN ? MIN : value;
+            value = value > 1.0f ? 1.0f : value;
+            return static_cast<Storage>(detail::roundToInt(value * SCALE));
+        }
+
+        static constexpr float decode(Storage value) {
+            float result = static_cast<float>(value) * (1.0f / SCALE);
+            // The minimum signed integer is one step below -1.
+            return result < MIN ? MIN : result;
+        }
+    };
+
+    using Snorm8 = Normalized<int8_t>;
+    using Snorm16 = Normalized<int16_t>;
+    using Unorm8 = Normalized<uint8_t>;
+    using Unorm16 = Normalized<uint16_t>;
+
+    // ENDREGION
+
+    // REGION TYPES
+
+    /**
+     * A float vector stored with a compact format.
+     * <p>
+     * The components are stored contiguously, without padding.
+     * A PackedVec<3, Float16> uses 6 bytes instead of 12.
+     *
+     * @tparam Size the amount of components.
+     * @tparam Format the format of each component (Float16 or Normalized).
+     */
+    template<size_t Size, typename Format> requires (Size > 0)
+    struct PackedVec {
+        using Storage = typename Format::Storage;
+        using Unpacked = Vec<Size, float>;
+
+        static constexpr size_t Components = Size;
+
+        std::array<Storage, Size> data;
+
+        constexpr PackedVec() : data() {}
+
+        template<typename Allocator>
+        constexpr explicit PackedVec(const Vec<Size, float, Allocator>& vector) : data() {
+            for (size_t i = 0; i < Size; ++i) {
+                data[i] = Format::encode(vector[i]);
+            }
+        }
+
+        [[nodiscard]] constexpr Unpacked unpack() const {
+            Unpacked result;
+            for (size_t i = 0; i < Size; ++i) {
+                result[i] = Format::decode(data[i]);
+            }
+            return result;
+        }
+
+        constexpr Storage& operator[](size_t index) {
+            return data[index];
+        }
+
+        constexpr const Storage& operator[](size_t index) const {
+            return data[index];
+        }
+
+        constexpr bool operator==(const PackedVec& other) const = default;
+    };
+
+    /**
+     * A four-component float vector stored in 32 bits.
+     * <p>
+     * The x, y and z components use 10 bits each and w uses 2 bits.
+     * x is stored in the least significant bits and w in the most
+     * significant ones, matching the A2B10G10R10 formats of
+     * Vulkan and the UNSIGNED_INT_2_10_10_10_REV type of OpenGL.
+     * <p>
+     * Components are normalized: see Normalized for the rounding rules.
+     *
+     * @tparam Signed whether the components are SNORM or UNORM.
+     */
+    template<bool Signed>
+    struct Packed1010102 {
+        using Unpacked = Vec<4, float>;
+
+        uint32_t value;
+
+        constexpr Packed1010102() : value(0) {}
+
+        template<typename Allocator>
+        constexpr explicit Packed1010102(const Vec<4, float, Allocator>& vector)
+            : value(encode<10>(vector[0])
+                    | encode<10>(vector[1]) << 10
+                    | encode<10>(vector[2]) << 20
+                    | encode<2>(vector[3]) << 30) {}
+
+        [[nodiscard]] constexpr Unpacked unpack() const {
+            return Unpacked(
+                decode<10>(value),
+                decode<10>(value >> 10),
+                decode<10>(value >> 20),
+                decode<2>(value >> 30)
+            );
+        }
+
+        constexpr bool operator==(const Packed1010102& other) const = default;
+
+    private:
+        template<uint32_t Bits>
+        static constexpr float scale() {
+            return static_cast<float>(Signed ? (1u << (Bits - 1)) - 1 : (1u << Bits) - 1);
+        }
+
+        template<uint32_t Bits>
+        static constexpr uint32_t encode(float v) {
+            constexpr float MIN = Signed ? -1.0f : 0.0f;
+            if (v != v) v = 0.0f;
+            v = v < MIN ? MIN : v;
+            v = v > 1.0f ? 1.0f : v;
+            auto i = static_cast<uint32_t>(detail::roundToInt(v * scale<Bits>()));
+            return i & ((1u << Bits) - 1);
+        }
+
+        template<uint32_t Bits>
+        static constexpr float decode(uint32_t bits) {
+            bits &= (1u << Bits) - 1;
+            if constexpr (Signed) {
+                // Sign-extends the field.
+                int32_t i = static_cast<int32_t>(bits << (32 - Bits)) >> (32 - Bits);
+                float result = static_cast<float>(i) * (1.0f / scale<Bits>());
+                return result < -1.0f ? -1.0f : result;
+            } else {
+                return static_cast<float>(bits) * (1.0f / scale<Bits>());
+            }
+        }
+    };
+
+    using Unorm1010102 = Packed1010102<false>;
+    using Snorm1010102 = Packed1010102<true>;
+
+    /**
+     * A unit vector stored using the octahedral encoding.
+     * <p>
+     * The vector is projected onto the octahedron |x| + |y| + |z| = 1,
+     * whose lower half is folded over the upper one. The resulting
+     * two-dimensional point is stored as two SNORM values.
+     * This distributes the precision evenly over the sphere.
+     * <p>
+     * With 16-bit components (4 bytes) the maximum angular error is
+     * below 0.005 degrees. With 8-bit components (2 bytes) it is
+     * below 1 degree.
+     * <p>
+     * The encoded vector must be normalized. Unpacked vectors are
+     * normalized. A zero vector is encoded as (0, 0, 1).
+     *
+     * @tparam Type the signed integer type used to store each component.
+     */
+    template<typename Type> requires std::is_signed_v<Type> && std::is_integral_v<Type>
+    struct OctahedralNormal {
+        using Storage = Type;
+        using Unpacked = Vec<3, float>;
+        using Format = Normalized<Type>;
+
+        std::array<Storage, 2> data;
+
+        constexpr OctahedralNormal() : data() {}
+
+        template<typename Allocator>
+        explicit OctahedralNormal(const Vec<3, float, Allocator>& normal) : data() {
+            float sum = std::abs(normal[0]) + std::abs(normal[1]) + std::abs(normal[2]);
+            float x = 0.0f;
+            float y = 0.0f;
+            if (sum > 0.0f) {
+                x = normal[0] / sum;
+                y = normal[1] / sum;
+                if (normal[2] < 0.0f) {
+                    float foldedX = (1.0f - std::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+                    float foldedY = (1.0f - std::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+                    x = foldedX;
+                    y = foldedY;
+                }
+            }
+            data[0] = Format::encode(x);
+            data[1] = Format::encode(y);
+        }
+
+        [[nodiscard]] Unpacked unpack() const {
+            float x = Format::decode(data[0]);
+            float y = Format::decode(data[1]);
+            float z = 1.0f - std::abs(x) - std::abs(y);
+            float t = z < 0.0f ? -z : 0.0f;
+            x += x >= 0.0f ? -t : t;
+            y += y >= 0.0f ? -t : t;
+            float inverse = 1.0f / std::sqrt(x * x + y * y + z * z);
+            return Unpacked(x * inverse, y * inverse, z * inverse);
+        }
+
+        constexpr bool operator==(const OctahedralNormal& other) const = default;
+    };
+
+    using OctNormal8 = OctahedralNormal<int8_t>;
+    using OctNormal16 = OctahedralNormal<int16_t>;
+
+    // ENDREGION
+
+    // REGION KERNELS
+
+    namespace detail {
+        template<typename T>
+        struct IsPackedVec : std::false_type {};
+
+        template<size_t Size, typename F>
+        struct IsPackedVec<PackedVec<Size, F>> : std::true_type {
+            using Format = F;
+        };
+
+        template<typename Format>
+        inline void encodeGeneric(const float* in, typename Format::Storage* out, size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = Format::encode(in[i]);
+            }
+        }
+
+        template<typename Format>
+        inline void decodeGeneric(const typename Format::Storage* in, float* out, size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = Format::decode(in[i]);
+            }
+        }
+
+#ifdef RUSH_DISPATCH
+
+        template<typename Format>
+        constexpr bool IsNormalized = !std::is_same_v<Format, Float16>;
+
+        /**
+         * Saturates four 32-bit integers to the storage type
+         * and stores them.
+         */
+        template<typename Storage>
+        RUSH_TARGET_SSE4 inline void storeNormalizedSSE4(Storage* out, __m128i q) {
+            if constexpr (std::is_same_v<Storage, int16_t>) {
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packs_epi32(q, q));
+            } else if constexpr (std::is_same_v<Storage, uint16_t>) {
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi32(q, q));
+            } else {
+                __m128i q16 = _mm_packs_epi32(q, q);
+                __m128i q8 = std::is_signed_v<Storage>
+                                 ? _mm_packs_epi16(q16, q16)
+                                 : _mm_packus_epi16(q16, q16);
+                int32_t bytes = _mm_cvtsi128_si32(q8);
+                std::memcpy(out, &bytes, sizeof(int32_t));
+            }
+        }
+
+        /**
+         * Loads four values of the storage type as 32-bit integers.
+         */
+        template<typename Storage>
+        RUSH_TARGET_SSE4 inline __m128i loadNormalizedSSE4(const Storage* in) {
+            if constexpr (sizeof(Storage) == 2) {
+                __m128i q = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in));
+                return std::is_signed_v<Storage> ? _mm_cvtepi16_epi32(q) : _mm_cvtepu16_epi32(q);
+            } else {
+                int32_t bytes;
+                std::memcpy(&bytes, in, sizeof(int32_t));
+                __m128i q = _mm_cvtsi32_si128(bytes);
+                return std::is_signed_v<Storage> ? _mm_cvtepi8_epi32(q) : _mm_cvtepu8_epi32(q);
+            }
+        }
+
+        template<typename Format>
+        RUSH_TARGET_SSE4 inline void encodeSSE4(const float* in,
+                                                typename Format::Storage* out,
+                                                size_t n) {
+            const __m128 min = _mm_set1_ps(Format::MIN);
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 scale = _mm_set1_ps(Format::SCALE);
+
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128 v = _mm_loadu_ps(in + i);
+                v = _mm_and_ps(v, _mm_cmpord_ps(v, v));
+                v = _mm_min_ps(_mm_max_ps(v, min), one);
+                storeNormalizedSSE4(out + i, _mm_cvtps_epi32(_mm_mul_ps(v, scale)));
+            }
+            encodeGeneric<Format>(in + i, out + i, n - i);
+        }
+
+        template<typename Format>
+        RUSH_TARGET_SSE4 inline void decodeSSE4(const typename Format::Storage* in,
+                                                float* out,
+                                                size_t n) {
+            const __m128 min = _mm_set1_ps(Format::MIN);
+            const __m128 inverse = _mm_set1_ps(1.0f / Format::SCALE);
+
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m128 v = _mm_mul_ps(_mm_cvtepi32_ps(loadNormalizedSSE4(in + i)), inverse);
+                _mm_storeu_ps(out + i, _mm_max_ps(v, min));
+            }
+            decodeGeneric<Format>(in + i, out + i, n - i);
+        }
+
+        /**
+         * Half floats are converted using F16C.
+         * Normalized formats convert eight values per iteration.
+         */
+        template<typename Format>
+        RUSH_TARGET_AVX2 inline void encodeAVX2(const float* in,
+                                                typename Format::Storage* out,
+                                                size_t n) {
+            using Storage = typename Format::Storage;
+
+            size_t i = 0;
+            if constexpr (std::is_same_v<Format, Float16>) {
+                for (; i + 8 <= n; i += 8) {
+                    __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), h);
+                }
+                encodeGeneric<Format>(in + i, out + i, n - i);
+            } else {
+                const __m256 min = _mm256_set1_ps(Format::MIN);
+                const __m256 one = _mm256_set1_ps(1.0f);
+                const __m256 scale = _mm256_set1_ps(Format::SCALE);
+
+                for (; i + 8 <= n; i += 8) {
+                    __m256 v = _mm256_loadu_ps(in + i);
+                    v = _mm256_and_ps(v, _mm256_cmp_ps(v, v, _CMP_ORD_Q));
+                    v = _mm256_min_ps(_mm256_max_ps(v, min), one);
+                    __m256i q = _mm256_cvtps_epi32(_mm256_mul_ps(v, scale));
+                    __m128i low = _mm256_castsi256_si128(q);
+                    __m128i high = _mm256_extracti128_si256(q, 1);
+
+                    if constexpr (sizeof(Storage) == 2) {
+                        __m128i q16 = std::is_signed_v<Storage>
+                                          ? _mm_packs_epi32(low, high)
+                                          : _mm_packus_epi32(low, high);
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), q16);
+                    } else {
+                        __m128i q16 = _mm_packs_epi32(low, high);
+                        __m128i q8 = std::is_signed_v<Storage>
+                                         ? _mm_packs_epi16(q16, q16)
+                                         : _mm_packus_epi16(q16, q16);
+                        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), q8);
+                    }
+                }
+                encodeSSE4<Format>(in + i, out + i, n - i);
+            }
+        }
+
+        template<typename Format>
+        RUSH_TARGET_AVX2 inline void decodeAVX2(const typename Format::Storage* in,
+                                                float* out,
+                                                size_t n) {
+            using Storage = typename Format::Storage;
+
+            size_t i = 0;
+            if constexpr (std::is_same_v<Format, Float16>) {
+                for (; i + 8 <= n; i += 8) {
+                    __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                    _mm256_storeu_ps(out + i, _mm256_cvtph_ps(h));
+                }
+                decodeGeneric<Format>(in + i, out + i, n - i);
+            } else {
+                const __m256 min = _mm256_set1_ps(Format::MIN);
+                const __m256 inverse = _mm256_set1_ps(1.0f / Format::SCALE);
+
+                for (; i + 8 <= n; i += 8) {
+                    __m256i q;
+                    if constexpr (sizeof(Storage) == 2) {
+                        __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                        q = std::is_signed_v<Storage> ? _mm256_cvtepi16_epi32(raw) : _mm256_cvtepu16_epi32(raw);
+                    } else {
+                        __m128i raw = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i));
+                        q = std::is_signed_v<Storage> ? _mm256_cvtepi8_epi32(raw) : _mm256_cvtepu8_epi32(raw);
+                    }
+                    __m256 v = _mm256_mul_ps(_mm256_cvtepi32_ps(q), inverse);
+                    _mm256_storeu_ps(out + i, _mm256_max_ps(v, min));
+                }
+                decodeSSE4<Format>(in + i, out + i, n - i);
+            }
+        }
+
+#endif
+
+        template<typename Format>
+        void encode(const float* in, typename Format::Storage* out, size_t n) {
+#ifdef RUSH_DISPATCH
+            switch (cpu::instructionSet()) {
+                case InstructionSet::AVX512:
+                case InstructionSet::AVX2:
+                    encodeAVX2<Format>(in, out, n);
+                    return;
+                case InstructionSet::SSE4:
+                    // Half floats need F16C.
+                    if constexpr (IsNormalized<Format>) {
+                        encodeSSE4<Format>(in, out, n);
+                        return;
+                    }
+                    break;
+                default:
+                    break;
+            }
+#endif
+            encodeGeneric<Format>(in, out, n);
+        }
+
+        template<typename Format>
+        void decode(const typename Format::Storage* in, float* out, size_t n) {
+#ifdef RUSH_DISPATCH
+            switch (cpu::instructionSet()) {
+                case InstructionSet::AVX512:
+                case InstructionSet::AVX2:
+                    decodeAVX2<Format>(in, out, n);
+                    return;
+                case InstructionSet::SSE4:
+                    if constexpr (IsNormalized<Format>) {
+                        decodeSSE4<Format>(in, out, n);
+                        return;
+                    }
+                    break;
+                default:
+                    break;
+            }
+#endif
+            decodeGeneric<Format>(in, out, n);
+        }
+    }
+
+    // ENDREGION
+
+    // REGION BULK
+
+    /**
+     * Packs all the given vectors.
+     * <p>
+     * PackedVec conversions treat the vectors as a flat array of floats
+     * and use the kernel of the instruction set returned by
+     * cpu::instructionSet(): F16C for half floats and SSE4.1 or AVX2
+     * for normalized formats. All kernels produce the same values
+     * as the scalar conversion, except for the payload of NaNs.
+     * Packed1010102 and OctahedralNormal are converted one by one.
+     * <p>
+     * The packed type must be given explicitly:
+     * <pre>
+     * rush::pack<rush::Vec3h>(normals, packedNormals);
+     * </pre>
+     *
+     * @tparam Packed the packed type.
+     * @param vectors the vectors to pack.
+     * @param result the span where the packed vectors are written.
+     * It must have the same size as vectors.
+     */
+    template<typename Packed>
+    void pack(std::type_identity_t<std::span<const typename Packed::Unpacked>> vectors,
+              std::type_identity_t<std::span<Packed>> result) {
+#ifndef NDEBUG
+        if (vectors.size() != result.size()) {
+            throw std::runtime_error("The input and output spans have different sizes.");
+        }
+#endif
+        if (vectors.empty()) return;
+        if constexpr (detail::IsPackedVec<Packed>::value) {
+            using Unpacked = typename Packed::Unpacked;
+            static_assert(sizeof(Unpacked) == sizeof(float) * Packed::Components);
+            static_assert(sizeof(Packed) == sizeof(typename Packed::Storage) * Packed::Components);
+            detail::encode<typename detail::IsPackedVec<Packed>::Format>(
+                vectors.data()->toPointer(),
+                result.data()->data.data(),
+                vectors.size() * Packed::Components);
+        } else {
+            for (size_t i = 0; i < vectors.size(); ++i) {
+                result[i] = Packed(vectors[i]);
+            }
+        }
+    }
+
+    /**
+     * Unpacks all the given packed vectors.
+     * See pack() for more information about the kernels.
+     *
+     * @tparam Packed the packed type.
+     * @param packed the vectors to unpack.
+     * @param result the span where the unpacked vectors are written.
+     * It must have the same size as packed.
+     */
+    template<typename Packed>
+    void unpack(std::type_identity_t<std::span<const Packed>> packed,
+                std::type_identity_t<std::span<typename Packed::Unpacked>> result) {
+#ifndef NDEBUG
+        if (packed.size() != result.size()) {
+            throw std::runtime_error("The input and output spans have different sizes.");
+        }
+#endif
+        if (packed.empty()) return;
+        if constexpr (detail::IsPackedVec<Packed>::value) {
+            using Unpacked = typename Packed::Unpacked;
+            static_assert(sizeof(Unpacked) == sizeof(float) * Packed::Components);
+            static_assert(sizeof(Packed) == sizeof(typename Packed::Storage) * Packed::Components);
+            detail::decode<typename detail::IsPackedVec<Packed>::Format>(
+                packed.data()->data.data(),
+                result.data()->toPointer(),
+                packed.size() * Packed::Components);
+        } else {
+            for (size_t i = 0; i < packed.size(); ++i) {
+                result[i] = packed[i].unpack();
+            }
+        }
+    }
+
+    // ENDREGION
+}
+
+#endif //RUSH_VEC_PACKED_H
@@ -0,0 +1,351 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_VEC_REDUCE_H
+#define RUSH_VEC_REDUCE_H
+
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <rush/cpu.h>
+#include <rush/parallel.h>
+#include <rush/simd.h>
+#include <rush/vector/vec_base.h>
+#include <rush/vector/vec_math.h>
+
+namespace rush {
+    namespace detail {
+        enum class Reduction {
+            Min,
+            Max,
+            Bounds,
+            Sum
+        };
+
+        template<typename T>
+        struct VecRangeTraits : std::false_type {};
+
+        template<size_t S, typename T>
+        struct VecRangeTraits<Vec<S, T, StaticAllocator>> : std::true_type {
+            static constexpr size_t Size = S;
+            using Type = T;
+        };
+
+        /**
+         * A contiguous range of vectors using the StaticAllocator.
+         * The components of these ranges can be read as a flat array.
+         */
+        template<typename Range>
+        concept VecRange = std::ranges::contiguous_range<Range> &&
+                           std::ranges::sized_range<Range> &&
+                           VecRangeTraits<std::remove_cv_t<
+                               std::ranges::range_value_t<Range>>>::value;
+
+        template<typename Range>
+        using VecRangeValue = std::remove_cv_t<std::ranges::range_value_t<Range>>;
+
+        /**
+         * Reduces the flat array of n components into the Size accumulators
+         * first (and second, when R is Bounds).
+         */
+        template<Reduction R, size_t Size, typename Type>
+        inline void reduceGeneric(const Type* data, size_t n, Type* first, Type* second) {
+            for (size_t i = 0; i < n; i += Size) {
+                for (size_t c = 0; c < Size; ++c) {
+                    Type v = data[i + c];
+                    if constexpr (R == Reduction::Min || R == Reduction::Bounds) {
+                        first[c] = v < first[c] ? v : first[c];
+                    }
+                    if constexpr (R == Reduction::Max) {
+                        first[c] = v > first[c] ? v : first[c];
+                    }
+                    if constexpr (R == Reduction::Bounds) {
+                        second[c] = v > second[c] ? v : second[c];
+                    }
+                    if constexpr (R == Reduction::Sum) {
+                        first[c] += v;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Folds the lanes of a period of Period components into the accumulators.
+         */
+        template<Reduction R, size_t Size, size_t Period, typename Type>
+        inline void reduceLanes(const Type* a, const Type* b, Type* first, Type* second) {
+            for (size_t i = 0; i < Period; ++i) {
+                size_t c = i % Size;
+                if constexpr (R == Reduction::Min || R == Reduction::Bounds) {
+                    first[c] = a[i] < first[c] ? a[i] : first[c];
+                }
+                if constexpr (R == Reduction::Max) {
+                    first[c] = a[i] > first[c] ? a[i] : first[c];
+                }
+                if constexpr (R == Reduction::Bounds) {
+                    second[c] = b[i] > second[c] ? b[i] : second[c];
+                }
+                if constexpr (R == Reduction::Sum) {
+                    first[c] += a[i];
+                }
+            }
+        }
+
+#ifdef RUSH_DISPATCH
+
+        // The kernels read the vectors as a flat array of components.
+        // A period of lcm(Size, Lanes) components fills a whole number
+        // of registers, and every lane of a register always holds
+        // the same component. The lanes are folded at the end.
+
+        template<Reduction R, size_t Size, typename Type>
+        RUSH_TARGET_SSE4 inline void reduceSSE4(const Type* data, size_t n,
+                                                Type* first, Type* second) {
+            using O = simd::SSE4<Type>;
+            constexpr size_t Period = std::lcm(Size, O::Lanes);
+            constexpr size_t Registers = Period / O::Lanes;
+
+            Type a[Period], b[Period];
+            for (size_t i = 0; i < Period; ++i) {
+                a[i] = R == Reduction::Sum ? Type(0) : first[i % Size];
+                b[i] = R == Reduction::Bounds ? second[i % Size] : Type(0);
+            }
+
+            typename O::Reg ra[Registers], rb[Registers];
+            for (size_t r = 0; r < Registers; ++r) {
+                ra[r] = O::load(a + r * O::Lanes);
+                rb[r] = O::load(b + r * O::Lanes);
+            }
+
+            size_t i = 0;
+            for (; i + Period <= n; i += Period) {
+                for (size_t r = 0; r < Registers; ++r) {
+                    auto v = O::load(data + i + r * O::Lanes);
+                    if constexpr (R == Reduction::Min || R == Reduction::Bounds) ra[r] = O::min(ra[r], v);
+                    if constexpr (R == Reduction::Max) ra[r] = O::max(ra[r], v);
+                    if constexpr (R == Reduction::Bounds) rb[r] = O::max(rb[r], v);
+                    if constexpr (R == Reduction::Sum) ra[r] = O::add(ra[r], v);
+                }
+            }
+
+            for (size_t r = 0; r < Registers; ++r) {
+                O::store(a + r * O::Lanes, ra[r]);
+                O::store(b + r * O::Lanes, rb[r]);
+            }
+            reduceLanes<R, Size, Period>(a, b, first, second);
+            reduceGeneric<R, Size>(data + i, n - i, first, second);
+        }
+
+        template<Reduction R, size_t Size, typename Type>
+        RUSH_TARGET_AVX2 inline void reduceAVX2(const Type* data, size_t n,
+                                                Type* first, Type* second) {
+            using O = simd::AVX2<Type>;
+            constexpr size_t Period = std::lcm(Size, O::Lanes);
+            constexpr size_t Registers = Period / O::Lanes;
+
+            Type a[Period], b[Period];
+            for (size_t i = 0; i < Period; ++i) {
+                a[i] = R == Reduction::Sum ? Type(0) : first[i % Size];
+                b[i] = R == Reduction::Bounds ? second[i % Size] : Type(0);
+            }
+
+            typename O::Reg ra[Registers], rb[Registers];
+            for (size_t r = 0; r < Registers; ++r) {
+                ra[r] = O::load(a + r * O::Lanes);
+                rb[r] = O::load(b + r * O::Lanes);
+            }
+
+            size_t i = 0;
+            for (; i + Period <= n; i += Period) {
+                for (size_t r = 0; r < Registers; ++r) {
+                    auto v = O::load(data + i + r * O::Lanes);
+                    if constexpr (R == Reduction::Min || R == Reduction::Bounds) ra[r] = O::min(ra[r], v);
+                    if constexpr (R == Reduction::Max) ra[r] = O::max(ra[r], v);
+                    if constexpr (R == Reduction::Bounds) rb[r] = O::max(rb[r], v);
+                    if constexpr (R == Reduction::Sum) ra[r] = O::add(ra[r], v);
+                }
+            }
+
+            for (size_t r = 0; r < Registers; ++r) {
+                O::store(a + r * O::Lanes, ra[r]);
+                O::store(b + r * O::Lanes, rb[r]);
+            }
+            reduceLanes<R, Size, Period>(a, b, first, second);
+            reduceGeneric<R, Size>(data + i, n - i, first, second);
+        }
+
+#endif
+
+        template<Reduction R, size_t Size, typename Type>
+        void reduce(const Type* data, size_t n, Type* first, Type* second) {
+#ifdef RUSH_DISPATCH
+            // Larger vectors would need more registers than available.
+            if constexpr (simd::HasBulkKernel<Type> && Size <= 8) {
+                switch (cpu::instructionSet()) {
+                    case InstructionSet::AVX512:
+                    case InstructionSet::AVX2:
+                        reduceAVX2<R, Size>(data, n, first, second);
+                        return;
+                    case InstructionSet::SSE4:
+                        reduceSSE4<R, Size>(data, n, first, second);
+                        return;
+                    default:
+                        break;
+                }
+            }
+#endif
+            reduceGeneric<R, Size>(data, n, first, second);
+        }
+
+        template<Reduction R, typename Range>
+        std::pair<VecRangeValue<Range>, VecRangeValue<Range>>
+        reduceRange(const Range& vectors, size_t threads) {
+            using V = VecRangeValue<Range>;
+            using Result = std::pair<V, V>;
+            using Type = typename VecRangeTraits<V>::Type;
+            constexpr size_t Size = VecRangeTraits<V>::Size;
+
+            size_t count = std::ranges::size(vectors);
+            if (count == 0) {
+#ifndef NDEBUG
+                if constexpr (R != Reduction::Sum) {
+                    throw std::runtime_error("Cannot reduce an empty range.");
+                }
+#endif
+                return Result(V(Type(0)), V(Type(0)));
+            }
+
+            const V* begin = std::ranges::data(vectors);
+            const Type* data = begin->toPointer();
+
+            return parallelReduce(count, threads, [&](size_t from, size_t to) {
+                // Min and max are idempotent: every chunk
+                // can start from the first vector.
+                Result result = R == Reduction::Sum
+                                    ? Result(V(Type(0)), V(Type(0)))
+                                    : Result(begin[0], begin[0]);
+                reduce<R, Size>(data + from * Size, (to - from) * Size,
+                                result.first.toPointer(), result.second.toPointer());
+                return result;
+            }, [](const Result& l, const Result& r) {
+                if constexpr (R == Reduction::Min) return Result(rush::min(l.first, r.first), l.second);
+                if constexpr (R == Reduction::Max) return Result(rush::max(l.first, r.first), l.second);
+                if constexpr (R == Reduction::Bounds) {
+                    return Result(rush::min(l.first, r.first), rush::max(l.second, r.second));
+                }
+                if constexpr (R == Reduction::Sum) return Result(l.first + r.first, l.second);
+            });
+        }
+    }
+
+    // REGION RANGE REDUCTIONS
+
+    /**
+     * Returns the componentwise minimum of the given vectors.
+     * <p>
+     * The vectors are read as a flat array of components using the
+     * kernel of the instruction set returned by cpu::instructionSet().
+     * The reduction may be split across several threads.
+     * See parallelFor() for more information.
+     * <p>
+     * The range must not be empty.
+     * NaN components produce unspecified results.
+     *
+     * @param vectors a contiguous range of vectors (std::vector, std::span...).
+     * @param threads the maximum amount of threads to use.
+     * 0 uses all the hardware threads.
+     * @return the minimum of each component.
+     */
+    template<detail::VecRange Range>
+    detail::VecRangeValue<Range> min(const Range& vectors, size_t threads = 1) {
+        return detail::reduceRange<detail::Reduction::Min>(vectors, threads).first;
+    }
+
+    /**
+     * Returns the componentwise maximum of the given vectors.
+     * See min(const Range&, size_t) for more information.
+     *
+     * @param vectors a contiguous range of vectors.
+     * @param threads the maximum amount of threads to use.
+     * @return the maximum of each component.
+     */
+    template<detail::VecRange Range>
+    detail::VecRangeValue<Range> max(const Range& vectors, size_t threads = 1) {
+        return detail::reduceRange<detail::Reduction::Max>(vectors, threads).first;
+    }
+
+    /**
+     * Returns the componentwise minimum and maximum of the given vectors
+     * reading them only once.
+     * See min(const Range&, size_t) for more information.
+     *
+     * @param vectors a contiguous range of vectors.
+     * @param threads the maximum amount of threads to use.
+     * @return the minimum and the maximum of each component.
+     */
+    template<detail::VecRange Range>
+    std::pair<detail::VecRangeValue<Range>, detail::VecRangeValue<Range>>
+    minMax(const Range& vectors, size_t threads = 1) {
+        return detail::reduceRange<detail::Reduction::Bounds>(vectors, threads);
+    }
+
+    /**
+     * Returns the sum of the given vectors.
+     * <p>
+     * Each lane of the SIMD registers holds a partial sum,
+     * so the result may differ slightly between instruction sets.
+     * The sum of an empty range is zero.
+     * See min(const Range&, size_t) for more information.
+     *
+     * @param vectors a contiguous range of vectors.
+     * @param threads the maximum amount of threads to use.
+     * @return the sum.
+     */
+    template<detail::VecRange Range>
+    detail::VecRangeValue<Range> sum(const Range& vectors, size_t threads = 1) {
+        return detail::reduceRange<detail::Reduction::Sum>(vectors, threads).first;
+    }
+
+    /**
+     * Returns the mean of the given vectors.
+     * See sum(const Range&, size_t) for more information.
+     * <p>
+     * The range must not be empty.
+     *
+     * @param vectors a contiguous range of vectors.
+     * @param threads the maximum amount of threads to use.
+     * @return the mean.
+     */
+    template<detail::VecRange Range>
+    detail::VecRangeValue<Range> mean(const Range& vectors, size_t threads = 1) {
+        using Type = typename detail::VecRangeTraits<detail::VecRangeValue<Range>>::Type;
+#ifndef NDEBUG
+        if (std::ranges::empty(vectors)) {
+            throw std::runtime_error("Cannot compute the mean of an empty range.");
+        }
+#endif
+        return sum(vectors, threads) / static_cast<Type>(std::ranges::size(vectors));
+    }
+
+    /**
+     * Returns the centroid of the given points: the mean of their positions.
+     * See mean(const Range&, size_t) for more information.
+     *
+     * @param points a contiguous range of points.
+     * @param threads the maximum amount of threads to use.
+     * @return the centroid.
+     */
+    template<detail::VecRange Range>
+    detail::VecRangeValue<Range> centroid(const Range& points, size_t threads = 1) {
+        return mean(points, threads);
+    }
+
+    // ENDREGION
+}
+
+#endif //RUSH_VEC_REDUCE_H
@@ -16,38 +16,38 @@ namespace rush {
     struct VecRef {
         Type* references[Size];
 
-        VecRef() {}
+        constexpr VecRef() {}
 
         VecRef(const VecRef& other) = default;
 
         template<typename... T>
             requires(sizeof...(T) > 0)
-        explicit VecRef(T... list) : references{list...} {}
+        constexpr explicit VecRef(T... list) : references{list...} {}
 
         template<typename Allocator>
-        explicit VecRef(Vec<Size, Type, Allocator>& vec) {
+        constexpr explicit VecRef(Vec<Size, Type, Allocator>& vec) {
             for(size_t i = 0; i < Size; ++i) {
                 references[i] = &vec[i];
             }
         }
 
         template<typename Allocator = StaticAllocator>
-        operator Vec<Size, Type, Allocator>() const {
+        constexpr operator Vec<Size, Type, Allocator>() const {
             return toVec<Allocator>();
         }
 
         template<typename Allocator = StaticAllocator>
-        Vec<Size, Type, Allocator> operator*() const {
+        constexpr Vec<Size, Type, Allocator> operator*() const {
             return Vec<Size, Type, Allocator>(*this);
         }
 
         template<typename Allocator = StaticAllocator>
-        Vec<Size, Type, Allocator> toVec() const {
+        constexpr Vec<Size, Type, Allocator> toVec() const {
             return Vec<Size, Type, Allocator>(*this);
         }
 
         template<typename Allocator>
-        VecRef& operator=(Vec<Size, Type, Allocator> vec) {
+        constexpr VecRef& operator=(Vec<Size, Type, Allocator> vec) {
             // Ask for a value, not a reference!
             // This avoids aliasing.
             for(int i = 0; i < Size; ++i) {
@@ -56,7 +56,7 @@ namespace rush {
             return *this;
         }
 
-        VecRef& operator=(const VecRef<Size, Type>& ref) {
+        constexpr VecRef& operator=(const VecRef<Size, Type>& ref) {
             if(&ref == this) return *this;
 
             // We must transform the reference to avoid aliasing.
@@ -68,71 +68,71 @@ namespace rush {
             return *this;
         }
 
-        Type& operator[](size_t index) {
+        constexpr Type& operator[](size_t index) {
             return *references[index];
         }
 
-        const Type& operator[](size_t index) const {
+        constexpr const Type& operator[](size_t index) const {
             return *references[index];
         }
 
         template<typename AllA, typename AllB = AllA>
-        Vec<Size, Type, AllB>
+        constexpr Vec<Size, Type, AllB>
         operator+(const Vec<Size, Type, AllA>& other) {
             return toVec<AllB>() + other;
         }
 
         template<typename Allocator = StaticAllocator>
-        Vec<Size, Type, Allocator> operator+(const VecRef<Size, Type>& other) {
+        constexpr Vec<Size, Type, Allocator> operator+(const VecRef<Size, Type>& other) {
             return **this + *other;
         }
 
         template<typename AllA, typename AllB = AllA>
-        Vec<Size, Type, AllB>
+        constexpr Vec<Size, Type, AllB>
         operator-(const Vec<Size, Type, AllA>& other) {
             return toVec<AllB>() - other;
         }
 
         template<typename Allocator = StaticAllocator>
-        Vec<Size, Type, Allocator> operator-(const VecRef<Size, Type>& other) {
+        constexpr Vec<Size, Type, Allocator> operator-(const VecRef<Size, Type>& other) {
             return **this - *other;
         }
 
         template<typename AllA, typename AllB = AllA>
-        Vec<Size, Type, AllB>
+        constexpr Vec<Size, Type, AllB>
         operator*(const Vec<Size, Type, AllA>& other) {
             return toVec<AllB>() * other;
         }
 
         template<typename Allocator = StaticAllocator>
-        Vec<Size, Type, Allocator> operator*(const VecRef<Size, Type>& other) {
+        constexpr Vec<Size, Type, Allocator> operator*(const VecRef<Size, Type>& other) {
             return **this * *other;
         }
 
         template<typename AllA, typename AllB = AllA>
-        Vec<Size, Type, AllB>
+        constexpr Vec<Size, Type, AllB>
         operator/(const Vec<Size, Type, AllA>& other) {
             return toVec<AllB>() / other;
         }
 
         template<typename Allocator = StaticAllocator>
-        Vec<Size, Type, Allocator> operator/(const VecRef<Size, Type>& other) {
+        constexpr Vec<Size, Type, Allocator> operator/(const VecRef<Size, Type>& other) {
             return **this / *other;
         }
 
         template<typename AllA, typename AllB = AllA>
-        Vec<Size, Type, AllB>
+        constexpr Vec<Size, Type, AllB>
         operator%(const Vec<Size, Type, AllA>& other) {
             return toVec<AllB>() % other;
         }
 
         template<typename Allocator = StaticAllocator>
-        Vec<Size, Type, Allocator> operator%(const VecRef<Size, Type>& other) {
+        constexpr Vec<Size, Type, Allocator> operator%(const VecRef<Size, Type>& other) {
             return **this % *other;
         }
 
         template<typename OAlloc>
-        Type dot(const Vec<Size, Type, OAlloc>& other) const {
+        constexpr Type dot(const Vec<Size, Type, OAlloc>& other) const {
             Type result = *references[0] * other[0];
             for(size_t i = 1; i < Size; ++i) {
                 result += *references[i] * other[i];
@@ -141,7 +141,7 @@ namespace rush {
         }
 
         template<typename OAlloc>
-        Vec<Size, Type, OAlloc> cross(
+        constexpr Vec<Size, Type, OAlloc> cross(
             const Vec<Size, Type, OAlloc>& other) const requires (
             Size == 3 && HasAdd<Type> && HasMul<Type>) {
             return {
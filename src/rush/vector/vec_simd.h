@@ -0,0 +1,235 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#ifndef RUSH_VEC_SIMD_H
+#define RUSH_VEC_SIMD_H
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include <rush/algorithm.h>
+#include <rush/simd.h>
+
+namespace rush::simd {
+    /**
+     * The minimum size a vector must have to use
+     * the bulk kernels defined in rush/simd.h.
+     */
+    constexpr size_t BULK_THRESHOLD = 8;
+
+    /**
+     * Whether the vector operations of a Vec<Size, Type> should be
+     * computed using the kernels defined in this file.
+     * <p>
+     * The hot float sizes (3 and 4) use SSE registers directly.
+     * Three-component vectors are loaded into a four-lane register
+     * with its last lane set to zero, so they keep their packed
+     * 12-byte layout in memory.
+     * <p>
+     * Float and double vectors of BULK_THRESHOLD elements or more
+     * use the bulk kernels, whose instruction set is selected
+     * at runtime.
+     *
+     * @tparam Size the size of the vector.
+     * @tparam Type the type of the vector.
+     */
+    template<size_t Size, typename Type>
+    constexpr bool HasVecKernel = Algorithm().useIntrinsics() && (
+                                      (std::is_same_v<Type, float> &&
+                                       (Size == 3 || Size == 4)) ||
+                                      (HasBulkKernel<Type> &&
+                                       Size >= BULK_THRESHOLD));
+
+#ifdef RUSH_INTRINSICS
+
+    namespace detail {
+        // Two-float halves are moved as 64-bit integers: __m128i accesses
+        // may alias any type, while double pointers to float storage may not.
+
+        template<size_t Size>
+        inline __m128 load(const float* p) {
+            if constexpr (Size == 4) {
+                return _mm_loadu_ps(p);
+            } else if constexpr (Size == 2) {
+                return _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+            } else {
+                __m128 xy = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+                __m128 z = _mm_load_ss(p + 2);
+                return _mm_movelh_ps(xy, z);
+            }
+        }
+
+        template<size_t Size>
+        inline void store(float* p, __m128 v) {
+            if constexpr (Size == 4) {
+                _mm_storeu_ps(p, v);
+            } else if constexpr (Size == 2) {
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(v));
+            } else {
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(v));
+                _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+            }
+        }
+
+        /**
+         * Returns a register with the sum of all lanes of the given
+         * register in its first lane.
+         */
+        inline __m128 horizontalSum(__m128 v) {
+            __m128 shuffled = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+            __m128 sums = _mm_add_ps(v, shuffled);
+            shuffled = _mm_movehl_ps(shuffled, sums);
+            return _mm_add_ss(sums, shuffled);
+        }
+
+        inline __m128 dotBroadcast(__m128 a, __m128 b) {
+            __m128 sum = horizontalSum(_mm_mul_ps(a, b));
+            return _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(0, 0, 0, 0));
+        }
+
+        template<size_t Size, BinaryOp Op, Broadcast B = Broadcast::None,
+            typename Type>
+        inline void binary(const Type* a, const Type* b, Type* out) {
+            if constexpr (Size > 4) {
+                simd::binary<Op, B>(a, b, out, Size);
+            } else {
+                __m128 l = B == Broadcast::Left ? _mm_set1_ps(*a) : load<Size>(a);
+                __m128 r = B == Broadcast::Right ? _mm_set1_ps(*b) : load<Size>(b);
+                // The unused lane of a three-component vector
+                // may compute 0 / 0. It is never stored.
+                if constexpr (Op == BinaryOp::Add) store<Size>(out, _mm_add_ps(l, r));
+                if constexpr (Op == BinaryOp::Sub) store<Size>(out, _mm_sub_ps(l, r));
+                if constexpr (Op == BinaryOp::Mul) store<Size>(out, _mm_mul_ps(l, r));
+                if constexpr (Op == BinaryOp::Div) store<Size>(out, _mm_div_ps(l, r));
+            }
+        }
+    }
+
+    template<size_t Size, typename Type>
+    inline Type dot(const Type* a, const Type* b) {
+        if constexpr (Size > 4) {
+            return simd::dot(a, b, Size);
+        } else {
+            __m128 v = _mm_mul_ps(detail::load<Size>(a), detail::load<Size>(b));
+            return _mm_cvtss_f32(detail::horizontalSum(v));
+        }
+    }
+
+    template<size_t Size, typename Type>
+    inline void add(const Type* a, const Type* b, Type* out) {
+        detail::binary<Size, BinaryOp::Add>(a, b, out);
+    }
+
+    template<size_t Size, typename Type>
+    inline void sub(const Type* a, const Type* b, Type* out) {
+        detail::binary<Size, BinaryOp::Sub>(a, b, out);
+    }
+
+    template<size_t Size, typename Type>
+    inline void mul(const Type* a, const Type* b, Type* out) {
+        detail::binary<Size, BinaryOp::Mul>(a, b, out);
+    }
+
+    template<size_t Size, typename Type>
+    inline void div(const Type* a, const Type* b, Type* out) {
+        detail::binary<Size, BinaryOp::Div>(a, b, out);
+    }
+
+    template<size_t Size, typename Type>
+    inline void add(const Type* a, Type s, Type* out) {
+        detail::binary<Size, BinaryOp::Add, Broadcast::Right>(a, &s, out);
+    }
+
+    template<size_t Size, typename Type>
+    inline void sub(const Type* a, Type s, Type* out) {
+        detail::binary<Size, BinaryOp::Sub, Broadcast::Right>(a, &s, out);
+    }
+
+    template<size_t Size, typename Type>
+    inline void sub(Type s, const Type* a, Type* out) {
+        detail::binary<Size, BinaryOp::Sub, Broadcast::Left>(&s, a, out);
+    }
+
+    template<size_t Size, typename Type>
+    inline void mul(const Type* a, Type s, Type* out) {
+        detail::binary<Size, BinaryOp::Mul, Broadcast::Right>(a, &s, out);
+    }
+
+    template<size_t Size, typename Type>
+    inline void div(const Type* a, Type s, Type* out) {
+        detail::binary<Size, BinaryOp::Div, Broadcast::Right>(a, &s, out);
+    }
+
+    template<size_t Size, typename Type>
+    inline void div(Type s, const Type* a, Type* out) {
+        detail::binary<Size, BinaryOp::Div, Broadcast::Left>(&s, a, out);
+    }
+
+    template<size_t Size, typename Type>
+    inline void negate(const Type* a, Type* out) {
+        if constexpr (Size > 4) {
+            Type minusOne = Type(-1);
+            simd::binary<BinaryOp::Mul, Broadcast::Right>(a, &minusOne, out, Size);
+        } else {
+            __m128 v = detail::load<Size>(a);
+            detail::store<Size>(out, _mm_xor_ps(v, _mm_set1_ps(-0.0f)));
+        }
+    }
+
+    /**
+     * Copies the given lanes of a vector of Size components
+     * into a vector of sizeof...(Indices) components using
+     * a single shuffle.
+     */
+    template<size_t Size, size_t... Indices>
+    inline void swizzle(const float* a, float* out) {
+        constexpr size_t Lanes[4] = {Indices...};
+        constexpr int Mask = _MM_SHUFFLE(
+            sizeof...(Indices) > 3 ? Lanes[3] : 0,
+            sizeof...(Indices) > 2 ? Lanes[2] : 0,
+            Lanes[1],
+            Lanes[0]
+        );
+        __m128 v = detail::load<Size>(a);
+        detail::store<sizeof...(Indices)>(out, _mm_shuffle_ps(v, v, Mask));
+    }
+
+    inline void cross(const float* a, const float* b, float* out) {
+        __m128 va = detail::load<3>(a);
+        __m128 vb = detail::load<3>(b);
+        __m128 aYZX = _mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 bYZX = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 c = _mm_sub_ps(_mm_mul_ps(va, bYZX), _mm_mul_ps(aYZX, vb));
+        detail::store<3>(out, _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+    }
+
+    /**
+     * Normalizes the given vector.
+     * <p>
+     * The high precision version uses a full square root and a division.
+     * The low precision version of the three and four-component
+     * kernels uses the reciprocal square root approximation
+     * (12 bits of precision).
+     */
+    template<size_t Size, Precision P, typename Type>
+    inline void normalize(const Type* a, Type* out) {
+        if constexpr (Size > 4) {
+            Type inv = Type(1) / std::sqrt(simd::dot(a, a, Size));
+            simd::binary<BinaryOp::Mul, Broadcast::Right>(a, &inv, out, Size);
+        } else {
+            __m128 v = detail::load<Size>(a);
+            __m128 squared = detail::dotBroadcast(v, v);
+            if constexpr (P == Precision::High) {
+                detail::store<Size>(out, _mm_div_ps(v, _mm_sqrt_ps(squared)));
+            } else {
+                detail::store<Size>(out, _mm_mul_ps(v, _mm_rsqrt_ps(squared)));
+            }
+        }
+    }
+
+#endif
+}
+
+#endif //RUSH_VEC_SIMD_H
@@ -2,6 +2,8 @@
 // Created by gaelr on 26/01/2024.
 //
 
+#include <vector>
+
 #include "test_common.h"
 
 TEST_CASE("AABB default", "[aabb]") {
@@ -94,3 +96,25 @@ TEST_CASE("AABB - Sphere", "[aabb]") {
     REQUIRE_FALSE(rush::intersects(aabb, sphere2));
     REQUIRE_FALSE(rush::intersects(sphere2, aabb));
 }
+
+TEST_CASE("AABB bounds", "[aabb]") {
+    std::vector<rush::Vec3f> points = {
+        {1.0f, -2.0f, 3.0f},
+        {-3.0f, 4.0f, 1.0f},
+        {5.0f, 0.0f, -1.0f}
+    };
+    auto aabb = rush::bounds(points);
+    REQUIRE(aabb == rush::AABB<3, float>::fromEdges({-3.0f, -2.0f, -1.0f}, {5.0f, 4.0f, 3.0f}));
+    requireSimilar(aabb.center, rush::Vec3f(1.0f, 1.0f, 1.0f));
+    requireSimilar(aabb.radius, rush::Vec3f(4.0f, 3.0f, 2.0f));
+
+    std::vector<rush::Vec2d> grid;
+    for (int x = 0; x < 100; ++x) {
+        for (int y = 0; y < 100; ++y) {
+            grid.emplace_back(x * 0.5, y - 20.0);
+        }
+    }
+    auto gridBounds = rush::bounds(grid, 4);
+    REQUIRE(gridBounds.center == rush::Vec2d(24.75, 29.5));
+    REQUIRE(gridBounds.radius == rush::Vec2d(24.75, 49.5));
+}
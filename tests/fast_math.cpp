@@ -0,0 +1,166 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#include <bit>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "test_common.h"
+
+namespace {
+    int64_t ulpDistance(float a, double reference) {
+        auto r = static_cast<float>(reference);
+        if (std::isnan(a) && std::isnan(r)) return 0;
+        if (std::isinf(a) || std::isinf(r)) return a == r ? 0 : INT32_MAX;
+        auto ia = std::bit_cast<int32_t>(a);
+        auto ir = std::bit_cast<int32_t>(r);
+        // Maps the sign-magnitude representation to a monotonic one.
+        int64_t la = ia < 0 ? int64_t(INT32_MIN) - ia : ia;
+        int64_t lr = ir < 0 ? int64_t(INT32_MIN) - ir : ir;
+        return std::abs(la - lr);
+    }
+
+    std::vector<float> randomValues(size_t amount, float min, float max) {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> distr(min, max);
+        std::vector<float> values(amount);
+        for (auto& value: values) {
+            value = distr(gen);
+        }
+        return values;
+    }
+
+    constexpr rush::InstructionSet INSTRUCTION_SETS[] = {
+        rush::InstructionSet::Generic,
+        rush::InstructionSet::SSE4,
+        rush::InstructionSet::AVX2,
+        rush::InstructionSet::AVX512
+    };
+}
+
+TEST_CASE("Fast math error bounds", "[scalar][fast]") {
+    constexpr size_t AMOUNT = 100003;
+    auto angles = randomValues(AMOUNT, -std::numbers::pi_v<float>, std::numbers::pi_v<float>);
+    auto farAngles = randomValues(AMOUNT, -8192.0f, 8192.0f);
+    auto coordinates = randomValues(AMOUNT, -100.0f, 100.0f);
+    auto exponents = randomValues(AMOUNT, -87.0f, 88.0f);
+    auto positives = randomValues(AMOUNT, 1e-3f, 1e3f);
+    auto small = randomValues(AMOUNT, -1.0f, 1.0f);
+
+    std::vector<float> out(AMOUNT);
+    std::vector<float> out2(AMOUNT);
+
+    auto supported = rush::cpu::supportedInstructionSet();
+    for (auto set: INSTRUCTION_SETS) {
+        rush::cpu::setInstructionSet(set);
+
+        int64_t sinError = 0, cosError = 0;
+        rush::fast::sincos(angles.data(), out.data(), out2.data(), AMOUNT);
+        for (size_t i = 0; i < AMOUNT; ++i) {
+            sinError = std::max(sinError, ulpDistance(out[i], std::sin(double(angles[i]))));
+            cosError = std::max(cosError, ulpDistance(out2[i], std::cos(double(angles[i]))));
+        }
+        REQUIRE(sinError <= 2);
+        REQUIRE(cosError <= 2);
+
+        double absoluteError = 0.0;
+        rush::fast::sin(farAngles.data(), out.data(), AMOUNT);
+        rush::fast::cos(farAngles.data(), out2.data(), AMOUNT);
+        for (size_t i = 0; i < AMOUNT; ++i) {
+            absoluteError = std::max(absoluteError, std::abs(out[i] - std::sin(double(farAngles[i]))));
+            absoluteError = std::max(absoluteError, std::abs(out2[i] - std::cos(double(farAngles[i]))));
+        }
+        REQUIRE(absoluteError < 1e-7);
+
+        int64_t error = 0;
+        rush::fast::atan2(coordinates.data(), coordinates.data() + 1, out.data(), AMOUNT - 1);
+        for (size_t i = 0; i < AMOUNT - 1; ++i) {
+            error = std::max(error, ulpDistance(out[i], std::atan2(double(coordinates[i]),
+                                                                  double(coordinates[i + 1]))));
+        }
+        REQUIRE(error <= 3);
+
+        error = 0;
+        rush::fast::exp(exponents.data(), out.data(), AMOUNT);
+        for (size_t i = 0; i < AMOUNT; ++i) {
+            error = std::max(error, ulpDistance(out[i], std::exp(double(exponents[i]))));
+        }
+        REQUIRE(error <= 1);
+
+        error = 0;
+        rush::fast::log(positives.data(), out.data(), AMOUNT);
+        for (size_t i = 0; i < AMOUNT; ++i) {
+            error = std::max(error, ulpDistance(out[i], std::log(double(positives[i]))));
+        }
+        REQUIRE(error <= 1);
+
+        // The error bound of pow depends on the magnitude of y * log(x).
+        double excess = 0.0;
+        rush::fast::pow(positives.data(), small.data(), out.data(), AMOUNT);
+        for (size_t i = 0; i < AMOUNT; ++i) {
+            double x = positives[i];
+            double y = small[i];
+            double bound = 2.0 + 2.0 * std::max(std::abs(y * std::log(x)) - 1.0, 0.0);
+            excess = std::max(excess, ulpDistance(out[i], std::pow(x, y)) - bound);
+        }
+        REQUIRE(excess <= 0.0);
+    }
+    rush::cpu::setInstructionSet(supported);
+}
+
+TEST_CASE("Fast math special values", "[scalar][fast]") {
+    constexpr float INF = std::numeric_limits<float>::infinity();
+    constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+    constexpr float PI = std::numbers::pi_v<float>;
+
+    std::vector<float> values = {0.0f, 1.0f, -1.0f, INF, -INF, NaN, 100.0f, -100.0f, 1e30f};
+    std::vector<float> out(values.size());
+
+    auto supported = rush::cpu::supportedInstructionSet();
+    for (auto set: INSTRUCTION_SETS) {
+        rush::cpu::setInstructionSet(set);
+
+        rush::fast::exp(values.data(), out.data(), values.size());
+        REQUIRE(out[0] == 1.0f);
+        REQUIRE(out[3] == INF);
+        REQUIRE(out[4] == 0.0f);
+        REQUIRE(std::isnan(out[5]));
+        REQUIRE(out[6] == INF);
+        REQUIRE(out[7] == 0.0f);
+
+        rush::fast::log(values.data(), out.data(), values.size());
+        REQUIRE(out[0] == -INF);
+        REQUIRE(out[1] == 0.0f);
+        REQUIRE(std::isnan(out[2]));
+        REQUIRE(out[3] == INF);
+        REQUIRE(std::isnan(out[5]));
+
+        // Out of range arguments use the std functions.
+        rush::fast::sin(values.data(), out.data(), values.size());
+        REQUIRE(out[0] == 0.0f);
+        REQUIRE(std::isnan(out[3]));
+        REQUIRE(std::isnan(out[5]));
+        REQUIRE(out[8] == std::sin(1e30f));
+
+        std::vector<float> ones(values.size(), -1.0f);
+        rush::fast::atan2(values.data(), ones.data(), out.data(), values.size());
+        requireSimilar(out[0], PI, 1e-6f);
+        requireSimilar(out[1], 3.0f * PI / 4.0f, 1e-6f);
+        REQUIRE(std::isnan(out[5]));
+
+        rush::fast::pow(values.data(), 0.0f, out.data(), values.size());
+        REQUIRE(out[5] == 1.0f);
+        rush::fast::pow(values.data(), 2.0f, out.data(), values.size());
+        REQUIRE(out[0] == 0.0f);
+        REQUIRE(out[1] == 1.0f);
+        REQUIRE(std::isnan(out[2]));
+    }
+    rush::cpu::setInstructionSet(supported);
+
+    REQUIRE(rush::fast::exp(0.0f) == 1.0f);
+    REQUIRE(rush::fast::log(-1.0f) != rush::fast::log(-1.0f));
+    REQUIRE(rush::fast::atan2(0.0f, 0.0f) == 0.0f);
+    REQUIRE(rush::fast::cos(0.0f) == 1.0f);
+}
@@ -1,6 +1,8 @@
+#include <cmath>
 #include <numbers>
 #include <random>
 #include <ranges>
+#include <vector>
 #include <rush/matrix/mat.h>
 
 #include "test_common.h"
@@ -73,6 +75,19 @@ TEST_CASE("Matrix creation", "[matrix]") {
 
     REQUIRE(Mat3([](size_t c, size_t r) { return static_cast<int>(r + c * 3); })
         == Mat3(0, 1, 2, 3, 4, 5, 6, 7, 8));
+    REQUIRE(Mat3([](size_t c, size_t r, size_t columns, size_t rows) {
+        return static_cast<int>(r + c * rows + columns);
+        }) == Mat3(3, 4, 5, 6, 7, 8, 9, 10, 11));
+
+    std::function<int(size_t, size_t)> function = [](size_t c, size_t r) {
+        return static_cast<int>(c == r);
+    };
+    REQUIRE(Mat3(function) == Mat3(1));
+
+    // Matrices can be called, but they must be copied, not used as populators.
+    Mat3 source(1, 2, 3, 4, 5, 6, 7, 8, 9);
+    Mat3 copy(source);
+    REQUIRE(copy == source);
 
     Mat2 mat(0, 1, 2, 3);
     REQUIRE(Mat3(mat, 1) == Mat3(0, 1, 0, 2, 3, 0, 0, 0, 1));
@@ -198,6 +213,69 @@ TEST_CASE("Matrix - Matrix operations", "[matrix]") {
     }
 }
 
+template<typename A, typename B>
+concept CanMultiply = requires(A a, B b) { a * b; };
+
+TEST_CASE("Matrix lazy expressions", "[matrix]") {
+    rush::Mat<2, 2, float> a(1.0f, 2.0f, 3.0f, 4.0f);
+    rush::Mat<2, 2, float> b(2.0f, 2.0f, 3.0f, 3.0f);
+    using Heap = rush::Mat<2, 2, float, rush::MatDenseRep, rush::HeapAllocator>;
+    Heap c(a);
+
+    rush::Mat<2, 2, float> r = rush::lazy(a) + rush::lazy(b) * 2.0f - c;
+    REQUIRE(r == a + b * 2.0f - c);
+
+    // The whole right-hand side is a single expression.
+    using Leaf = rush::ExpressionLeaf<rush::MatShape<2, 2>, float>;
+    using Product = rush::ExpressionBinary<rush::ExpressionMul, rush::MatShape<2, 2>, float,
+        Leaf, rush::ExpressionScalar<float>>;
+    using Sum = rush::ExpressionBinary<rush::ExpressionAdd, rush::MatShape<2, 2>, float, Leaf, Product>;
+    using Full = rush::ExpressionBinary<rush::ExpressionSub, rush::MatShape<2, 2>, float, Sum, Leaf>;
+    STATIC_REQUIRE(std::is_same_v<decltype(rush::lazy(a) + rush::lazy(b) * 2.0f - c), Full>);
+
+    Heap h = -rush::lazy(a) / 2.0f;
+    REQUIRE(h == a * -0.5f);
+
+    h += rush::lazy(b) * 2.0f;
+    REQUIRE(h == a * -0.5f + b * 2.0f);
+
+    // The matrix product is not element-wise.
+    STATIC_REQUIRE_FALSE(CanMultiply<decltype(rush::lazy(a)), rush::Mat<2, 2, float>>);
+    STATIC_REQUIRE(std::is_same_v<decltype(a * b), rush::Mat<2, 2, float>>);
+}
+
+TEST_CASE("Matrix small buffer allocator", "[matrix]") {
+    using Small = rush::SmallBufferAllocator<>;
+    using M4 = rush::Mat<4, 4, double, rush::MatDenseRep, Small>;
+    using M20 = rush::Mat<20, 20, double, rush::MatDenseRep, Small>;
+
+    STATIC_REQUIRE(sizeof(M4) == sizeof(rush::Mat<4, 4, double>));
+    STATIC_REQUIRE(sizeof(M20) == sizeof(void*));
+    STATIC_REQUIRE(sizeof(rush::Vec<32, double, Small>) == 256);
+    STATIC_REQUIRE(sizeof(rush::Vec<33, double, Small>) == sizeof(void*));
+
+    M4 a(2.0);
+    M4 b = a * a;
+    REQUIRE(b == M4(4.0));
+
+    M20 c(3.0);
+    const double* storage = &c(0, 0);
+    M20 moved = std::move(c);
+    REQUIRE(&moved(0, 0) == storage);
+    REQUIRE(moved * moved == M20(9.0));
+
+    // Assigning to a moved object allocates new storage.
+    c = moved;
+    REQUIRE(c == moved);
+    REQUIRE(&c(0, 0) != &moved(0, 0));
+
+    using Heap = rush::Mat<2, 2, float, rush::MatDenseRep, rush::HeapAllocator>;
+    Heap h(1.0f);
+    Heap other = std::move(h);
+    h = other;
+    REQUIRE(h == Heap(1.0f));
+}
+
 TEST_CASE("Matrix operations", "[matrix]") {
     rush::Mat<3, 2, int> a(1, 2, 3, 4, 5, 6);
     rush::Mat<4, 3, int> b(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12);
@@ -205,6 +283,112 @@ TEST_CASE("Matrix operations", "[matrix]") {
     REQUIRE(a * b == r);
 }
 
+TEST_CASE("Matrix products without transposition", "[matrix]") {
+    rush::Mat<3, 2, int> a(1, 2, 3, 4, 5, 6);
+    rush::Vec<2, int> av = a * V3(1, 1, 1);
+    REQUIRE(av == rush::Vec<2, int>(9, 12));
+
+    constexpr Mat3f m(1.0f, 2.0f, 3.0f, 0.0f, 1.0f, 4.0f, 5.0f, 6.0f, 0.0f);
+    STATIC_REQUIRE(m * rush::Vec3f(1.0f, 0.0f, 0.0f) == rush::Vec3f(1.0f, 2.0f, 3.0f));
+    STATIC_REQUIRE((m * Mat3f(1.0f)) == m);
+
+    // Big enough to use the bulk kernels.
+    using Big = rush::Mat<13, 11, double, rush::MatDenseRep, rush::HeapAllocator>;
+    using Other = rush::Mat<5, 13, double>;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> distr(-1.0, 1.0);
+    Big big([&](size_t, size_t) { return distr(gen); });
+    Other other([&](size_t, size_t) { return distr(gen) < 0.0 ? 0.0 : distr(gen); });
+    rush::Vec<13, double> v([&](size_t) { return distr(gen); });
+    rush::Mat<5, 13, double, rush::MatSparseRep> sparse(other);
+
+    auto supported = rush::cpu::supportedInstructionSet();
+    for (auto set: {
+             rush::InstructionSet::Generic,
+             rush::InstructionSet::SSE4,
+             rush::InstructionSet::AVX2
+         }) {
+        rush::cpu::setInstructionSet(set);
+
+        auto bv = big * v;
+        for (size_t r = 0; r < 11; ++r) {
+            double expected = 0.0;
+            for (size_t c = 0; c < 13; ++c) {
+                expected += big(c, r) * v[c];
+            }
+            requireSimilar(bv[r], expected, 1e-12);
+        }
+
+        auto product = big * other;
+        auto sparseProduct = big * sparse;
+        for (size_t c = 0; c < 5; ++c) {
+            for (size_t r = 0; r < 11; ++r) {
+                double expected = 0.0;
+                for (size_t k = 0; k < 13; ++k) {
+                    expected += big(k, r) * other(c, k);
+                }
+                requireSimilar(product(c, r), expected, 1e-12);
+                requireSimilar(sparseProduct(c, r), expected, 1e-12);
+            }
+        }
+    }
+    rush::cpu::setInstructionSet(supported);
+}
+
+template<typename Type>
+void requireBlockedProductMatchesReference(Type epsilon) {
+    // Sizes not multiple of any block, so every border tile is tested.
+    using A = rush::Mat<130, 97, Type, rush::MatDenseRep, rush::HeapAllocator>;
+    using B = rush::Mat<77, 130, Type, rush::MatDenseRep, rush::HeapAllocator>;
+    static_assert(rush::detail::UsesGemm<130, 97, 77, Type, rush::MatDenseRep, rush::MatDenseRep>);
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Type> distr(Type(-1), Type(1));
+    A a([&](size_t, size_t) { return distr(gen); });
+    B b([&](size_t, size_t) { return distr(gen); });
+
+    std::vector<double> expected(77 * 97, 0.0);
+    for (size_t c = 0; c < 77; ++c) {
+        for (size_t k = 0; k < 130; ++k) {
+            for (size_t r = 0; r < 97; ++r) {
+                expected[c * 97 + r] += double(a(k, r)) * double(b(c, k));
+            }
+        }
+    }
+
+    auto supported = rush::cpu::supportedInstructionSet();
+    for (auto set: {
+             rush::InstructionSet::Generic,
+             rush::InstructionSet::SSE4,
+             rush::InstructionSet::AVX2,
+             rush::InstructionSet::AVX512
+         }) {
+        rush::cpu::setInstructionSet(set);
+        for (size_t threads: {1, 4}) {
+            auto product = rush::multiply(a, b, threads);
+            double error = 0.0;
+            for (size_t c = 0; c < 77; ++c) {
+                for (size_t r = 0; r < 97; ++r) {
+                    error = std::max(error, std::abs(double(product(c, r)) - expected[c * 97 + r]));
+                }
+            }
+            REQUIRE(error < epsilon);
+        }
+        REQUIRE(a * b == rush::multiply(a, b));
+    }
+    rush::cpu::setInstructionSet(supported);
+}
+
+TEST_CASE("Matrix blocked multiplication", "[matrix]") {
+    requireBlockedProductMatchesReference<double>(1e-12);
+    requireBlockedProductMatchesReference<float>(1e-4f);
+
+    // Small products are not worth packing.
+    STATIC_REQUIRE_FALSE(rush::detail::UsesGemm<4, 4, 4, float, rush::MatDenseRep, rush::MatDenseRep>);
+    Mat4 m(2);
+    REQUIRE(rush::multiply(m, m) == Mat4(4));
+}
+
 TEST_CASE("Matrix determinant", "[matrix]") {
     requireSimilar(randomMatrix.determinant(), -4002.91f);
 
@@ -224,6 +408,69 @@ TEST_CASE("Matrix inverse", "[matrix]") {
     }
 }
 
+template<typename Type, typename Allocator>
+void requireMat4KernelsMatchScalar() {
+    using M = rush::Mat<4, 4, Type, rush::MatDenseRep, Allocator>;
+    using V = rush::Vec<4, Type>;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Type> distr(Type(-10), Type(10));
+
+    auto supported = rush::cpu::supportedInstructionSet();
+    for (size_t i = 0; i < 100; ++i) {
+        M a, b;
+        V v;
+        for (size_t c = 0; c < 4; ++c) {
+            v[c] = distr(gen);
+            for (size_t r = 0; r < 4; ++r) {
+                a(c, r) = distr(gen);
+                b(c, r) = distr(gen);
+            }
+        }
+
+        rush::cpu::setInstructionSet(rush::InstructionSet::Generic);
+        M product = a * b;
+        auto transformed = a * v;
+        M transposed = a.transpose();
+        M inverse = a.inverse();
+        Type determinant = a.determinant();
+
+        for (auto set: {rush::InstructionSet::SSE4, rush::InstructionSet::AVX2}) {
+            rush::cpu::setInstructionSet(set);
+            Type epsilon = std::max(Type(1), std::abs(determinant)) * Type(1e-4);
+            requireSimilar(a * b, product, Type(1e-3));
+            auto result = a * v;
+            for (size_t r = 0; r < 4; ++r) {
+                requireSimilar(result[r], transformed[r], Type(1e-3));
+            }
+            REQUIRE(a.transpose() == transposed);
+            requireSimilar(a.determinant(), determinant, epsilon);
+            // Skip ill-conditioned matrices.
+            if (std::abs(determinant) > Type(1)) {
+                requireSimilar(a.inverse(), inverse, Type(1e-3));
+                requireSimilar(M(a * a.inverse()), M(Type(1)), Type(1e-3));
+            }
+        }
+    }
+    rush::cpu::setInstructionSet(supported);
+}
+
+TEST_CASE("Matrix 4x4 kernels", "[matrix]") {
+    requireMat4KernelsMatchScalar<float, rush::StaticAllocator>();
+    requireMat4KernelsMatchScalar<float, rush::HeapAllocator>();
+    requireMat4KernelsMatchScalar<double, rush::StaticAllocator>();
+
+    // Products may be stored in any of their operands.
+    Mat4f a = randomMatrix;
+    Mat4f expected = randomMatrix * randomMatrix.inverse();
+    a = a * a.inverse();
+    requireSimilar(a, expected);
+    requireSimilar(a, Mat4f(1.0f));
+
+    REQUIRE(Mat4f(2.0f).determinant() == 16.0f);
+    REQUIRE(rush::Mat4d(2.0).inverse() == rush::Mat4d(0.5));
+}
+
 TEST_CASE("Matrix translation", "[matrix]") {
     V4f vec = {10.0f, 20.0f, 30.0f, 1.0f};
     Mat4f trans = Mat4f::translate({-10.0f, -5.0f, 1.0f});
@@ -333,6 +580,191 @@ TEST_CASE("Sparse matrix random", "[matrix]") {
     REQUIRE(dense == sparse);
 }
 
+TEST_CASE("Sparse matrix builder", "[matrix]") {
+    std::mt19937 generator(7);
+    std::uniform_int_distribution valueDistribution(-5, 5);
+    std::uniform_int_distribution<size_t> columnDistribution(0, 9);
+    std::uniform_int_distribution<size_t> rowDistribution(0, 6);
+
+    // Integer values make the sums exact, whatever their order.
+    rush::Mat<10, 7, int32_t> dense;
+    rush::SparseBuilder<10, 7, int32_t> builder;
+    for (size_t i = 0; i < 500; i++) {
+        int32_t value = valueDistribution(generator);
+        size_t column = columnDistribution(generator);
+        size_t row = rowDistribution(generator);
+        dense(column, row) += value;
+        builder.add(column, row, value);
+    }
+    REQUIRE(builder.size() == 500);
+
+    auto sparse = builder.build();
+    REQUIRE(dense == sparse);
+
+    for (size_t c = 0; c < 10; ++c) {
+        for (size_t i = sparse.rep.cols[c]; i < sparse.rep.cols[c + 1]; ++i) {
+            REQUIRE(sparse.rep.vals[i] != 0);
+            if (i > sparse.rep.cols[c]) {
+                REQUIRE(sparse.rep.rows[i - 1] < sparse.rep.rows[i]);
+            }
+        }
+    }
+
+    // Cancelled values are not stored.
+    rush::SparseBuilder<3, 3, float> cancel;
+    cancel.add(1, 2, 3.0f);
+    cancel.add(0, 0, 1.0f);
+    cancel.add(1, 2, -3.0f);
+    auto cancelled = cancel.build();
+    REQUIRE(cancelled.rep.vals.size() == 1);
+    REQUIRE(cancelled == rush::Mat<3, 3, float>([](size_t c, size_t r) {
+        return c == 0 && r == 0 ? 1.0f : 0.0f;
+    }));
+
+    rush::SparseBuilder<3, 3, float> empty;
+    REQUIRE(empty.build() == rush::Mat<3, 3, float>());
+}
+
+TEST_CASE("Sparse matrix parallel assembly", "[matrix]") {
+    // 1D finite element stiffness matrix: each element adds a 2x2 block.
+    constexpr size_t ELEMENTS = 199;
+    auto element = [](rush::SparseBuilder<ELEMENTS + 1, ELEMENTS + 1, double>& builder, size_t e) {
+        double k = static_cast<double>(e % 5 + 1);
+        builder.add(e, e, k);
+        builder.add(e + 1, e, -k);
+        builder.add(e, e + 1, -k);
+        builder.add(e + 1, e + 1, k);
+    };
+
+    rush::SparseBuilder<ELEMENTS + 1, ELEMENTS + 1, double> sequential;
+    for (size_t e = 0; e < ELEMENTS; ++e) {
+        element(sequential, e);
+    }
+    auto expected = sequential.build<rush::HeapAllocator>();
+
+    for (size_t threads: {1, 3, 0}) {
+        auto builder = rush::SparseBuilder<ELEMENTS + 1, ELEMENTS + 1, double>::assemble(
+            ELEMENTS, threads, element, 16);
+        REQUIRE(builder.size() == ELEMENTS * 4);
+        auto assembled = builder.build<rush::HeapAllocator>();
+        REQUIRE(assembled.rep.vals == expected.rep.vals);
+        REQUIRE(assembled.rep.rows == expected.rep.rows);
+        REQUIRE(assembled.rep.cols == expected.rep.cols);
+    }
+
+    REQUIRE(expected.rep.vals.size() == ELEMENTS * 3 + 1);
+    REQUIRE(expected(0, 0) == 1.0);
+    REQUIRE(expected(1, 1) == 3.0);
+    REQUIRE(expected(1, 0) == -1.0);
+}
+
+TEST_CASE("Sparse matrix - vector multiplication", "[matrix]") {
+    using SparseMat = rush::Mat<300, 200, double, rush::MatSparseRep, rush::HeapAllocator>;
+    using DenseMat = rush::Mat<300, 200, double, rush::MatDenseRep, rush::HeapAllocator>;
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<> distr(-1.0, 1.0);
+
+    rush::SparseBuilder<300, 200, double> builder;
+    for (size_t c = 0; c < 300; ++c) {
+        for (size_t r = 0; r < 200; ++r) {
+            if (distr(gen) < -0.4) builder.add(c, r, distr(gen));
+        }
+    }
+    SparseMat sparse = builder.build<rush::HeapAllocator>();
+    DenseMat dense([&](size_t c, size_t r) { return sparse(c, r); });
+
+    rush::Vec<300, double, rush::HeapAllocator> x([&](size_t) { return distr(gen); });
+    rush::Vec<200, double, rush::HeapAllocator> xt([&](size_t) { return distr(gen); });
+    auto expected = dense * x;
+    auto expectedTransposed = dense.transpose() * xt;
+
+    auto product = sparse * x;
+    for (size_t r = 0; r < 200; ++r) {
+        REQUIRE_THAT(product[r], Catch::Matchers::WithinAbs(expected[r], 1e-12));
+    }
+
+    for (size_t threads: {1, 4, 0}) {
+        rush::Vec<200, double, rush::HeapAllocator> y(5.0);
+        rush::sparseMultiply(sparse, x, y, threads);
+        for (size_t r = 0; r < 200; ++r) {
+            REQUIRE_THAT(y[r], Catch::Matchers::WithinAbs(expected[r], 1e-12));
+        }
+
+        rush::Vec<300, double, rush::HeapAllocator> yt(5.0);
+        rush::sparseMultiplyTransposed(sparse, xt, yt, threads);
+        for (size_t c = 0; c < 300; ++c) {
+            REQUIRE_THAT(yt[c], Catch::Matchers::WithinAbs(expectedTransposed[c], 1e-12));
+        }
+    }
+}
+
+template<size_t Columns, size_t Rows, size_t OC>
+void requireSparseProductMatches(const rush::Mat<Columns, Rows, double>& a,
+                                 const rush::Mat<OC, Columns, double>& b,
+                                 const rush::Mat<OC, Rows, double, rush::MatSparseRep>& product) {
+    auto expected = a * b;
+    for (size_t c = 0; c < OC; ++c) {
+        for (size_t r = 0; r < Rows; ++r) {
+            REQUIRE_THAT(product(c, r), Catch::Matchers::WithinAbs(expected(c, r), 1e-12));
+        }
+    }
+}
+
+TEST_CASE("Sparse matrix - sparse matrix multiplication", "[matrix]") {
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<> distr(-1.0, 1.0);
+    auto sparseValue = [&](size_t, size_t) { return distr(gen) < -0.8 ? distr(gen) : 0.0; };
+
+    rush::Mat<40, 30, double, rush::MatSparseRep> a(sparseValue);
+    rush::Mat<25, 40, double, rush::MatSparseRep> b(sparseValue);
+    rush::Mat<40, 30, double> denseA(a);
+    rush::Mat<25, 40, double> denseB(b);
+
+    requireSparseProductMatches(denseA, denseB, a * b);
+
+    // The pattern can be reused while the structure does not change.
+    auto pattern = rush::sparseMultiplySymbolic(a, b);
+    REQUIRE(pattern.cols.size() == 26);
+    for (size_t c = 0; c < 25; ++c) {
+        for (size_t i = pattern.cols[c] + 1; i < pattern.cols[c + 1]; ++i) {
+            REQUIRE(pattern.rows[i - 1] < pattern.rows[i]);
+        }
+    }
+
+    rush::Mat<25, 30, double, rush::MatSparseRep> product;
+    rush::sparseMultiplyNumeric(a, b, pattern, product);
+    REQUIRE(product == a * b);
+
+    for (auto& value: b.rep.vals) value *= 2.0;
+    rush::sparseMultiplyNumeric(a, b, pattern, product);
+    requireSparseProductMatches(denseA, rush::Mat<25, 40, double>(b), product);
+    REQUIRE(product.rep.vals.size() <= pattern.size());
+
+    // A stale pattern is rejected instead of leaking values into other columns.
+    using Sparse2 = rush::Mat<2, 2, double, rush::MatSparseRep>;
+    Sparse2 identity([](size_t c, size_t r) { return c == r ? 1.0 : 0.0; });
+    Sparse2 filled([](size_t c, size_t r) { return c == r ? 1.0 : (c == 0 ? 2.0 : 0.0); });
+    auto stale = rush::sparseMultiplySymbolic(identity, identity);
+    Sparse2 result;
+    REQUIRE(rush::sparseMultiplyNumeric(identity, identity, stale, result));
+    REQUIRE(result == identity);
+    REQUIRE_FALSE(rush::sparseMultiplyNumeric(filled, identity, stale, result));
+    REQUIRE(result == Sparse2());
+    REQUIRE(rush::sparseMultiplyNumeric(filled, identity, rush::sparseMultiplySymbolic(filled, identity), result));
+    REQUIRE(result == filled);
+
+    // Galerkin product: Pᵀ A P.
+    rush::Mat<30, 30, double, rush::MatSparseRep> fine(sparseValue);
+    rush::Mat<10, 30, double, rush::MatSparseRep> prolongation([](size_t c, size_t r) {
+        return r / 3 == c ? 1.0 : 0.0;
+    });
+    auto coarse = prolongation.transpose() * fine * prolongation;
+    rush::Mat<30, 30, double> denseFine(fine);
+    rush::Mat<10, 30, double> denseProlongation(prolongation);
+    requireSparseProductMatches(denseProlongation.transpose() * denseFine,
+                                denseProlongation, coarse);
+}
+
 TEST_CASE("Sparse matrix operations", "[matrix]") {
     auto d1 = generateMatrix<rush::Mat4f>(4, 4);
     auto d2 = generateMatrix<rush::Mat4f>(4, 4);
@@ -483,6 +915,16 @@ TEST_CASE("LU non invertible", "[matrix]") {
     matrix(0, 3) = 4.0f;
     auto [result, decomposed] = matrix.luDecomposed();
     REQUIRE_FALSE(result);
+    REQUIRE_FALSE(rush::SparseMat4f(matrix).luDecomposed().first);
+
+    // Dense and sparse decompositions accept a zero last pivot.
+    rush::Mat<3, 3, double> lastPivot([](size_t c, size_t r) {
+        return static_cast<double>(r * 3 + c + 1);
+    });
+    REQUIRE(lastPivot.luDecomposed().first);
+    auto [sparseResult, sparseDecomposed] = rush::Mat<3, 3, double, rush::MatSparseRep>(lastPivot).luDecomposed();
+    REQUIRE(sparseResult);
+    REQUIRE(sparseDecomposed(2, 2) == 0.0);
 }
 
 TEST_CASE("Linear solve", "[matrix]") {
@@ -520,13 +962,538 @@ TEST_CASE("Sparse linear solve", "[matrix]") {
 }
 
 
+/**
+ * Builds the five-point Laplacian of a Side x Side grid.
+ * A non-zero convection makes the matrix nonsymmetric.
+ */
+template<size_t Side>
+rush::Mat<Side * Side, Side * Side, double, rush::MatSparseRep, rush::HeapAllocator>
+gridLaplacian(double convection) {
+    rush::SparseBuilder<Side * Side, Side * Side, double> builder;
+    for (size_t y = 0; y < Side; ++y) {
+        for (size_t x = 0; x < Side; ++x) {
+            size_t i = y * Side + x;
+            builder.add(i, i, 4.0);
+            if (x > 0) builder.add(i - 1, i, -1.0 - convection);
+            if (x + 1 < Side) builder.add(i + 1, i, -1.0 + convection);
+            if (y > 0) builder.add(i - Side, i, -1.0);
+            if (y + 1 < Side) builder.add(i + Side, i, -1.0);
+        }
+    }
+    return builder.template build<rush::HeapAllocator>();
+}
+
+template<size_t Size, typename Solver>
+void requireSolverConverges(const rush::Mat<Size, Size, double, rush::MatSparseRep, rush::HeapAllocator>& a,
+                            Solver solver) {
+    using Vector = rush::Vec<Size, double, rush::HeapAllocator>;
+    Vector expected([](size_t i) { return std::sin(static_cast<double>(i)); });
+    Vector b = a * expected;
+
+    rush::SolverOptions<double> options;
+    options.tolerance = 1e-10;
+    options.restart = 20;
+
+    for (size_t threads: {1, 2}) {
+        options.threads = threads;
+        Vector x;
+        auto result = solver(a, b, x, options);
+        REQUIRE(result.converged);
+        REQUIRE(result.iterations > 0);
+        REQUIRE(result.history.size() >= result.iterations);
+        REQUIRE(result.history.front() == 1.0);
+
+        Vector residual = b - a * x;
+        REQUIRE(std::sqrt(residual.dot(residual) / b.dot(b)) <= 1e-9);
+        for (size_t i = 0; i < Size; ++i) {
+            REQUIRE_THAT(x[i], Catch::Matchers::WithinAbs(expected[i], 1e-7));
+        }
+
+        // Warm start: the solution is already good enough.
+        auto warm = solver(a, b, x, options);
+        REQUIRE(warm.converged);
+        REQUIRE(warm.iterations == 0);
+        REQUIRE(warm.history.size() == 1);
+    }
+
+    // The iteration cap stops the solver.
+    options.maxIterations = 3;
+    Vector x;
+    auto capped = solver(a, b, x, options);
+    REQUIRE_FALSE(capped.converged);
+    REQUIRE(capped.iterations == 3);
+
+    // Null right-hand sides have a null solution.
+    Vector zero;
+    Vector guess(1.0);
+    REQUIRE(solver(a, zero, guess, options).converged);
+    REQUIRE(guess == zero);
+}
+
+TEST_CASE("Sparse iterative solvers", "[matrix]") {
+    auto spd = gridLaplacian<16>(0.0);
+    auto nonsymmetric = gridLaplacian<16>(0.4);
+
+    auto cg = [](const auto& a, const auto& b, auto& x, const auto& options) {
+        return rush::solveCg(a, b, x, options);
+    };
+    auto biCgStab = [](const auto& a, const auto& b, auto& x, const auto& options) {
+        return rush::solveBiCgStab(a, b, x, options);
+    };
+    auto gmres = [](const auto& a, const auto& b, auto& x, const auto& options) {
+        return rush::solveGmres(a, b, x, options);
+    };
+
+    requireSolverConverges(spd, cg);
+    requireSolverConverges(spd, biCgStab);
+    requireSolverConverges(spd, gmres);
+    requireSolverConverges(nonsymmetric, biCgStab);
+    requireSolverConverges(nonsymmetric, gmres);
+
+    // GMRES minimizes the residual: it never grows inside a cycle.
+    rush::Vec<256, double, rush::HeapAllocator> x;
+    rush::SolverOptions<double> options;
+    options.restart = 300;
+    auto result = rush::solveGmres(nonsymmetric, rush::Vec<256, double, rush::HeapAllocator>(1.0), x, options);
+    REQUIRE(result.converged);
+    for (size_t i = 1; i < result.history.size(); ++i) {
+        REQUIRE(result.history[i] <= result.history[i - 1] * (1.0 + 1e-12));
+    }
+}
+
+TEST_CASE("Sparse preconditioners", "[matrix]") {
+    using Vector = rush::Vec<256, double, rush::HeapAllocator>;
+    auto spd = gridLaplacian<16>(0.0);
+    auto nonsymmetric = gridLaplacian<16>(0.4);
+    Vector b([](size_t i) { return std::cos(static_cast<double>(i)); });
+
+    // Tridiagonal matrices have no fill-in: the incomplete factorizations are exact.
+    rush::Mat<40, 40, double, rush::MatSparseRep> tridiagonal([](size_t c, size_t r) {
+        if (c == r) return 4.0;
+        return c + 1 == r || r + 1 == c ? -1.0 : 0.0;
+    });
+    rush::Vec<40, double> expected([](size_t i) { return static_cast<double>(i % 7) - 3.0; });
+    rush::Vec<40, double> rhs = tridiagonal * expected;
+
+    rush::IluPreconditioner<40, double> ilu(tridiagonal);
+    REQUIRE(ilu.valid());
+    REQUIRE(ilu.factors() == tridiagonal.luDecomposed().second);
+    rush::IcPreconditioner<40, double> ic(tridiagonal);
+    REQUIRE(ic.valid());
+    rush::Vec<40, double> iluSolution, icSolution;
+    ilu.apply(rhs, iluSolution);
+    ic.apply(rhs, icSolution);
+    for (size_t i = 0; i < 40; ++i) {
+        REQUIRE_THAT(iluSolution[i], Catch::Matchers::WithinAbs(expected[i], 1e-12));
+        REQUIRE_THAT(icSolution[i], Catch::Matchers::WithinAbs(expected[i], 1e-12));
+    }
+
+    // The factorizations fail without a usable diagonal.
+    rush::Mat<3, 3, double, rush::MatSparseRep> noDiagonal(0.0);
+    noDiagonal.pushValue(0, 1, 1.0);
+    noDiagonal.pushValue(1, 0, 1.0);
+    noDiagonal.pushValue(2, 2, 1.0);
+    REQUIRE_FALSE(rush::IluPreconditioner<3, double>(noDiagonal).valid());
+    REQUIRE_FALSE(rush::IcPreconditioner<3, double>(noDiagonal).valid());
+    REQUIRE_FALSE(rush::IcPreconditioner<3, double>(rush::Mat<3, 3, double, rush::MatSparseRep>(-1.0)).valid());
+
+    rush::SolverOptions<double> options;
+    options.tolerance = 1e-10;
+
+    auto requireSolution = [&](const auto& a, const Vector& x) {
+        Vector residual = b - a * x;
+        REQUIRE(std::sqrt(residual.dot(residual) / b.dot(b)) <= 1e-9);
+    };
+
+    // CG: IC(0) and Jacobi against no preconditioner.
+    {
+        Vector x;
+        auto plain = rush::solveCg(spd, b, x, options);
+        REQUIRE(plain.converged);
+
+        rush::IcPreconditioner<256, double> icSpd(spd);
+        REQUIRE(icSpd.valid());
+        x = Vector();
+        auto preconditioned = rush::solveCg(spd, b, x, options, icSpd);
+        REQUIRE(preconditioned.converged);
+        REQUIRE(preconditioned.iterations < plain.iterations);
+        requireSolution(spd, x);
+
+        x = Vector();
+        auto jacobi = rush::solveCg(spd, b, x, options, rush::JacobiPreconditioner<256, double>(spd));
+        REQUIRE(jacobi.converged);
+        requireSolution(spd, x);
+    }
+
+    // BiCGSTAB and GMRES: ILU(0) against no preconditioner.
+    {
+        rush::IluPreconditioner<256, double> iluNonsymmetric(nonsymmetric);
+        REQUIRE(iluNonsymmetric.valid());
+
+        Vector x;
+        auto plain = rush::solveBiCgStab(nonsymmetric, b, x, options);
+        x = Vector();
+        auto preconditioned = rush::solveBiCgStab(nonsymmetric, b, x, options, iluNonsymmetric);
+        REQUIRE(preconditioned.converged);
+        REQUIRE(preconditioned.iterations < plain.iterations);
+        requireSolution(nonsymmetric, x);
+
+        x = Vector();
+        plain = rush::solveGmres(nonsymmetric, b, x, options);
+        x = Vector();
+        preconditioned = rush::solveGmres(nonsymmetric, b, x, options, iluNonsymmetric);
+        REQUIRE(preconditioned.converged);
+        REQUIRE(preconditioned.iterations < plain.iterations);
+        requireSolution(nonsymmetric, x);
+    }
+
+    // Jacobi fixes badly scaled rows.
+    {
+        rush::SparseBuilder<256, 256, double> builder;
+        for (size_t c = 0; c < 256; ++c) {
+            for (size_t p = spd.rep.cols[c]; p < spd.rep.cols[c + 1]; ++p) {
+                size_t r = spd.rep.rows[p];
+                double scale = std::pow(10.0, static_cast<double>(r % 4) + static_cast<double>(c % 4));
+                builder.add(c, r, spd.rep.vals[p] * scale);
+            }
+        }
+        auto scaled = builder.build<rush::HeapAllocator>();
+
+        Vector x;
+        auto plain = rush::solveCg(scaled, b, x, options);
+        x = Vector();
+        auto jacobi = rush::solveCg(scaled, b, x, options, rush::JacobiPreconditioner<256, double>(scaled));
+        REQUIRE(jacobi.converged);
+        REQUIRE(jacobi.iterations < plain.iterations);
+    }
+}
+
+TEST_CASE("Sparse LU ordering", "[matrix]") {
+    using Vector = rush::Vec<256, double, rush::HeapAllocator>;
+    auto a = gridLaplacian<16>(0.3);
+    Vector expected([](size_t i) { return std::sin(static_cast<double>(i)); });
+    Vector b = a * expected;
+
+    rush::SparseLU<256, double> natural(a, rush::SparseOrdering::Natural);
+    rush::SparseLU<256, double> amd(a);
+
+    // The ordering is a permutation that reduces the fill-in of the grid.
+    auto permutation = amd.permutation();
+    std::sort(permutation.begin(), permutation.end());
+    for (size_t i = 0; i < 256; ++i) {
+        REQUIRE(permutation[i] == i);
+    }
+    REQUIRE(amd.nonZeros() < natural.nonZeros() * 3 / 4);
+
+    // Natural order matches luDecomposed().
+    REQUIRE(natural.factorize(a));
+    auto [result, decomposed] = a.luDecomposed();
+    REQUIRE(result);
+    REQUIRE(decomposed.rep.vals.size() <= natural.nonZeros());
+
+    REQUIRE_FALSE(amd.valid());
+    REQUIRE(amd.factorize(a));
+    REQUIRE(amd.valid());
+    Vector x = amd.solve(b);
+    Vector y = natural.solve(b);
+    for (size_t i = 0; i < 256; ++i) {
+        REQUIRE_THAT(x[i], Catch::Matchers::WithinAbs(expected[i], 1e-10));
+        REQUIRE_THAT(y[i], Catch::Matchers::WithinAbs(expected[i], 1e-10));
+    }
+
+    // The analysis is reused for new values with the same structure.
+    auto other = gridLaplacian<16>(-0.2);
+    b = other * expected;
+    REQUIRE(amd.factorize(other));
+    amd.solve(b.toPointer(), b.toPointer());
+    for (size_t i = 0; i < 256; ++i) {
+        REQUIRE_THAT(b[i], Catch::Matchers::WithinAbs(expected[i], 1e-10));
+    }
+
+    // New positions or zero pivots make the factorization fail.
+    rush::Mat<4, 4, double, rush::MatSparseRep> diagonal([](size_t c, size_t r) {
+        return c == r ? 2.0 : 0.0;
+    });
+    rush::SparseLU<4, double> small(diagonal);
+    REQUIRE(small.nonZeros() == 4);
+    REQUIRE(small.factorize(diagonal));
+
+    auto filled = diagonal;
+    filled.pushValue(3, 0, 1.0);
+    REQUIRE_FALSE(small.factorize(filled));
+    REQUIRE_FALSE(small.valid());
+
+    // A zero pivot without values of L below it stays in U.
+    auto singular = diagonal;
+    singular.pushValue(2, 2, 0.0);
+    REQUIRE(small.factorize(singular));
+    REQUIRE(small.factorize(diagonal));
+
+    rush::Mat<2, 2, double, rush::MatSparseRep> zeroPivot([](size_t c, size_t r) {
+        return c == 0 && r == 0 ? 0.0 : 1.0;
+    });
+    rush::SparseLU<2, double> pivoted(zeroPivot, rush::SparseOrdering::Natural);
+    REQUIRE_FALSE(pivoted.factorize(zeroPivot));
+    rush::Vec<4, double> solution = small.solve(rush::Vec<4, double>(1.0));
+    REQUIRE(solution == rush::Vec<4, double>(0.5));
+}
+
+TEST_CASE("Sparse LDLT", "[matrix]") {
+    using Vector = rush::Vec<256, double, rush::HeapAllocator>;
+    auto a = gridLaplacian<16>(0.0);
+    Vector expected([](size_t i) { return std::cos(static_cast<double>(i)); });
+    Vector b = a * expected;
+
+    // Natural order: the etree of a grid links each column to the next one.
+    rush::SparseLDLT<256, double> natural(a, rush::SparseOrdering::Natural);
+    for (size_t i = 0; i + 1 < 256; ++i) {
+        REQUIRE(natural.parents()[i] == i + 1);
+    }
+    REQUIRE(natural.parents()[255] == rush::SparseLDLT<256, double>::NO_PARENT);
+
+    // L and D take about half the values of L and U.
+    rush::SparseLDLT<256, double> ldlt(a);
+    rush::SparseLU<256, double> lu(a);
+    REQUIRE(ldlt.permutation() == lu.permutation());
+    REQUIRE(ldlt.nonZeros() * 2 <= lu.nonZeros() + 256);
+
+    REQUIRE_FALSE(ldlt.valid());
+    REQUIRE(natural.factorize(a));
+    REQUIRE(ldlt.factorize(a));
+    REQUIRE(ldlt.valid());
+    for (double d: ldlt.diagonal()) {
+        REQUIRE(d > 0.0);
+    }
+
+    Vector x = ldlt.solve(b);
+    Vector y = natural.solve(b);
+    for (size_t i = 0; i < 256; ++i) {
+        REQUIRE_THAT(x[i], Catch::Matchers::WithinAbs(expected[i], 1e-10));
+        REQUIRE_THAT(y[i], Catch::Matchers::WithinAbs(expected[i], 1e-10));
+    }
+
+    // The analysis is reused for new values with the same structure.
+    rush::SparseBuilder<256, 256, double> builder;
+    for (size_t c = 0; c < 256; ++c) {
+        for (size_t p = a.rep.cols[c]; p < a.rep.cols[c + 1]; ++p) {
+            size_t r = a.rep.rows[p];
+            builder.add(c, r, r == c ? a.rep.vals[p] + static_cast<double>(c % 3) : a.rep.vals[p] * 0.5);
+        }
+    }
+    auto other = builder.build<rush::HeapAllocator>();
+    b = other * expected;
+    REQUIRE(ldlt.factorize(other));
+    ldlt.solve(b.toPointer(), b.toPointer());
+    for (size_t i = 0; i < 256; ++i) {
+        REQUIRE_THAT(b[i], Catch::Matchers::WithinAbs(expected[i], 1e-10));
+    }
+
+    // Indefinite matrices factorize while no pivot is zero.
+    rush::Mat<3, 3, double, rush::MatSparseRep> indefinite{
+        2.0, 1.0, 0.0,
+        1.0, -3.0, 1.0,
+        0.0, 1.0, 1.0
+    };
+    rush::SparseLDLT<3, double> small(indefinite, rush::SparseOrdering::Natural);
+    REQUIRE(small.factorize(indefinite));
+    rush::Vec<3, double> solution = small.solve(rush::Vec<3, double>(2.0, 4.0, 1.0));
+    rush::Vec<3, double> product = indefinite * solution;
+    for (size_t i = 0; i < 3; ++i) {
+        REQUIRE_THAT(product[i], Catch::Matchers::WithinAbs(rush::Vec<3, double>(2.0, 4.0, 1.0)[i], 1e-12));
+    }
+
+    // Removed values are fine, new positions or zero pivots make the factorization fail.
+    auto reduced = indefinite;
+    reduced.pushValue(1, 2, 0.0);
+    reduced.pushValue(2, 1, 0.0);
+    REQUIRE(small.factorize(reduced));
+    REQUIRE(small.factor().rep.vals[1] == 0.0);
+
+    auto filled = indefinite;
+    filled.pushValue(2, 0, 1.0);
+    filled.pushValue(0, 2, 1.0);
+    REQUIRE_FALSE(small.factorize(filled));
+    REQUIRE_FALSE(small.valid());
+
+    auto singular = indefinite;
+    singular.pushValue(0, 0, 0.0);
+    REQUIRE_FALSE(small.factorize(singular));
+    REQUIRE(small.factorize(indefinite));
+}
+
+TEST_CASE("Sparse triangular solve", "[matrix]") {
+    using Vector = rush::Vec<256, double, rush::HeapAllocator>;
+    auto a = gridLaplacian<16>(0.3);
+    Vector expected([](size_t i) { return std::sin(static_cast<double>(i)); });
+    Vector b = a * expected;
+
+    auto [result, decomposed] = a.luDecomposed();
+    REQUIRE(result);
+    auto x = decomposed.solveLu(rush::Vec<256, double>([&b](size_t i) { return b[i]; }));
+    for (size_t i = 0; i < 256; ++i) {
+        REQUIRE_THAT(x[i], Catch::Matchers::WithinAbs(expected[i], 1e-10));
+    }
+
+    // Every triangle matches the dense substitution.
+    rush::Mat<6, 6, double, rush::MatSparseRep> t([](size_t c, size_t r) {
+        if (c == r) return 2.0 + static_cast<double>(c);
+        return (c * 7 + r * 3) % 4 == 0 ? static_cast<double>(c) - static_cast<double>(r) * 0.5 : 0.0;
+    });
+    rush::Vec<6, double> rhs(1.0, -2.0, 3.0, 0.5, -1.0, 4.0);
+    for (auto triangle: {
+             rush::SparseTriangle::Lower, rush::SparseTriangle::UnitLower,
+             rush::SparseTriangle::Upper, rush::SparseTriangle::UnitUpper
+         }) {
+        bool lower = triangle == rush::SparseTriangle::Lower || triangle == rush::SparseTriangle::UnitLower;
+        bool unit = triangle == rush::SparseTriangle::UnitLower || triangle == rush::SparseTriangle::UnitUpper;
+        rush::Mat<6, 6, double> dense([&](size_t c, size_t r) {
+            if (c == r) return unit ? 1.0 : t(c, r);
+            return (lower ? r > c : r < c) ? t(c, r) : 0.0;
+        });
+
+        rush::Vec<6, double> solution = rhs;
+        rush::sparseTriangularSolve(t, triangle, solution.toPointer());
+        rush::Vec<6, double> product = dense * solution;
+
+        rush::SparseTriangularSchedule<6, double> schedule(t, triangle);
+        REQUIRE(schedule.triangle() == triangle);
+        rush::Vec<6, double> scheduled = rhs;
+        schedule.solve(scheduled);
+
+        for (size_t i = 0; i < 6; ++i) {
+            REQUIRE_THAT(product[i], Catch::Matchers::WithinAbs(rhs[i], 1e-12));
+            REQUIRE_THAT(scheduled[i], Catch::Matchers::WithinAbs(solution[i], 1e-12));
+        }
+    }
+
+    // A missing diagonal value is a zero pivot.
+    rush::Mat<2, 2, double, rush::MatSparseRep> missing{
+        1.0, 0.0,
+        1.0, 0.0
+    };
+    rush::Vec<2, double> infinite(1.0, 1.0);
+#ifdef NDEBUG
+    rush::sparseTriangularSolve(missing, rush::SparseTriangle::Upper, infinite.toPointer());
+    REQUIRE(std::isinf(infinite[1]));
+#else
+    REQUIRE_THROWS(rush::sparseTriangularSolve(missing, rush::SparseTriangle::Upper, infinite.toPointer()));
+#endif
+
+    // Levels: a diagonal matrix has one, a bidiagonal one has a level per row.
+    rush::Mat<8, 8, double, rush::MatSparseRep> diagonal([](size_t c, size_t r) {
+        return c == r ? 1.0 : 0.0;
+    });
+    REQUIRE(rush::SparseTriangularSchedule<8, double>(diagonal, rush::SparseTriangle::Lower).levels() == 1);
+    rush::Mat<8, 8, double, rush::MatSparseRep> bidiagonal([](size_t c, size_t r) {
+        return c == r || c + 1 == r ? 1.0 : 0.0;
+    });
+    REQUIRE(rush::SparseTriangularSchedule<8, double>(bidiagonal, rush::SparseTriangle::Lower).levels() == 8);
+    REQUIRE(rush::SparseTriangularSchedule<8, double>(bidiagonal, rush::SparseTriangle::Upper).levels() == 1);
+
+    // Scheduled LU solve, independent of the amount of threads.
+    // A grid in natural order is a chain, while AMD exposes independent rows.
+    rush::SparseLU<256, double> lu(a);
+    REQUIRE(lu.factorize(a));
+    const auto& factors = lu.factors();
+    rush::SparseTriangularSchedule<256, double> lowerSchedule(factors, rush::SparseTriangle::UnitLower);
+    rush::SparseTriangularSchedule<256, double> upperSchedule(factors, rush::SparseTriangle::Upper);
+    REQUIRE(rush::SparseTriangularSchedule<256, double>(decomposed, rush::SparseTriangle::UnitLower).levels() == 256);
+    REQUIRE(lowerSchedule.levels() < 128);
+    REQUIRE(upperSchedule.levels() < 128);
+
+    Vector permuted([&](size_t i) { return b[lu.permutation()[i]]; });
+    Vector single = permuted;
+    lowerSchedule.solve(single);
+    upperSchedule.solve(single);
+    for (size_t i = 0; i < 256; ++i) {
+        REQUIRE_THAT(single[i], Catch::Matchers::WithinAbs(expected[lu.permutation()[i]], 1e-10));
+    }
+    for (size_t threads: {2, 4}) {
+        Vector parallel = permuted;
+        lowerSchedule.solve(parallel, threads);
+        upperSchedule.solve(parallel, threads);
+        REQUIRE(parallel == single);
+    }
+}
+
 TEST_CASE("Sparse transpose", "[matrix]") {
     static rush::Mat4f expected = randomMatrix.transpose();
     auto sparse = rush::SparseMat4f(randomMatrix);
     REQUIRE(sparse.transpose() == expected);
+
+    std::mt19937 gen(5);
+    std::uniform_real_distribution<> distr(0.0, 1.0);
+    rush::Mat<7, 5, double, rush::MatSparseRep> rectangular([&](size_t, size_t) {
+        return distr(gen) < 0.4 ? distr(gen) : 0.0;
+    });
+    REQUIRE(rectangular.transpose() == rush::Mat<7, 5, double>(rectangular).transpose());
 }
 
 
+TEST_CASE("Matrix bulk transforms", "[matrix]") {
+    // Big enough to be split across threads.
+    constexpr size_t AMOUNT = rush::PARALLEL_MIN_CHUNK * 2 + 3;
+
+    std::vector<rush::Vec3f> points(AMOUNT);
+    for (size_t i = 0; i < AMOUNT; ++i) {
+        auto f = static_cast<float>(i % 97);
+        points[i] = rush::Vec3f(f, -f * 0.5f, 2.0f - f);
+    }
+
+    auto model = Mat4f::translate(rush::Vec3f(1.0f, 2.0f, 3.0f))
+                 * Mat4f::rotationY(0.7f)
+                 * Mat4f::scale(rush::Vec3f(2.0f, 1.0f, 0.5f));
+    auto projection = Mat4f::perspective(1.2f, 1.5f, 0.1f, 100.0f);
+
+    auto expected = [&](const Mat4f& m, const rush::Vec3f& v, float w, bool divide = false) {
+        V4f r;
+        for (size_t row = 0; row < 4; ++row) {
+            r[row] = m(0, row) * v[0] + m(1, row) * v[1] + m(2, row) * v[2] + m(3, row) * w;
+        }
+        return rush::Vec3f(r[0], r[1], r[2]) / (divide ? r[3] : 1.0f);
+    };
+
+    auto supported = rush::cpu::supportedInstructionSet();
+    for (auto set: {
+             rush::InstructionSet::Generic,
+             rush::InstructionSet::SSE4,
+             rush::InstructionSet::AVX2
+         }) {
+        rush::cpu::setInstructionSet(set);
+        for (size_t threads: {1, 4}) {
+            std::vector<rush::Vec3f> result(AMOUNT);
+
+            rush::transformPoints(model, points, result, threads);
+            for (size_t i = 0; i < AMOUNT; i += 101) {
+                requireSimilar(result[i], expected(model, points[i], 1.0f));
+            }
+
+            rush::transformDirections(model, points, result, threads);
+            for (size_t i = 0; i < AMOUNT; i += 101) {
+                requireSimilar(result[i], expected(model, points[i], 0.0f));
+            }
+
+            rush::projectPoints(projection, points, result, threads);
+            for (size_t i = 1; i < AMOUNT; i += 101) {
+                requireSimilar(result[i], expected(projection, points[i], 1.0f, true));
+            }
+
+            // In place, with an odd tail.
+            std::vector<rush::Vec3f> inPlace(points.begin(), points.begin() + 7);
+            rush::transformPoints(model, inPlace, threads);
+            for (size_t i = 0; i < inPlace.size(); ++i) {
+                requireSimilar(inPlace[i], expected(model, points[i], 1.0f));
+            }
+        }
+    }
+    rush::cpu::setInstructionSet(supported);
+
+    std::vector<rush::Vec3d> doubles = {{1.0, 2.0, 3.0}, {-1.0, 0.0, 4.0}};
+    rush::transformPoints(rush::Mat4d::translate(rush::Vec3d(1.0, 1.0, 1.0)), doubles);
+    REQUIRE(doubles[0] == rush::Vec3d(2.0, 3.0, 4.0));
+    REQUIRE(doubles[1] == rush::Vec3d(0.0, 1.0, 5.0));
+}
+
 #ifdef RUSH_GLM
 
 #include <glm/glm.hpp>
@@ -551,3 +1518,24 @@ TEST_CASE("Rush - GLM (Matrix)", "[matrix]") {
 }
 
 #endif
+
+TEST_CASE("Matrix constexpr", "[matrix]") {
+    constexpr Mat3f m(1.0f, 2.0f, 3.0f, 0.0f, 1.0f, 4.0f, 5.0f, 6.0f, 0.0f);
+
+    STATIC_REQUIRE(m.transpose().transpose() == m);
+    STATIC_REQUIRE(m(2, 1) == 6.0f);
+    STATIC_REQUIRE(m.determinant() == 1.0f);
+    STATIC_REQUIRE(Mat4f(2.0f).determinant() == 16.0f);
+
+    constexpr Mat3f identity = m * m.inverse();
+    requireSimilar(identity, Mat3f(1.0f));
+
+    constexpr Mat4f perspective = Mat4f::perspective(
+        std::numbers::pi_v<float> / 2.0f, 1.5f, 0.1f, 100.0f);
+    float fov = std::numbers::pi_v<float> / 2.0f;
+    requireSimilar(perspective, Mat4f::perspective(fov, 1.5f, 0.1f, 100.0f));
+
+    constexpr Mat4f rotation = Mat4f::rotationY(1.0f);
+    float angle = 1.0f;
+    requireSimilar(rotation, Mat4f::rotationY(angle));
+}
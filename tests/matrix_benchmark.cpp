@@ -6,6 +6,9 @@
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <iostream>
 #include <random>
+#include <string>
+#include <tuple>
+#include <vector>
 #include <rush/rush.h>
 
 using V1 = rush::Vec<1, int>;
@@ -39,6 +42,46 @@ TEST_CASE("Big matrix multiplication (double)", "[!benchmark][matrix]") {
     };
 }
 
+TEST_CASE("Big matrix multiplication (threaded)", "[!benchmark][matrix]") {
+    using BigMat = rush::Mat<1000, 1000, double, rush::MatDenseRep, rush::HeapAllocator>;
+    using BigMatF = rush::Mat<1000, 1000, float, rush::MatDenseRep, rush::HeapAllocator>;
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<> distr(0.0, 1.0);
+
+    BigMat a([&](size_t c, size_t r) { return distr(gen); });
+    BigMat b([&](size_t c, size_t r) { return distr(gen); });
+    BigMatF af([&](size_t c, size_t r) { return static_cast<float>(distr(gen)); });
+    BigMatF bf([&](size_t c, size_t r) { return static_cast<float>(distr(gen)); });
+
+    BENCHMARK("1000 double") {
+        return rush::multiply(a, b, 0);
+    };
+
+    BENCHMARK("1000 float") {
+        return rush::multiply(af, bf, 0);
+    };
+}
+
+TEST_CASE("Big matrix - vector multiplication (double)", "[!benchmark][matrix]") {
+    using BigMat = rush::Mat<1000, 1000, double, rush::MatDenseRep, rush::HeapAllocator>;
+    using BigVec = rush::Vec<1000, double, rush::HeapAllocator>;
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<> distr(0.0, 1.0);
+
+    BigMat a([&](size_t c, size_t r) {
+        return distr(gen);
+    });
+    BigVec v([&](size_t i) {
+        return distr(gen);
+    });
+
+    BENCHMARK("1000") {
+        return a * v;
+    };
+}
+
 TEST_CASE("Big sparse matrix multiplication (double)", "[!benchmark][matrix]") {
     using BigMat = rush::Mat<1000, 1000, double, rush::MatDenseRep, rush::HeapAllocator>;
     BENCHMARK_ADVANCED("1000 0.3%")(Catch::Benchmark::Chronometer meter) {
@@ -91,6 +134,158 @@ TEST_CASE("Big sparse matrix multiplication (double)", "[!benchmark][matrix]") {
     };
 }
 
+TEST_CASE("Big sparse - sparse matrix multiplication (double)", "[!benchmark][matrix]") {
+    using BigMat = rush::Mat<1000, 1000, double, rush::MatSparseRep, rush::HeapAllocator>;
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<> distr(0.0, 1.0);
+
+    for (auto [density, name]: {std::pair(0.003, std::string("1000 0.3%")), std::pair(0.03, std::string("1000 3%"))}) {
+        rush::SparseBuilder<1000, 1000, double> builderA, builderB;
+        for (size_t c = 0; c < 1000; ++c) {
+            for (size_t r = 0; r < 1000; ++r) {
+                if (c == r || distr(gen) < density) builderA.add(c, r, distr(gen));
+                if (c == r || distr(gen) < density) builderB.add(c, r, distr(gen));
+            }
+        }
+        BigMat a = builderA.build<rush::HeapAllocator>();
+        BigMat b = builderB.build<rush::HeapAllocator>();
+        auto pattern = rush::sparseMultiplySymbolic(a, b);
+        BigMat result;
+
+        BENCHMARK(name.c_str()) {
+            return a * b;
+        };
+
+        BENCHMARK((name + " (numeric only)").c_str()) {
+            rush::sparseMultiplyNumeric(a, b, pattern, result);
+            return result.rep.vals.size();
+        };
+    }
+}
+
+TEST_CASE("Sparse matrix assembly (double)", "[!benchmark][matrix]") {
+    constexpr size_t SIZE = 2000;
+    using BigMat = rush::Mat<SIZE, SIZE, double, rush::MatSparseRep, rush::HeapAllocator>;
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<> distr(0.0, 1.0);
+    std::uniform_int_distribution<size_t> position(0, SIZE - 1);
+
+    std::vector<std::tuple<size_t, size_t, double>> triplets(20000);
+    for (auto& [c, r, v]: triplets) {
+        c = position(gen);
+        r = position(gen);
+        v = distr(gen);
+    }
+
+    BENCHMARK("pushValue 20000") {
+        BigMat m;
+        for (auto& [c, r, v]: triplets) {
+            m.pushValue(c, r, m(c, r) + v);
+        }
+        return m;
+    };
+
+    BENCHMARK("SparseBuilder 20000") {
+        rush::SparseBuilder<SIZE, SIZE, double> builder;
+        builder.reserve(triplets.size());
+        for (auto& [c, r, v]: triplets) {
+            builder.add(c, r, v);
+        }
+        return builder.build<rush::HeapAllocator>();
+    };
+}
+
+TEST_CASE("Big sparse matrix - vector multiplication (double)", "[!benchmark][matrix]") {
+    constexpr size_t SIZE = 5000;
+    using BigVec = rush::Vec<SIZE, double, rush::HeapAllocator>;
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<> distr(0.0, 1.0);
+    std::uniform_int_distribution<size_t> position(0, SIZE - 1);
+
+    rush::SparseBuilder<SIZE, SIZE, double> builder;
+    for (size_t i = 0; i < SIZE * 20; ++i) {
+        builder.add(position(gen), position(gen), distr(gen));
+    }
+    auto a = builder.build<rush::HeapAllocator>();
+    BigVec x([&](size_t i) { return distr(gen); });
+    BigVec y;
+
+    BENCHMARK("5000 20 per column") {
+        return a * x;
+    };
+
+    BENCHMARK("5000 20 per column (all threads)") {
+        rush::sparseMultiply(a, x, y, 0);
+        return y[0];
+    };
+
+    BENCHMARK("5000 20 per column (transposed)") {
+        rush::sparseMultiplyTransposed(a, x, y);
+        return y[0];
+    };
+}
+
+TEST_CASE("Sparse iterative solvers (double)", "[!benchmark][matrix]") {
+    // Five-point Laplacian of a 100x100 grid, with some convection for the nonsymmetric solvers.
+    constexpr size_t SIDE = 100;
+    constexpr size_t SIZE = SIDE * SIDE;
+    using BigVec = rush::Vec<SIZE, double, rush::HeapAllocator>;
+
+    auto laplacian = [](double convection) {
+        rush::SparseBuilder<SIZE, SIZE, double> builder;
+        for (size_t i = 0; i < SIZE; ++i) {
+            builder.add(i, i, 4.0);
+            if (i % SIDE > 0) builder.add(i - 1, i, -1.0 - convection);
+            if (i % SIDE + 1 < SIDE) builder.add(i + 1, i, -1.0 + convection);
+            if (i >= SIDE) builder.add(i - SIDE, i, -1.0);
+            if (i + SIDE < SIZE) builder.add(i + SIDE, i, -1.0);
+        }
+        return builder.build<rush::HeapAllocator>();
+    };
+
+    auto spd = laplacian(0.0);
+    auto nonsymmetric = laplacian(0.4);
+    BigVec b(1.0);
+    rush::SolverOptions<double> options;
+    options.maxIterations = 5000;
+
+    BENCHMARK("CG 10000") {
+        BigVec x;
+        return rush::solveCg(spd, b, x, options).iterations;
+    };
+
+    BENCHMARK("BiCGSTAB 10000") {
+        BigVec x;
+        return rush::solveBiCgStab(nonsymmetric, b, x, options).iterations;
+    };
+
+    BENCHMARK("GMRES(30) 10000") {
+        BigVec x;
+        return rush::solveGmres(nonsymmetric, b, x, options).iterations;
+    };
+
+    BENCHMARK("CG + IC(0) 10000") {
+        rush::IcPreconditioner<SIZE, double> ic(spd);
+        BigVec x;
+        return rush::solveCg(spd, b, x, options, ic).iterations;
+    };
+
+    BENCHMARK("BiCGSTAB + ILU(0) 10000") {
+        rush::IluPreconditioner<SIZE, double> ilu(nonsymmetric);
+        BigVec x;
+        return rush::solveBiCgStab(nonsymmetric, b, x, options, ilu).iterations;
+    };
+
+    BENCHMARK("GMRES(30) + ILU(0) 10000") {
+        rush::IluPreconditioner<SIZE, double> ilu(nonsymmetric);
+        BigVec x;
+        return rush::solveGmres(nonsymmetric, b, x, options, ilu).iterations;
+    };
+}
+
 TEST_CASE("Big dense LU decomposition (double)", "[!benchmark][matrix]") {
     BENCHMARK_ADVANCED("100x100 0.3%")(Catch::Benchmark::Chronometer meter) {
         using BigMat = rush::Mat<100, 100, double, rush::MatDenseRep, rush::HeapAllocator>;
@@ -136,6 +331,159 @@ TEST_CASE("Big dense LU decomposition (double)", "[!benchmark][matrix]") {
     };
 }
 
+TEST_CASE("Sparse LU ordering (double)", "[!benchmark][matrix]") {
+    // Five-point Laplacian of a 100x100 grid with some convection.
+    constexpr size_t SIDE = 100;
+    constexpr size_t SIZE = SIDE * SIDE;
+    using BigVec = rush::Vec<SIZE, double, rush::HeapAllocator>;
+
+    rush::SparseBuilder<SIZE, SIZE, double> builder;
+    for (size_t i = 0; i < SIZE; ++i) {
+        builder.add(i, i, 4.0);
+        if (i % SIDE > 0) builder.add(i - 1, i, -1.3);
+        if (i % SIDE + 1 < SIDE) builder.add(i + 1, i, -0.7);
+        if (i >= SIDE) builder.add(i - SIDE, i, -1.0);
+        if (i + SIDE < SIZE) builder.add(i + SIDE, i, -1.0);
+    }
+    auto a = builder.build<rush::HeapAllocator>();
+    BigVec b(1.0);
+
+    BENCHMARK("luDecomposed 10000") {
+        return a.luDecomposed().first;
+    };
+
+    BENCHMARK("Natural analysis + factorize 10000") {
+        rush::SparseLU<SIZE, double> lu(a, rush::SparseOrdering::Natural);
+        return lu.factorize(a);
+    };
+
+    BENCHMARK("AMD analysis + factorize 10000") {
+        rush::SparseLU<SIZE, double> lu(a);
+        return lu.factorize(a);
+    };
+
+    rush::SparseLU<SIZE, double> natural(a, rush::SparseOrdering::Natural);
+    rush::SparseLU<SIZE, double> amd(a);
+    natural.factorize(a);
+    amd.factorize(a);
+
+    BENCHMARK("Natural factorize 10000") {
+        return natural.factorize(a);
+    };
+
+    BENCHMARK("AMD factorize 10000") {
+        return amd.factorize(a);
+    };
+
+    BENCHMARK("Natural solve 10000") {
+        return natural.solve(b);
+    };
+
+    BENCHMARK("AMD solve 10000") {
+        return amd.solve(b);
+    };
+}
+
+TEST_CASE("Sparse LDLT (double)", "[!benchmark][matrix]") {
+    // Five-point Laplacian of a 100x100 grid.
+    constexpr size_t SIDE = 100;
+    constexpr size_t SIZE = SIDE * SIDE;
+    using BigVec = rush::Vec<SIZE, double, rush::HeapAllocator>;
+
+    rush::SparseBuilder<SIZE, SIZE, double> builder;
+    for (size_t i = 0; i < SIZE; ++i) {
+        builder.add(i, i, 4.0);
+        if (i % SIDE > 0) builder.add(i - 1, i, -1.0);
+        if (i % SIDE + 1 < SIDE) builder.add(i + 1, i, -1.0);
+        if (i >= SIDE) builder.add(i - SIDE, i, -1.0);
+        if (i + SIDE < SIZE) builder.add(i + SIDE, i, -1.0);
+    }
+    auto a = builder.build<rush::HeapAllocator>();
+    BigVec b(1.0);
+
+    BENCHMARK("LDLT analysis + factorize 10000") {
+        rush::SparseLDLT<SIZE, double> ldlt(a);
+        return ldlt.factorize(a);
+    };
+
+    rush::SparseLU<SIZE, double> lu(a);
+    rush::SparseLDLT<SIZE, double> ldlt(a);
+    lu.factorize(a);
+    ldlt.factorize(a);
+
+    BENCHMARK("LU factorize 10000") {
+        return lu.factorize(a);
+    };
+
+    BENCHMARK("LDLT factorize 10000") {
+        return ldlt.factorize(a);
+    };
+
+    BENCHMARK("LU solve 10000") {
+        return lu.solve(b);
+    };
+
+    BENCHMARK("LDLT solve 10000") {
+        return ldlt.solve(b);
+    };
+}
+
+TEST_CASE("Sparse triangular solve (double)", "[!benchmark][matrix]") {
+    using BigMat = rush::Mat<1000, 1000, double, rush::MatSparseRep, rush::HeapAllocator>;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> distr(0.0, 1.0);
+    BigMat random([&](size_t c, size_t r) {
+        return c == r ? 1.0 + distr(gen) : (distr(gen) < 0.003 ? distr(gen) : 0.0);
+    });
+    auto decomposed = random.luDecomposed().second;
+    rush::Vec<1000, double> r(1.0);
+
+    BENCHMARK("solveLu 1000x1000 0.3%") {
+        return decomposed.solveLu(r);
+    };
+
+    // Five-point Laplacian of a 300x300 grid, factorized with AMD.
+    constexpr size_t SIDE = 300;
+    constexpr size_t SIZE = SIDE * SIDE;
+    using BigVec = rush::Vec<SIZE, double, rush::HeapAllocator>;
+
+    rush::SparseBuilder<SIZE, SIZE, double> builder;
+    for (size_t i = 0; i < SIZE; ++i) {
+        builder.add(i, i, 4.0);
+        if (i % SIDE > 0) builder.add(i - 1, i, -1.3);
+        if (i % SIDE + 1 < SIDE) builder.add(i + 1, i, -0.7);
+        if (i >= SIDE) builder.add(i - SIDE, i, -1.0);
+        if (i + SIDE < SIZE) builder.add(i + SIDE, i, -1.0);
+    }
+    auto a = builder.build<rush::HeapAllocator>();
+    rush::SparseLU<SIZE, double> lu(a);
+    lu.factorize(a);
+    rush::SparseTriangularSchedule<SIZE, double> lower(lu.factors(), rush::SparseTriangle::UnitLower);
+    rush::SparseTriangularSchedule<SIZE, double> upper(lu.factors(), rush::SparseTriangle::Upper);
+    BigVec b(1.0);
+
+    BENCHMARK("Column solve 90000") {
+        BigVec x = b;
+        rush::sparseTriangularSolve(lu.factors(), rush::SparseTriangle::UnitLower, x.toPointer());
+        rush::sparseTriangularSolve(lu.factors(), rush::SparseTriangle::Upper, x.toPointer());
+        return x;
+    };
+
+    BENCHMARK("Level-scheduled solve 90000") {
+        BigVec x = b;
+        lower.solve(x);
+        upper.solve(x);
+        return x;
+    };
+
+    BENCHMARK("Level-scheduled solve 90000 (all threads)") {
+        BigVec x = b;
+        lower.solve(x, 0);
+        upper.solve(x, 0);
+        return x;
+    };
+}
+
 TEST_CASE("Big sparse LU decomposition (double)", "[!benchmark][matrix]") {
     BENCHMARK_ADVANCED("100x100 0.3%")(Catch::Benchmark::Chronometer meter) {
         using BigMat = rush::Mat<100, 100, double, rush::MatSparseRep, rush::HeapAllocator>;
@@ -281,3 +629,77 @@ TEST_CASE("Big sparse LU decomposition (float)", "[!benchmark][matrix]") {
         });
     };
 }
+
+TEST_CASE("Bulk point transform (float)", "[!benchmark][matrix]") {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<float> distr(-1.0f, 1.0f);
+
+    std::vector<rush::Vec3f> points(1000000);
+    for (auto& point: points) {
+        point = rush::Vec3f(distr(gen), distr(gen), distr(gen));
+    }
+    std::vector<rush::Vec3f> result(points.size());
+
+    auto matrix = Mat4f::translate(rush::Vec3f(1.0f, 2.0f, 3.0f)) * Mat4f::rotationY(0.7f);
+
+    BENCHMARK("Loop") {
+        for (size_t i = 0; i < points.size(); ++i) {
+            rush::Vec4f v = matrix * rush::Vec4f(points[i], 1.0f);
+            result[i] = v(0, 1, 2);
+        }
+        return result[0];
+    };
+
+    BENCHMARK("transformPoints") {
+        rush::transformPoints(matrix, points, result);
+        return result[0];
+    };
+
+    BENCHMARK("transformPoints (all threads)") {
+        rush::transformPoints(matrix, points, result, 0);
+        return result[0];
+    };
+}
+
+TEST_CASE("4x4 matrix operations (float)", "[!benchmark][matrix]") {
+    auto a = Mat4f::translate(rush::Vec3f(1.0f, 2.0f, 3.0f)) * Mat4f::rotationY(0.7f);
+    auto b = Mat4f::perspective(1.2f, 1.5f, 0.1f, 100.0f);
+    rush::Vec4f v(1.0f, 2.0f, 3.0f, 1.0f);
+
+    auto supported = rush::cpu::supportedInstructionSet();
+    for (auto set: {
+             rush::InstructionSet::Generic,
+             rush::InstructionSet::SSE4,
+             rush::InstructionSet::AVX2
+         }) {
+        if (set > supported) continue;
+        rush::cpu::setInstructionSet(set);
+        std::string name = set == rush::InstructionSet::Generic
+                               ? "Generic"
+                               : set == rush::InstructionSet::SSE4
+                                     ? "SSE4"
+                                     : "AVX2";
+
+        BENCHMARK("Multiply (" + name + ")") {
+            return a * b;
+        };
+
+        BENCHMARK("Multiply vector (" + name + ")") {
+            return a * v;
+        };
+
+        BENCHMARK("Transpose (" + name + ")") {
+            return a.transpose();
+        };
+
+        BENCHMARK("Inverse (" + name + ")") {
+            return a.inverse();
+        };
+
+        BENCHMARK("Determinant (" + name + ")") {
+            return a.determinant();
+        };
+    }
+    rush::cpu::setInstructionSet(supported);
+}
@@ -36,3 +36,83 @@ TEST_CASE("Pool basics", "[pool]") {
 
     REQUIRE(pool.occupied() == 0);
 }
+
+TEST_CASE("Pool allocator with a byte pool", "[pool]") {
+    using Allocator = rush::PoolAllocator<rush::PermanentHeapPool>;
+    using M = rush::Mat<8, 8, double, rush::MatDenseRep, Allocator>;
+    using V = rush::Vec<4, float, Allocator>;
+
+    rush::PermanentHeapPool arena(1 << 16);
+    auto inArena = [&arena](const void* ptr) {
+        auto* p = static_cast<const char*>(ptr);
+        auto* end = static_cast<const char*>(arena.pivot());
+        return p < end && p >= end - static_cast<ptrdiff_t>(arena.occupied());
+    };
+
+    V outside(1.0f, 2.0f, 3.0f, 4.0f);
+    REQUIRE(arena.occupied() == 0);
+    REQUIRE(Allocator::current() == nullptr);
+
+    {
+        Allocator::Scope scope(arena);
+        REQUIRE(Allocator::current() == &arena);
+
+        M a(2.0);
+        M b = a * a + a;
+        REQUIRE(b == M(6.0));
+        REQUIRE(inArena(&a(0, 0)));
+        REQUIRE(inArena(&b(7, 7)));
+
+        V v = outside * 2.0f;
+        REQUIRE(v == V(2.0f, 4.0f, 6.0f, 8.0f));
+        REQUIRE(inArena(v.toPointer()));
+        REQUIRE(reinterpret_cast<uintptr_t>(v.toPointer()) % alignof(rush::Vec4f) == 0);
+
+        // Assigning to a moved object allocates new storage.
+        V moved = std::move(v);
+        v = moved;
+        REQUIRE(v == moved);
+    }
+
+    REQUIRE(Allocator::current() == nullptr);
+    REQUIRE(arena.occupied() > 0);
+    REQUIRE_FALSE(inArena(outside.toPointer()));
+    arena.reset();
+    REQUIRE(arena.occupied() == 0);
+
+    // A full pool falls back to the global allocator.
+    rush::PermanentHeapPool tiny(16);
+    Allocator::Scope scope(tiny);
+    M big(1.0);
+    REQUIRE(big == M(1.0));
+    REQUIRE(tiny.occupied() == 0);
+}
+
+TEST_CASE("Pool allocator with a chunk pool", "[pool]") {
+    using ChunkPool = rush::Pool<4, sizeof(rush::Vec4f) * 2>;
+    using Allocator = rush::PoolAllocator<ChunkPool>;
+    using V = rush::Vec<4, float, Allocator>;
+
+    ChunkPool pool;
+    rush::PermanentHeapPool other(1024);
+    {
+        Allocator::Scope scope(pool);
+        V a(1.0f);
+        V b = a + a;
+        REQUIRE(pool.occupied() == 2);
+        {
+            // Nested scopes of other allocators are independent.
+            rush::PoolAllocator<rush::PermanentHeapPool>::Scope otherScope(other);
+            V c = b * 2.0f;
+            REQUIRE(c == V(4.0f));
+            REQUIRE(pool.occupied() == 3);
+        }
+        REQUIRE(pool.occupied() == 2);
+
+        std::vector<V> many(6, b);
+        REQUIRE(pool.occupied() == 4);
+        REQUIRE(many[5] == V(2.0f));
+    }
+    REQUIRE(pool.occupied() == 0);
+    REQUIRE(other.occupied() == 0);
+}
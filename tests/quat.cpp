@@ -183,3 +183,15 @@ TEST_CASE("Rush - GLM (Quaternion)", "[quaternion]") {
 }
 
 #endif
+
+TEST_CASE("Quaternion constexpr", "[quaternion]") {
+    constexpr float PI = std::numbers::pi_v<float>;
+    constexpr auto q = rush::Quatf::angleAxis(PI / 2.0f, {0.0f, 1.0f, 0.0f});
+    constexpr rush::Vec3f rotated = q * rush::Vec3f(1.0f, 0.0f, 0.0f);
+    constexpr auto matrix = q.rotationMatrix3();
+
+    requireSimilar(rotated, rush::Vec3f(0.0f, 0.0f, -1.0f));
+    requireSimilar(matrix * rush::Vec3f(1.0f, 0.0f, 0.0f), rotated);
+    STATIC_REQUIRE(q[0] == q.s);
+    STATIC_REQUIRE(q[2] == q.y);
+}
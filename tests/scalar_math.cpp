@@ -23,4 +23,19 @@ TEST_CASE("Binomial", "[scalar]") {
     REQUIRE(rush::binomial<uint64_t>(100, 100) == 1);
     REQUIRE(rush::binomial<uint64_t>(100, 500) == 0);
     REQUIRE(rush::binomial<int64_t>(-1, -2) == 1);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Constant evaluated math", "[scalar]") {
+    constexpr double sqrt2 = rush::sqrt(2.0);
+    constexpr float sin1 = rush::sin(1.0f);
+    constexpr float cos100 = rush::cos(100.0f);
+    constexpr double tan05 = rush::tan(0.5);
+    constexpr int absI = rush::abs(-3);
+
+    STATIC_REQUIRE(rush::sqrt(16.0) == 4.0);
+    STATIC_REQUIRE(absI == 3);
+    requireSimilar(sqrt2, std::sqrt(2.0), 1e-12);
+    requireSimilar(sin1, std::sin(1.0f), 1e-6f);
+    requireSimilar(cos100, std::cos(100.0f), 1e-5f);
+    requireSimilar(tan05, std::tan(0.5), 1e-12);
+}
@@ -92,4 +92,16 @@ TEST_CASE("Static tree basics", "[tree]") {
     }
 
     REQUIRE(set.size() == checkCount);
+
+    size_t consumerCount = 0;
+    tree.forEachIntersection(box, [&consumerCount](const Tree::Content&) {
+        ++consumerCount;
+    });
+    REQUIRE(consumerCount == checkCount);
+
+    size_t functionCount = 0;
+    std::function<void(const Tree::Content&)> function =
+            [&functionCount](const Tree::Content&) { ++functionCount; };
+    tree.forEachIntersection(box, function);
+    REQUIRE(functionCount == checkCount);
 }
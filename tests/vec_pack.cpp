@@ -0,0 +1,112 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#include <vector>
+
+#include "test_common.h"
+
+TEST_CASE("Vector pack layout", "[vector][pack]") {
+    REQUIRE(alignof(rush::Vec3fx4) == 16);
+    REQUIRE(alignof(rush::Vec3fx8) == 32);
+    REQUIRE(alignof(rush::Vec3fx16) == 64);
+    REQUIRE(sizeof(rush::Vec3fx8) == 3 * 8 * sizeof(float));
+}
+
+TEST_CASE("Vector pack gather and scatter", "[vector][pack]") {
+    std::vector<rush::Vec3f> vectors;
+    for (size_t i = 0; i < 10; ++i) {
+        auto f = static_cast<float>(i);
+        vectors.emplace_back(f, f * 2.0f, f * 3.0f);
+    }
+
+    auto pack = rush::Vec3fx8::gather(vectors);
+    REQUIRE(pack.lane(5) == vectors[5]);
+    REQUIRE(pack.y()[3] == 6.0f);
+
+    // Only two vectors remain.
+    auto tail = rush::Vec3fx8::gather(vectors, 8);
+    REQUIRE(tail.lane(1) == vectors[9]);
+    REQUIRE(tail.lane(2) == rush::Vec3f());
+
+    std::vector<size_t> indices = {9, 0, 4};
+    auto indexed = rush::Vec3fx4::gather(vectors, indices);
+    REQUIRE(indexed.lane(0) == vectors[9]);
+    REQUIRE(indexed.lane(2) == vectors[4]);
+    REQUIRE(indexed.lane(3) == rush::Vec3f());
+
+    std::vector<rush::Vec3f> result(10);
+    (pack * 2.0f).scatter(result);
+    tail.scatter(result, 8);
+    REQUIRE(result[7] == vectors[7] * 2.0f);
+    REQUIRE(result[9] == vectors[9]);
+
+    indexed.setLane(1, rush::Vec3f(1.0f, 1.0f, 1.0f));
+    indexed.scatter(result, indices);
+    REQUIRE(result[0] == rush::Vec3f(1.0f, 1.0f, 1.0f));
+}
+
+TEST_CASE("Vector pack operations", "[vector][pack]") {
+    std::vector<rush::Vec3f> a;
+    std::vector<rush::Vec3f> b;
+    for (size_t i = 0; i < 8; ++i) {
+        auto f = static_cast<float>(i) + 1.0f;
+        a.emplace_back(f, -f, 2.0f);
+        b.emplace_back(0.5f, f, f * f);
+    }
+
+    auto pa = rush::Vec3fx8::gather(a);
+    auto pb = rush::Vec3fx8::gather(b);
+
+    auto sum = pa + pb;
+    auto sub = pa - pb;
+    auto mul = pa * pb;
+    auto div = pa / pb;
+    auto neg = -pa;
+    auto cross = pa.cross(pb);
+    auto dot = pa.dot(pb);
+    auto length = pa.length();
+    auto normalized = pa.normalized();
+    auto scaled = 2.0f * pa / pa.length();
+
+    for (size_t l = 0; l < 8; ++l) {
+        REQUIRE(sum.lane(l) == a[l] + b[l]);
+        REQUIRE(sub.lane(l) == a[l] - b[l]);
+        REQUIRE(mul.lane(l) == a[l] * b[l]);
+        requireSimilar(div.lane(l), a[l] / b[l]);
+        REQUIRE(neg.lane(l) == -a[l]);
+        REQUIRE(cross.lane(l) == a[l].cross(b[l]));
+        requireSimilar(dot.lane(l)[0], a[l].dot(b[l]));
+        requireSimilar(length.x()[l], a[l].length());
+        requireSimilar(normalized.lane(l), a[l].normalized());
+        requireSimilar(scaled.lane(l), a[l].normalized() * 2.0f);
+    }
+
+    auto compound = pa;
+    compound += pb;
+    compound *= 0.5f;
+    REQUIRE(compound == (pa + pb) * 0.5f);
+}
+
+TEST_CASE("Vector pack math", "[vector][pack]") {
+    rush::Vec4fx4 pack;
+    for (size_t l = 0; l < 4; ++l) {
+        auto f = static_cast<float>(l);
+        pack.setLane(l, rush::Vec4f(-f, f, 0.5f, 2.0f * f));
+    }
+
+    auto absolute = rush::abs(pack);
+    auto clamped = rush::clamp(pack, 0.0f, 1.0f);
+    auto maximum = rush::max(pack);
+    auto mixed = rush::mix(pack, rush::Vec4fx4(1.0f), 0.5f);
+    auto sine = rush::sin(pack);
+
+    for (size_t l = 0; l < 4; ++l) {
+        auto v = pack.lane(l);
+        REQUIRE(absolute.lane(l) == rush::abs(v));
+        REQUIRE(clamped.lane(l) == rush::clamp(v, 0.0f, 1.0f));
+        REQUIRE(maximum.x()[l] == rush::max(v));
+        requireSimilar(mixed.lane(l), rush::mix(v, rush::Vec4f(1.0f), 0.5f));
+        requireSimilar(sine.lane(l), rush::sin(v));
+    }
+}
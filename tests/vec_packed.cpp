@@ -0,0 +1,211 @@
+//
+// Created by gaeqs on 18/10/2026.
+//
+
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "test_common.h"
+
+namespace {
+    constexpr rush::InstructionSet INSTRUCTION_SETS[] = {
+        rush::InstructionSet::Generic,
+        rush::InstructionSet::SSE4,
+        rush::InstructionSet::AVX2,
+        rush::InstructionSet::AVX512
+    };
+
+    template<size_t Size>
+    std::vector<rush::Vec<Size, float>> randomVectors(size_t amount, float min, float max) {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> distr(min, max);
+        std::vector<rush::Vec<Size, float>> vectors(amount);
+        for (auto& vector: vectors) {
+            for (size_t i = 0; i < Size; ++i) {
+                vector[i] = distr(gen);
+            }
+        }
+        return vectors;
+    }
+
+    template<typename Packed>
+    void requireBulkMatchesScalar(const std::vector<typename Packed::Unpacked>& vectors) {
+        std::vector<Packed> packed(vectors.size());
+        std::vector<typename Packed::Unpacked> unpacked(vectors.size());
+
+        auto supported = rush::cpu::supportedInstructionSet();
+        for (auto set: INSTRUCTION_SETS) {
+            rush::cpu::setInstructionSet(set);
+            rush::pack<Packed>(vectors, packed);
+            rush::unpack<Packed>(packed, unpacked);
+
+            size_t mismatches = 0;
+            for (size_t i = 0; i < vectors.size(); ++i) {
+                Packed scalar(vectors[i]);
+                if (!(packed[i] == scalar) || unpacked[i] != scalar.unpack()) {
+                    ++mismatches;
+                }
+            }
+            REQUIRE(mismatches == 0);
+        }
+        rush::cpu::setInstructionSet(supported);
+    }
+}
+
+TEST_CASE("Packed half floats", "[vector][packed]") {
+    static_assert(sizeof(rush::Vec3h) == 6);
+    static_assert(rush::Float16::decode(rush::Float16::encode(1.5f)) == 1.5f);
+
+    REQUIRE(rush::Float16::encode(0.0f) == 0x0000);
+    REQUIRE(rush::Float16::encode(-0.0f) == 0x8000);
+    REQUIRE(rush::Float16::encode(1.0f) == 0x3C00);
+    REQUIRE(rush::Float16::encode(-2.0f) == 0xC000);
+    REQUIRE(rush::Float16::encode(65504.0f) == 0x7BFF);
+    REQUIRE(rush::Float16::encode(65520.0f) == 0x7C00);
+    REQUIRE(rush::Float16::encode(std::numeric_limits<float>::infinity()) == 0x7C00);
+    REQUIRE(rush::Float16::encode(std::exp2(-24.0f)) == 0x0001);
+    REQUIRE(rush::Float16::encode(std::exp2(-26.0f)) == 0x0000);
+    // 1 + 2^-11 is halfway between 1 and the next half: ties to even.
+    REQUIRE(rush::Float16::encode(1.0f + std::exp2(-11.0f)) == 0x3C00);
+    REQUIRE(std::isnan(rush::Float16::decode(rush::Float16::encode(std::nanf("")))));
+
+    // Every finite half survives a round trip.
+    for (uint32_t h = 0; h < 0x10000; ++h) {
+        auto half = static_cast<uint16_t>(h);
+        if ((half & 0x7C00) == 0x7C00) continue;
+        REQUIRE(rush::Float16::encode(rush::Float16::decode(half)) == half);
+    }
+
+    rush::Vec3f v(1.0f, -0.333f, 1000.0f);
+    rush::Vec3h h(v);
+    auto back = h.unpack();
+    for (size_t i = 0; i < 3; ++i) {
+        REQUIRE(std::abs(back[i] - v[i]) <= std::abs(v[i]) * std::exp2(-11.0f));
+    }
+
+    auto vectors = randomVectors<3>(1003, -70000.0f, 70000.0f);
+    vectors.push_back(rush::Vec3f(std::exp2(-20.0f), -std::exp2(-15.0f), 0.0f));
+    requireBulkMatchesScalar<rush::Vec3h>(vectors);
+    requireBulkMatchesScalar<rush::Vec4h>(randomVectors<4>(1001, -2.0f, 2.0f));
+}
+
+TEST_CASE("Packed normalized integers", "[vector][packed]") {
+    static_assert(sizeof(rush::Vec3sn16) == 6);
+    static_assert(sizeof(rush::Vec4un8) == 4);
+    static_assert(rush::Unorm8::encode(1.0f) == 255);
+
+    REQUIRE(rush::Snorm16::encode(1.0f) == 32767);
+    REQUIRE(rush::Snorm16::encode(-1.0f) == -32767);
+    REQUIRE(rush::Snorm16::encode(-3.0f) == -32767);
+    REQUIRE(rush::Snorm16::encode(std::nanf("")) == 0);
+    REQUIRE(rush::Snorm16::decode(-32768) == -1.0f);
+    REQUIRE(rush::Snorm8::decode(-128) == -1.0f);
+    REQUIRE(rush::Unorm8::encode(-0.5f) == 0);
+    REQUIRE(rush::Unorm8::encode(2.0f) == 255);
+    REQUIRE(rush::Unorm8::encode(0.5f) == 128);
+    REQUIRE(rush::Unorm16::decode(65535) == 1.0f);
+
+    rush::Vec4f color(0.25f, 0.5f, 0.75f, 1.0f);
+    auto back = rush::Vec4un8(color).unpack();
+    for (size_t i = 0; i < 4; ++i) {
+        REQUIRE(std::abs(back[i] - color[i]) <= 0.5f / 255.0f + 1e-6f);
+    }
+
+    auto vectors = randomVectors<3>(1003, -1.2f, 1.2f);
+    vectors.push_back(rush::Vec3f(std::nanf(""), 1.0f, -1.0f));
+
+    std::vector<rush::Vec3sn16> packed(vectors.size());
+    std::vector<rush::Vec3f> unpacked(vectors.size());
+    rush::pack<rush::Vec3sn16>(vectors, packed);
+    rush::unpack<rush::Vec3sn16>(packed, unpacked);
+    float error = 0.0f;
+    for (size_t i = 0; i + 1 < vectors.size(); ++i) {
+        for (size_t c = 0; c < 3; ++c) {
+            float expected = std::clamp(vectors[i][c], -1.0f, 1.0f);
+            error = std::max(error, std::abs(unpacked[i][c] - expected));
+        }
+    }
+    REQUIRE(error <= 0.5f / 32767.0f * 1.001f);
+
+    requireBulkMatchesScalar<rush::Vec3sn16>(vectors);
+    requireBulkMatchesScalar<rush::Vec3un16>(vectors);
+    requireBulkMatchesScalar<rush::Vec3sn8>(vectors);
+    requireBulkMatchesScalar<rush::Vec3un8>(vectors);
+    requireBulkMatchesScalar<rush::Vec4un8>(randomVectors<4>(1001, -0.1f, 1.1f));
+}
+
+TEST_CASE("Packed 10-10-10-2", "[vector][packed]") {
+    static_assert(sizeof(rush::Unorm1010102) == 4);
+
+    REQUIRE(rush::Unorm1010102(rush::Vec4f(1.0f, 0.0f, 0.0f, 0.0f)).value == 0x3FF);
+    REQUIRE(rush::Unorm1010102(rush::Vec4f(0.0f, 0.0f, 0.0f, 1.0f)).value == 0xC0000000);
+    REQUIRE(rush::Snorm1010102(rush::Vec4f(-1.0f, 0.0f, 0.0f, 0.0f)).value == 0x201);
+
+    rush::Vec4f v(0.3f, -0.7f, 1.0f, -1.0f);
+    auto back = rush::Snorm1010102(v).unpack();
+    for (size_t i = 0; i < 3; ++i) {
+        REQUIRE(std::abs(back[i] - v[i]) <= 0.5f / 511.0f);
+    }
+    REQUIRE(back[3] == -1.0f);
+
+    auto color = rush::Unorm1010102(rush::Vec4f(0.1f, 0.2f, 0.3f, 0.6f)).unpack();
+    REQUIRE(std::abs(color[2] - 0.3f) <= 0.5f / 1023.0f);
+    REQUIRE(color[3] == 2.0f / 3.0f);
+
+    auto vectors = randomVectors<4>(100, -1.0f, 1.0f);
+    std::vector<rush::Snorm1010102> packed(vectors.size());
+    std::vector<rush::Vec4f> unpacked(vectors.size());
+    rush::pack<rush::Snorm1010102>(vectors, packed);
+    rush::unpack<rush::Snorm1010102>(packed, unpacked);
+    for (size_t i = 0; i < vectors.size(); ++i) {
+        REQUIRE(unpacked[i] == rush::Snorm1010102(vectors[i]).unpack());
+    }
+}
+
+TEST_CASE("Packed octahedral normals", "[vector][packed]") {
+    static_assert(sizeof(rush::OctNormal16) == 4);
+    static_assert(sizeof(rush::OctNormal8) == 2);
+
+    REQUIRE(rush::OctNormal16(rush::Vec3f(0.0f, 0.0f, 1.0f)).unpack() == rush::Vec3f(0.0f, 0.0f, 1.0f));
+    REQUIRE(rush::OctNormal16(rush::Vec3f(0.0f, 0.0f, -1.0f)).unpack() == rush::Vec3f(0.0f, 0.0f, -1.0f));
+    REQUIRE(rush::OctNormal16(rush::Vec3f(0.0f, 0.0f, 0.0f)).unpack() == rush::Vec3f(0.0f, 0.0f, 1.0f));
+
+    std::vector<rush::Vec3f> normals;
+    for (auto v: randomVectors<3>(10000, -1.0f, 1.0f)) {
+        if (v.squaredLength() > 1e-6f) normals.push_back(v.normalized());
+    }
+    normals.emplace_back(1.0f, 0.0f, 0.0f);
+    normals.emplace_back(0.0f, -1.0f, 0.0f);
+
+    std::vector<rush::OctNormal16> packed16(normals.size());
+    std::vector<rush::OctNormal8> packed8(normals.size());
+    std::vector<rush::Vec3f> unpacked16(normals.size());
+    std::vector<rush::Vec3f> unpacked8(normals.size());
+    rush::pack<rush::OctNormal16>(normals, packed16);
+    rush::pack<rush::OctNormal8>(normals, packed8);
+    rush::unpack<rush::OctNormal16>(packed16, unpacked16);
+    rush::unpack<rush::OctNormal8>(packed8, unpacked8);
+
+    // Computed in double precision: the float dot product of
+    // two almost equal vectors is not precise enough.
+    auto angle = [](const rush::Vec3f& a, const rush::Vec3f& b) {
+        rush::Vec3d da(a[0], a[1], a[2]);
+        rush::Vec3d db(b[0], b[1], b[2]);
+        return std::atan2(da.cross(db).length(), da.dot(db));
+    };
+
+    double error16 = 0.0, error8 = 0.0, length = 0.0;
+    for (size_t i = 0; i < normals.size(); ++i) {
+        error16 = std::max(error16, angle(normals[i], unpacked16[i]));
+        error8 = std::max(error8, angle(normals[i], unpacked8[i]));
+        length = std::max(length, std::abs(double(unpacked16[i].length()) - 1.0));
+    }
+
+    constexpr double DEGREES = 180.0 / std::numbers::pi;
+    REQUIRE(error16 * DEGREES < 0.005);
+    REQUIRE(error8 * DEGREES < 1.0);
+    REQUIRE(length < 1e-6);
+}
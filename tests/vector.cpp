@@ -1,6 +1,8 @@
 #include <iostream>
 #include <unordered_set>
 #include <numbers>
+#include <span>
+#include <vector>
 
 #include <rush/rush.h>
 
@@ -13,6 +15,9 @@ using V4 = rush::Vec<4, int>;
 using V5 = rush::Vec<5, int, rush::HeapAllocator>;
 using V5S = rush::Vec<5, int, rush::StaticAllocator>;
 
+template<typename Vector, size_t Index>
+concept CanSwizzle = requires(Vector v) { v.template swizzle<Index>(); };
+
 TEST_CASE("Vector creation", "[vector]") {
     REQUIRE_NOTHROW(V5());
     REQUIRE_NOTHROW(V5(1, 2, 3, 4, 5));
@@ -31,6 +36,14 @@ TEST_CASE("Vector creation", "[vector]") {
     REQUIRE(v[1] == 0);
     REQUIRE(V5([](size_t i) { return static_cast<int>(i); }) ==
             V5(0, 1, 2, 3, 4));
+    REQUIRE(V5([](size_t i, size_t size) {
+        return static_cast<int>(size - i);
+    }) == V5(5, 4, 3, 2, 1));
+
+    std::function<int(size_t)> function = [](size_t i) {
+        return static_cast<int>(i * 2);
+    };
+    REQUIRE(V5(function) == V5(0, 2, 4, 6, 8));
 }
 
 TEST_CASE("Vector access", "[vector]") {
@@ -60,6 +73,32 @@ TEST_CASE("Vector access", "[vector]") {
     REQUIRE_NOTHROW(o[o.size() - 1]);
 }
 
+TEST_CASE("Vector compile-time swizzle", "[vector]") {
+    V5 o = {4, 3, 2, 1, 0};
+    REQUIRE(o.swizzle<4, 0>() == V2(0, 4));
+    REQUIRE(o.swizzle<1, 1, 1>() == o(1, 1, 1));
+
+    rush::Vec3f a(1.0f, 2.0f, 3.0f);
+    rush::Vec4f b(1.0f, 2.0f, 3.0f, 4.0f);
+    REQUIRE(a.swizzle<2, 1, 0>() == rush::Vec3f(3.0f, 2.0f, 1.0f));
+    REQUIRE(a.swizzle<0, 0>() == rush::Vec2f(1.0f, 1.0f));
+    REQUIRE(a.swizzle<2, 0, 1, 2>() == rush::Vec4f(3.0f, 1.0f, 2.0f, 3.0f));
+    REQUIRE(b.swizzle<3, 2, 1, 0>() == rush::Vec4f(4.0f, 3.0f, 2.0f, 1.0f));
+    REQUIRE(b.swizzle<3, 1, 3>() == rush::Vec3f(4.0f, 2.0f, 4.0f));
+    REQUIRE(b.swizzle<3, 0>() == rush::Vec2f(4.0f, 1.0f));
+    REQUIRE(b.swizzle<2>() == rush::Vec1f(3.0f));
+
+    // The result of a three-component swizzle must not
+    // write past the end of the vector.
+    std::array<rush::Vec3f, 2> pair = {a, a};
+    pair[0] = b.swizzle<3, 2, 1>();
+    REQUIRE(pair[1] == a);
+
+    STATIC_REQUIRE(rush::Vec3f(1.0f, 2.0f, 3.0f).swizzle<1, 2>() == rush::Vec2f(2.0f, 3.0f));
+    STATIC_REQUIRE(CanSwizzle<rush::Vec3f, 2>);
+    STATIC_REQUIRE(!CanSwizzle<rush::Vec3f, 3>);
+}
+
 TEST_CASE("Vector length", "[vector]") {
     V5 o = {4, 3, 2, 1, 0};
     float length2 = 1.0f + 4.0f + 9.0f + 16.0f;
@@ -224,6 +263,200 @@ TEST_CASE("Vector normalization (double)", "[vector]") {
     requireSimilar(normalizedLowGeneral.length(), 1.0);
 }
 
+TEST_CASE("Vector SIMD operations (float)", "[vector]") {
+    rush::Vec3f a3 = {1.0f, 2.0f, 3.0f};
+    rush::Vec3f b3 = {4.0f, -5.0f, 6.0f};
+    rush::Vec4f a4 = {1.0f, 2.0f, 3.0f, 4.0f};
+    rush::Vec4f b4 = {4.0f, -5.0f, 6.0f, 8.0f};
+
+    REQUIRE(a3 + b3 == rush::Vec3f(5.0f, -3.0f, 9.0f));
+    REQUIRE(a3 - b3 == rush::Vec3f(-3.0f, 7.0f, -3.0f));
+    REQUIRE(a3 * b3 == rush::Vec3f(4.0f, -10.0f, 18.0f));
+    REQUIRE(a4 / b4 == rush::Vec4f(0.25f, -0.4f, 0.5f, 0.5f));
+    REQUIRE(-a4 == rush::Vec4f(-1.0f, -2.0f, -3.0f, -4.0f));
+    REQUIRE(a4 * 2.0f == rush::Vec4f(2.0f, 4.0f, 6.0f, 8.0f));
+    REQUIRE(2.0f * a3 == rush::Vec3f(2.0f, 4.0f, 6.0f));
+    REQUIRE(1.0f - a3 == rush::Vec3f(0.0f, -1.0f, -2.0f));
+    REQUIRE(a3.dot(b3) == 12.0f);
+    REQUIRE(a4.dot(b4) == 44.0f);
+    REQUIRE(a3.cross(b3) == rush::Vec3f(27.0f, 6.0f, -13.0f));
+
+    rush::Vec4f c4 = a4;
+    c4 += b4;
+    c4 *= 0.5f;
+    REQUIRE(c4 == rush::Vec4f(2.5f, -1.5f, 4.5f, 6.0f));
+
+    // Three-component operations must not touch the next column.
+    rush::Mat3f m(1.0f);
+    m[0] += b3;
+    m[0] = m[0].normalized();
+    REQUIRE(m[1] == rush::Vec3f(0.0f, 1.0f, 0.0f));
+    requireSimilar(m[0].length(), 1.0f);
+
+    requireSimilar(a4.normalized<float, rush::HIGH_INTRINSICS>(),
+                   a4.normalized<float, rush::HIGH_GENERAL>());
+    requireSimilar(a3.normalized<float, rush::LOW_INTRINSICS>(),
+                   a3.normalized<float, rush::HIGH_GENERAL>());
+}
+
+TEST_CASE("Vector runtime dispatch", "[vector]") {
+    using V19f = rush::Vec<19, float>;
+    using V19d = rush::Vec<19, double, rush::HeapAllocator>;
+
+    V19f a([](size_t i) { return static_cast<float>(i); });
+    V19f b([](size_t i) { return static_cast<float>(19 - i); });
+    V19d c([](size_t i) { return static_cast<double>(i); });
+
+    auto supported = rush::cpu::supportedInstructionSet();
+    for (auto set: {
+             rush::InstructionSet::Generic,
+             rush::InstructionSet::SSE4,
+             rush::InstructionSet::AVX2,
+             rush::InstructionSet::AVX512
+         }) {
+        auto used = rush::cpu::setInstructionSet(set);
+        REQUIRE(used <= supported);
+        REQUIRE(rush::cpu::instructionSet() == used);
+
+        REQUIRE(a + b == V19f(19.0f));
+        REQUIRE(a.dot(b) == 1140.0f);
+        REQUIRE(-(a * 2.0f) == V19f([](size_t i) {
+            return -2.0f * static_cast<float>(i);
+        }));
+        REQUIRE(1.0f - a == V19f([](size_t i) {
+            return 1.0f - static_cast<float>(i);
+        }));
+        REQUIRE(c.dot(c) == 2109.0);
+        requireSimilar(c.normalized().length(), 1.0);
+    }
+    rush::cpu::setInstructionSet(supported);
+}
+
+template<typename A, typename B>
+concept CanAdd = requires(A a, B b) { a + b; };
+
+namespace {
+    template<size_t Size, typename Type>
+    void requireRangeReductions(size_t count) {
+        using V = rush::Vec<Size, Type>;
+        std::vector<V> vectors(count);
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t c = 0; c < Size; ++c) {
+                // Integer values keep the sums exact.
+                vectors[i][c] = static_cast<Type>(int((i * 7 + c * 13) % 101) - 50);
+            }
+        }
+
+        V min = vectors[0], max = vectors[0], sum(Type(0));
+        for (const V& v: vectors) {
+            min = rush::min(min, v);
+            max = rush::max(max, v);
+            sum += v;
+        }
+
+        auto supported = rush::cpu::supportedInstructionSet();
+        for (auto set: {
+                 rush::InstructionSet::Generic,
+                 rush::InstructionSet::SSE4,
+                 rush::InstructionSet::AVX2,
+                 rush::InstructionSet::AVX512
+             }) {
+            rush::cpu::setInstructionSet(set);
+            for (size_t threads: {1, 3}) {
+                REQUIRE(rush::min(vectors, threads) == min);
+                REQUIRE(rush::max(vectors, threads) == max);
+                REQUIRE(rush::minMax(vectors, threads) == std::make_pair(min, max));
+                REQUIRE(rush::sum(vectors, threads) == sum);
+                REQUIRE(rush::mean(vectors, threads) == sum / static_cast<Type>(count));
+                REQUIRE(rush::centroid(vectors, threads) == rush::mean(vectors));
+            }
+        }
+        rush::cpu::setInstructionSet(supported);
+    }
+}
+
+TEST_CASE("Vector range reductions", "[vector]") {
+    requireRangeReductions<3, float>(20011);
+    requireRangeReductions<4, float>(1001);
+    requireRangeReductions<2, double>(20011);
+    requireRangeReductions<5, float>(1);
+    requireRangeReductions<3, int>(20011);
+
+    std::array<rush::Vec3f, 3> points = {
+        rush::Vec3f(1.0f, -2.0f, 3.0f),
+        rush::Vec3f(-4.0f, 5.0f, 0.0f),
+        rush::Vec3f(2.0f, 2.0f, -6.0f)
+    };
+    std::span<const rush::Vec3f> span = points;
+    REQUIRE(rush::min(span) == rush::Vec3f(-4.0f, -2.0f, -6.0f));
+    REQUIRE(rush::max(points) == rush::Vec3f(2.0f, 5.0f, 3.0f));
+    REQUIRE(rush::centroid(points) == rush::Vec3f(-1.0f / 3.0f, 5.0f / 3.0f, -1.0f));
+    REQUIRE(rush::sum(std::vector<rush::Vec3f>()) == rush::Vec3f(0.0f));
+}
+
+TEST_CASE("Vector aligned allocator", "[vector]") {
+    using V4A = rush::Vec<4, float, rush::AlignedAllocator<32>>;
+    using V3A = rush::Vec<3, float, rush::CacheLineAllocator>;
+    using M4A = rush::Mat<4, 4, float, rush::MatDenseRep, rush::CacheLineAllocator>;
+
+    STATIC_REQUIRE(alignof(rush::Vec4f) == 16);
+    STATIC_REQUIRE(sizeof(rush::Vec4f) == 16);
+    STATIC_REQUIRE(sizeof(rush::Vec3f) == 12);
+    STATIC_REQUIRE(alignof(rush::Mat4f) == 16);
+    STATIC_REQUIRE(alignof(V4A) == 32);
+    STATIC_REQUIRE(alignof(rush::Vec<4, float, rush::AlignedAllocator<4>>) == 16);
+    STATIC_REQUIRE(sizeof(V3A) == 64);
+    STATIC_REQUIRE(alignof(M4A) == 64);
+    STATIC_REQUIRE(sizeof(M4A) == 64);
+
+    V4A a(1.0f, 2.0f, 3.0f, 4.0f);
+    V4A b = a * 2.0f + a;
+    REQUIRE(b == V4A(3.0f, 6.0f, 9.0f, 12.0f));
+    REQUIRE(a.dot(b) == 90.0f);
+    REQUIRE(V3A(1.0f, 0.0f, 0.0f).cross(V3A(0.0f, 1.0f, 0.0f)) == V3A(0.0f, 0.0f, 1.0f));
+
+    std::vector<M4A> matrices(5, M4A(2.0f));
+    for (const M4A& m: matrices) {
+        REQUIRE(reinterpret_cast<uintptr_t>(&m) % 64 == 0);
+    }
+    REQUIRE(matrices[3] * matrices[4] == M4A(4.0f));
+}
+
+TEST_CASE("Vector lazy expressions", "[vector]") {
+    rush::Vec4f a = {1.0f, 2.0f, 3.0f, 4.0f};
+    rush::Vec4f b = {4.0f, -5.0f, 6.0f, 8.0f};
+    rush::Vec4f c = {0.5f, 0.5f, 2.0f, 2.0f};
+    rush::Vec<4, float, rush::HeapAllocator> d = {1.0f, 1.0f, 1.0f, 1.0f};
+
+    rush::Vec4f r = rush::lazy(a) + rush::lazy(b) * c - d;
+    REQUIRE(r == a + b * c - d);
+
+    // The whole right-hand side is a single expression.
+    using Leaf = rush::ExpressionLeaf<rush::VecShape<4>, float>;
+    using Product = rush::ExpressionBinary<rush::ExpressionMul, rush::VecShape<4>, float, Leaf, Leaf>;
+    using Sum = rush::ExpressionBinary<rush::ExpressionAdd, rush::VecShape<4>, float, Leaf, Product>;
+    using Full = rush::ExpressionBinary<rush::ExpressionSub, rush::VecShape<4>, float, Sum, Leaf>;
+    STATIC_REQUIRE(std::is_same_v<decltype(rush::lazy(a) + rush::lazy(b) * c - d), Full>);
+
+    r = 2.0f * rush::lazy(a) / c + 1.0f;
+    REQUIRE(r == 2.0f * a / c + 1.0f);
+
+    // Aliasing is safe: every element only depends on itself.
+    r = -rush::lazy(r) * r;
+    REQUIRE(r == -(2.0f * a / c + 1.0f) * (2.0f * a / c + 1.0f));
+
+    d += rush::lazy(a) * 2.0f;
+    REQUIRE(d == rush::Vec<4, float, rush::HeapAllocator>(3.0f, 5.0f, 7.0f, 9.0f));
+
+    V5 i = {1, 2, 3, 4, 5};
+    V5 j = rush::lazy(i) * i - 1;
+    REQUIRE(j == V5(0, 3, 8, 15, 24));
+
+    // Operations without lazy operands stay eager.
+    STATIC_REQUIRE(std::is_same_v<decltype(a + b), rush::Vec4f>);
+    STATIC_REQUIRE_FALSE(CanAdd<decltype(rush::lazy(a)), rush::Vec3f>);
+}
+
 TEST_CASE("Vector angle (3D)", "[vector]") {
     constexpr double ANGLE = 45.0 * std::numbers::pi / 180.0;
 
@@ -292,4 +525,57 @@ TEST_CASE("Rush - GLM (Vector)", "[vector]") {
     consumerRef(back);
 }
 
-#endif
\ No newline at end of file
+#endif
+
+TEST_CASE("Vector constexpr", "[vector]") {
+    constexpr rush::Vec3f a(1.0f, 2.0f, 3.0f);
+    constexpr rush::Vec3f b = a * 2.0f + 1.0f;
+
+    STATIC_REQUIRE(b == rush::Vec3f(3.0f, 5.0f, 7.0f));
+    STATIC_REQUIRE(a.dot(b) == 34.0f);
+    STATIC_REQUIRE(a.cross(b) == rush::Vec3f(-1.0f, 2.0f, -1.0f));
+    STATIC_REQUIRE(rush::Vec3f(3.0f, 4.0f, 0.0f).length() == 5.0f);
+    STATIC_REQUIRE(V4(1, 2, 3, 4).reverse() == V4(4, 3, 2, 1));
+
+    constexpr auto table = [] {
+        std::array<rush::Vec2f, 8> result;
+        for (size_t i = 0; i < result.size(); ++i) {
+            float angle = std::numbers::pi_v<float> * 2.0f
+                          * static_cast<float>(i) / result.size();
+            result[i] = rush::Vec2f(rush::cos(angle), rush::sin(angle));
+        }
+        return result;
+    }();
+
+    for (size_t i = 0; i < table.size(); ++i) {
+        float angle = std::numbers::pi_v<float> * 2.0f
+                      * static_cast<float>(i) / table.size();
+        requireSimilar(table[i], rush::Vec2f(std::cos(angle), std::sin(angle)));
+        requireSimilar(table[i].normalized(), table[i]);
+    }
+}
+
+TEST_CASE("Vector low precision math", "[vector]") {
+    constexpr auto LOW = rush::LOW_INTRINSICS;
+    using V9f = rush::Vec<9, float>;
+
+    V9f angles([](size_t i) { return static_cast<float>(i) * 0.7f - 3.0f; });
+    V9f positives([](size_t i) { return static_cast<float>(i) + 0.5f; });
+
+    requireSimilar(rush::sin<LOW>(angles), rush::sin(angles), 1e-6f);
+    requireSimilar(rush::cos<LOW>(angles), rush::cos(angles), 1e-6f);
+    requireSimilar(rush::cos<rush::LOW_GENERAL>(angles), rush::cos(angles), 1e-6f);
+    requireSimilar(rush::exp<LOW>(angles), rush::exp(angles), 1e-4f);
+    requireSimilar(rush::log<LOW>(positives), rush::log(positives), 1e-6f);
+    requireSimilar(rush::atan2<LOW>(angles, positives), rush::atan2(angles, positives), 1e-6f);
+    requireSimilar(rush::pow<LOW>(positives, 1.5f), rush::pow(positives, 1.5f), 1e-3f);
+    requireSimilar(rush::pow<LOW>(positives, angles), rush::pow(positives, angles), 1e-3f);
+
+    auto [s, c] = rush::sincos<LOW>(rush::Vec3f(0.0f, 1.0f, 2.0f));
+    requireSimilar(s, rush::Vec3f(0.0f, std::sin(1.0f), std::sin(2.0f)), 1e-6f);
+    requireSimilar(c, rush::Vec3f(1.0f, std::cos(1.0f), std::cos(2.0f)), 1e-6f);
+
+    // Double vectors ignore the precision.
+    rush::Vec2d d(1.0, 2.0);
+    REQUIRE(rush::sin<LOW>(d) == rush::sin(d));
+}
@@ -4,6 +4,9 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
+#include <string>
+#include <vector>
+
 #include <rush/rush.h>
 
 using V1f = rush::Vec<1, float>;
@@ -81,3 +84,77 @@ TEST_CASE("Vector angle (4D)", "[!benchmark][vector]") {
                 { return o.angle<double, rush::LOW_GENERAL>(p); };
 }
 
+
+TEST_CASE("Vector SIMD operations (float)", "[!benchmark][vector]") {
+    V3f a = {4.0f, 3.0f, 2.0f};
+    V3f b = {2.0f, 10.0f, 1.0f};
+    rush::Vec4f c = {4.0f, 3.0f, 2.0f, 1.0f};
+    rush::Vec4f d = {2.0f, 10.0f, 1.0f, 5.0f};
+    BENCHMARK("Vec3f add") { return a + b; };
+    BENCHMARK("Vec3f dot") { return a.dot(b); };
+    BENCHMARK("Vec3f cross") { return a.cross(b); };
+    BENCHMARK("Vec3f normalized") { return a.normalized(); };
+    BENCHMARK("Vec4f mul") { return c * d; };
+    BENCHMARK("Vec4f dot") { return c.dot(d); };
+    BENCHMARK("Vec4f normalized") { return c.normalized(); };
+}
+
+TEST_CASE("Vector bulk packing", "[!benchmark][vector]") {
+    constexpr size_t AMOUNT = 100000;
+    std::vector<V3f> normals(AMOUNT, rush::Vec3f(0.48f, -0.6f, 0.64f));
+    std::vector<rush::Vec3h> halfs(AMOUNT);
+    std::vector<rush::Vec3sn16> snorms(AMOUNT);
+    std::vector<rush::OctNormal16> octahedral(AMOUNT);
+
+    auto supported = rush::cpu::supportedInstructionSet();
+    for (auto set: {rush::InstructionSet::Generic, supported}) {
+        rush::cpu::setInstructionSet(set);
+        std::string name = set == rush::InstructionSet::Generic ? " - Generic" : " - Dispatched";
+        BENCHMARK("Half pack" + name) {
+            rush::pack<rush::Vec3h>(normals, halfs);
+            return halfs[0];
+        };
+        BENCHMARK("Half unpack" + name) {
+            rush::unpack<rush::Vec3h>(halfs, normals);
+            return normals[0];
+        };
+        BENCHMARK("Snorm16 pack" + name) {
+            rush::pack<rush::Vec3sn16>(normals, snorms);
+            return snorms[0];
+        };
+    }
+    rush::cpu::setInstructionSet(supported);
+
+    BENCHMARK("Octahedral pack") {
+        rush::pack<rush::OctNormal16>(normals, octahedral);
+        return octahedral[0];
+    };
+}
+
+TEST_CASE("Vector range reductions", "[!benchmark][vector]") {
+    constexpr size_t AMOUNT = 1000000;
+    std::vector<V3f> points(AMOUNT);
+    for (size_t i = 0; i < AMOUNT; ++i) {
+        points[i] = V3f(static_cast<float>(i % 1000), static_cast<float>(i % 777), -static_cast<float>(i % 555));
+    }
+
+    BENCHMARK("Bounds - Loop") {
+        V3f min = points[0], max = points[0];
+        for (const V3f& p: points) {
+            min = rush::min(min, p);
+            max = rush::max(max, p);
+        }
+        return std::make_pair(min, max);
+    };
+
+    auto supported = rush::cpu::supportedInstructionSet();
+    for (auto set: {rush::InstructionSet::Generic, supported}) {
+        rush::cpu::setInstructionSet(set);
+        std::string name = set == rush::InstructionSet::Generic ? " - Generic" : " - Dispatched";
+        BENCHMARK("Bounds" + name) { return rush::bounds(points); };
+        BENCHMARK("Sum" + name) { return rush::sum(points); };
+    }
+    rush::cpu::setInstructionSet(supported);
+
+    BENCHMARK("Bounds - All threads") { return rush::bounds(points, 0); };
+}